@@ -1,473 +1,795 @@
-/**
-  ******************************************************************************
-  * @file    CircularBuffer.h
-  * @author  Dawid "SileliS" Bańkowski
-  * @brief   Circular Buffer class.
-  *          This file provides code to manage circular buffer.
-  *          It is platform independend.
-  *          based on: //https://github.com/embeddedartistry/embedded-resources
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
-  * All rights reserved.</center></h2>
-  *
-  * This software component is licensed by GNU Public Licence, * the "License" *;
-  * You may not use this file except in compliance with the License and name of author.
-  *
-  ******************************************************************************
-  */
-#ifndef CIRCULARBUFFER_H_
-#define CIRCULARBUFFER_H_
-
-
-#include <cstdio>
-#include <cstring>
-
-//TODO: translate comments to english (I did not do this because lack of time)
-
-using namespace std;
-
-/**
-  * @brief  circularBufferSearchResult is helpfull to return sopfisticated search results.
-  *
-  * @param  n/a
-  *
-  * @param  n/a
-  *         n/a
-  * @retval isFound - bool variable which value is TRUE (information had been found in buffer)
-  * 		tail2virtualTail_ - liczba (size_t), która informuje o odległości pomiędzy tail_,
-  * 		 a pozycją, w której odnaleziono informacje. W szczególnych przypadkach może
-  * 		 przyjmować 0, gdy:
-  * 				- isFound = flase (nie znaleziono informacji)
-  * 				- szukana informacja znajduje sie w pozycji tail_
-  */
-typedef struct circularBufferSearchResult{
-	bool isFound;
-	size_t tail2virtualTail_;
-};
-
-/**
-* @brief  	CircularBuffer to klasa obsługująca bufor kołowy.
-* @param  	T 		- typ zmiennej jaka ma być przechowywana w buforze kołowym
-* 			Size	- wielkośc bufora kołowego
-*
-*/
-template<typename T, size_t Size> class CircularBuffer {
-
-public:
-	CircularBuffer(void);
-	~CircularBuffer(void);
-	void put(T item);
-	T get(void);
-	bool isEmpty(void) const;
-	bool isFull(void) const;
-	bool isOverflowed(void) const;
-	void resetCircularBuffer(void);
-	size_t capacity(void) const;
-	size_t dataSize(void) const;
-	bool searchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate= true);
-	circularBufferSearchResult SearchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate= true);
-	bool searchItem(const void* item, size_t items, bool tailPosUpdate = true);
-	circularBufferSearchResult SearchItem(const void* item, size_t items, bool tailPosUpdate = true);
-
-
-
-protected:
-
-private:
-	T buf_[Size];									//bufor
-	size_t head_ = 0;								//miejsce zapisu danych
-	size_t tail_ = 0;								//miejsce odczytu danych
-	size_t max_size_ = Size;						//pojemnośc bufora
-	bool overflow = false;							//informacja o przepełnieniu bufora
-	bool full_ = 0;									//zmienia wartośc na 1 jeśli bufor zawiera conajmniej 1 daną
-	void clearBuffer(void);							//czyści bufor
-};
-
-
-
-/****************************************************************************************************
-*
-*
-*
-*
-****************************************************************************************************/
-
-
-/**
-* @brief  Konstruktor klasy.
-* @note   example: CircularBuffer<char, 25> nameOfBuffer;
-* @param  n/a.
-* @note   n/a.
-* @retval n/a.
-*/
-template<typename T, size_t Size> CircularBuffer<T, Size>::CircularBuffer(void) {
-	clearBuffer();
-}
-
-
-/**
-* @brief  destruktor klasy.
-* @note   n/a.
-* @param  n/a.
-* @note   Czyści dane w obiekcie.
-* @retval n/a.
-*/
-template<typename T, size_t Size> CircularBuffer<T, Size>::~CircularBuffer(void) {
-	head_ = 0;
-	tail_ = 0;
-	max_size_ = Size;
-}
-
-
-
-/**
-* @brief  Zeruje parametry obiektu i czyści jego zawartość.
-* @note   Wymagane m.in. w przypadku, gdby bufor został przepełniony.
-*
-* @param  n/a.
-*
-* @note   Zmienia parmetry: head_, full_ , overflow
-*
-* @retval Zwraca: n/a.
-*/
-template <typename T, size_t Size> void CircularBuffer<T, Size>::resetCircularBuffer(void) {
-	head_ = tail_;
-	full_ = false;
-	overflow = false;
-	clearBuffer();
-}
-
-template <typename T, size_t Size> void CircularBuffer<T, Size>::clearBuffer(void) {
-	memset(buf_, NULL, sizeof(T)*Size);
-}
-
-
-
-
-/**
-* @brief  Sprawdza czy w buforze znajdują się jakieś nieprzeczytane dane.
-* @note   n/a.
-*
-* @param  n/a.
-*
-* @note   n/a.
-*
-* @retval Zwraca:
-* 			- TRUE jeśli bufor jest pusty
-* 			- FALSE jeśli w buforze znajduje się jakakolwiek nieprzeczytana informacja
-*/
-template<typename T, size_t Size> bool  CircularBuffer<T, Size>::isEmpty(void) const {
-	return (!full_ && (head_ == tail_));
-}
-
-
-/**
-* @brief  Sprawdza czy do bufora można wpisać jeszcze jakieś dane.
-* @note   n/a.
-*
-* @param  n/a.
-*
-* @note   n/a.
-*
-* @retval Zwraca:
-*  			- TRUE jeśli bufor jest pełny dataSize == max_size
-*  			- FALSE jeśli w buforze jest jeszcze miejsce do zapisania danych
-*/
-template<typename T, size_t Size> bool  CircularBuffer<T, Size>::isFull(void) const {
-	return full_;
-}
-
-
-/**
-* @brief  Zwraca informację czy bufor nie został przepełniony.
-* @note   Przepełnienie oznacza brak spójności w konsystencji danych
-*
-* @param  n/a.
-*
-* @note   n/a.
-*
-* @retval Zwraca: TRUE FALSE
-*/
-template<typename T, size_t Size> bool CircularBuffer<T, Size>::isOverflowed(void) const {
-	return overflow;
-}
-
-
-/**
-* @brief  Zwraca informację na temat max pojemności bufora.
-* @note   n/a.
-*
-* @param  n/a.
-*
-* @note   n/a.
-*
-* @retval Zwraca wartośc (size_t) na temat maksymalniej pojemnosci bufora
-*/
-template<typename T, size_t Size> size_t CircularBuffer<T, Size>::capacity(void) const {
-	return max_size_;
-}
-
-
-
-/**
-* @brief  Zwraca informację na temat ilości danych przechowywanych w buforze.
-* @note   n/a.
-*
-* @param  n/a.
-*
-* @note   n/a.
-*
-* @retval Zwraca wartośc (size_t) ilości danych przechowywanych w buforze
-*/
-template<typename T, size_t Size> size_t CircularBuffer<T, Size>::dataSize(void) const {
-
-	size_t size = max_size_;
-	if (!full_) {
-		if (head_ >= tail_) {
-			return size = head_ - tail_;
-		} else {
-			return size = max_size_ + head_ - tail_;
-		}
-	}
-
-	return size;
-}
-
-
-/**
-* @brief  Wstawia do obiektu daną.
-* @note   Wstawia w miejsce wskazane przez head_
-
-* @param  n/a.
-* @note   Uaktualnia przy tym następujące zmienne w klasie:
-* 		- head_
-* 		- full,
-* 		- overflow
-* @retval n/a.
-*/
-template<typename T, size_t Size> void CircularBuffer<T, Size>::put(T item) {				//put item into buffer
-	buf_[head_] = item;
-
-	if (full_) {
-		tail_ = (tail_ + 1) % max_size_;
-		overflow = true;
-	}
-
-	head_ = (head_ + 1) % max_size_;
-	full_ = head_ == tail_;
-}
-
-
-
-/**
-* @brief  Czyta dane z bufora kołowego.
-* @note   Czyta daną z bufora kołowego wskazaną przez tail_
-*
-* @param  n/a.
-*
-* @note   Uaktualnia przy tym następujące zmienne w klasie:
-* 		- full,
-* 		- tail_
-*
-* @retval Zwraca:
-* 			- warość typu T znajdującą się w przeczytanej komórce bufora jeśli isEmpty()!= TRUE
-* 			- T() jeśli isEmpty()== TRUE
-*/
-template<typename T, size_t Size> T CircularBuffer<T, Size>::get(void) {					//read item from buffer
-	if (isEmpty()) {
-		return T();
-	}
-	T val = buf_[tail_];
-	full_ = false;
-	tail_ = (tail_ + 1) % max_size_;
-
-	return val;
-}
-
-
-/**
-* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
-* @note   Wyszukuje w zakresie od tail_ do tail_ + range
-*
-* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
-* 		  items 		- ilość danych typu T jaka ma być wyszukana
-* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
-* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
-* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
-* @note   n/a.
-*
-* @retval Zwraca strukturę circularBufferSearchResult o następujących polach:
-		  - isFound przyjmujących wartości:
-* 				- TRUE jeśli szukana wartośc została odnaleziona
-* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
-								nie znaleziono szukanej sekwencji
-								bufor został przepełniony i istnieje ryzyko błędnego odczytu
-		  - tail2virtualTail przyjmującą wartości:
-		  	    - > 0 wskazującą miejsce w buforze, w którym dana sekwencja jest zlokalizowana
-		  	    -   0 gdy nie znaleziono szukanej sekwencji lub znajduje się ona w pozycji 0 bufora
-		  	  	 -
-*/
-template<typename T, size_t Size> circularBufferSearchResult CircularBuffer<T, Size>::SearchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate){
-	circularBufferSearchResult returnVAL;
-	returnVAL.isFound =false;
-	returnVAL.tail2virtualTail_ =0;
-	if (!isOverflowed())
-	{
-		size_t searchingPosition = tail_;
-
-		if (range > max_size_)
-			range = max_size_;
-		size_t toLinearedHead_ = tail_ + range;
-
-		size_t itemsOnTheEnd;						//liczba pamięta ile danych memcmp powinno sprawdzić na końcu bufora kołowego, a ile na jego początku
-		size_t tail2virtualTail_Distance = 0;
-
-		char* cbuf_ = (char *) buf_;
-		char* citem = (char *) item;
-
-		while(searchingPosition+items <= toLinearedHead_)
-		{
-			searchingPosition = (searchingPosition) % max_size_;
-
-			itemsOnTheEnd = max_size_- searchingPosition;			//sprawdzanie czy części danych nie trzeba szukać na początku bufora kołowego
-			if (itemsOnTheEnd>=items)
-				itemsOnTheEnd=items;
-
-			if (memcmp((cbuf_+searchingPosition ), citem, sizeof (T)*itemsOnTheEnd)==0)				//sprawdzanie danych na końcu bufora kołowego
-			{
-
-				if (memcmp((cbuf_), citem+itemsOnTheEnd, sizeof (T)*(items-itemsOnTheEnd))==0)		//sprawdzanie danych na początku bufora kołowego
-				{
-					returnVAL.isFound = true;
-					returnVAL.tail2virtualTail_ =tail2virtualTail_Distance/sizeof(T);
-					if (tailPosUpdate==true)
-					{
-						tail_=searchingPosition;		//ustawnienie pozycji odczytu na miejsce taila
-					}
-					return returnVAL;					//znaleziono poprawną sekwencję
-				}
-			}
-			searchingPosition++;
-			if (searchingPosition == tail_)		//aby wyjśc z pętli nieskończonej jesli w buforze nie ma szukanego ciągu
-				break;
-			tail2virtualTail_Distance++;
-		};
-	}
-	return returnVAL;		//szukany ciąg nazków jest dłuższy niż dane w buforze lub
-						//nie znaleziono szukanej sekwencji
-						//bufor został przepełniony i istnieje ryzyko błędnego odczytu
-}
-
-
-/**
-* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
-* @note   Wyszukuje w zakresie od tail_ do head_
-*
-* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
-* 		  items 		- ilość danych typu T jaka ma być wyszukana
-* 		  range 		- zakres przeszukiwania
-* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
-* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
-* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
-* @note   n/a.
-*
-* @retval Zwraca strukturę circularBufferSearchResult o następujących polach:
-		  - isFound przyjmujących wartości:
-* 				- TRUE jeśli szukana wartośc została odnaleziona
-* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
-								nie znaleziono szukanej sekwencji
-								bufor został przepełniony i istnieje ryzyko błędnego odczytu
-		  - tail2virtualTail przyjmującą wartości:
-				- > 0 wskazującą miejsce w buforze, w którym dana sekwencja jest zlokalizowana
-
-*/
-template<typename T, size_t Size> circularBufferSearchResult CircularBuffer<T, Size>::SearchItem(const void *item, size_t items, bool tailPosUpdate) {
-	return SearchItemTail2Range (item, items, dataSize(), tailPosUpdate);
-}
-
-
-/**
-* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
-* @note   Wyszukuje w zakresie od tail_ do head_
-*
-* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
-* 		  items 		- ilość danych typu T jaka ma być wyszukana
-* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
-* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
-* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
-* @note   n/a.
-*
-* @retval Zwraca:
-* 				- TRUE jeśli szukana wartośc została odnaleziona
-* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
-								nie znaleziono szukanej sekwencji
-								bufor został przepełniony i istnieje ryzyko błędnego odczytu
-*/
-template<typename T, size_t Size> bool CircularBuffer<T, Size>::searchItem(const void *item, size_t items, bool tailPosUpdate) {
-	return searchItemTail2Range(item, items, dataSize(), tailPosUpdate);
-}
-
-
-
-
-/**
-* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
-* @note   Wyszukuje w zakresie od tail_ do tail_ + range
-*
-* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
-* 		  items 		- ilość danych typu T jaka ma być wyszukana
-* 		  range 		- zakres przeszukiwania
-* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
-* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
-* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
-* @note   n/a.
-*
-* @retval Zwraca:
-* 				- TRUE jeśli szukana wartośc została odnaleziona
-* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
-								nie znaleziono szukanej sekwencji
-								bufor został przepełniony i istnieje ryzyko błędnego odczytu
-*/
-template<typename T, size_t Size> bool CircularBuffer<T, Size>::searchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate) {
-	if (!isOverflowed())
-	{
-		size_t searchingPosition = tail_;
-		if (range > max_size_)
-			range = max_size_;
-		size_t toLinearedHead_ = tail_ + range; //dataSize(head_, range);				//virtualny koniec bufora, gdyby był liniowym
-		size_t itemsOnTheEnd;										//liczba pamięta ile danych memcmp powinno sprawdzić na końcu bufora kołowego, a ile na jego początku
-
-		char* cbuf_ = (char *) buf_;								//potrzeba, aby przyjmować const void *item
-		char* citem = (char *) item;								//potrzeba, aby przyjmować const void *item
-
-		while(searchingPosition+items <= toLinearedHead_)
-		{
-			searchingPosition = (searchingPosition) % max_size_;
-
-			itemsOnTheEnd = max_size_- searchingPosition;			//sprawdzanie czy części danych nie trzeba szukać na początku bufora kołowego
-			if (itemsOnTheEnd>=items)
-				itemsOnTheEnd=items;
-
-			if (memcmp((cbuf_+searchingPosition ), citem, sizeof (T)*itemsOnTheEnd)==0)				//sprawdzanie danych na końcu bufora kołowego
-			{
-				if (memcmp((cbuf_), citem+itemsOnTheEnd, sizeof (T)*(items-itemsOnTheEnd))==0)		//sprawdzanie danych na początku bufora kołowego
-				{
-					if (tailPosUpdate==true)
-						tail_=searchingPosition;		//ustawnienie pozycji odczytu na miejsce taila
-					return true;					//znaleziono poprawną sekwencję
-				}
-			}
-			searchingPosition++;
-			if (searchingPosition == tail_)		//aby wyjśc z pętli nieskończonej jesli w buforze nie ma szukanego ciągu
-				break;
-		};
-	}
-	return false;		//szukany ciąg nazków jest dłuższy niż dane w buforze lub
-						//nie znaleziono szukanej sekwencji
-						//bufor został przepełniony i istnieje ryzyko błędnego odczytu
-}
-
-#endif
-/* CIRCULARBUFFER_H_ */
+/**
+  ******************************************************************************
+  * @file    CircularBuffer.h
+  * @author  Dawid "SileliS" Bańkowski
+  * @brief   Circular Buffer class.
+  *          This file provides code to manage circular buffer.
+  *          It is platform independend.
+  *          based on: //https://github.com/embeddedartistry/embedded-resources
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You may not use this file except in compliance with the License and name of author.
+  *
+  ******************************************************************************
+  */
+#ifndef CIRCULARBUFFER_H_
+#define CIRCULARBUFFER_H_
+
+
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <stdint.h>
+#ifdef __ARM_FEATURE_SIMD32
+#include <arm_acle.h>				//__usub8, __sel (Cortex-M4/M7 DSP instructions)
+#endif
+
+//TODO: translate comments to english (I did not do this because lack of time)
+
+//#define CIRCULARBUFFER_DEBUG_POISON	0xA5		//debug: bufor jest wypełniany tym bajtem w konstruktorze i resetCircularBuffer(),
+													// stare dane są wtedy widoczne w debuggerze jako 0xA5A5...
+
+using namespace std;
+
+/**
+  * @brief  circularBufferSearchResult is helpfull to return sopfisticated search results.
+  *
+  * @param  n/a
+  *
+  * @param  n/a
+  *         n/a
+  * @retval isFound - bool variable which value is TRUE (information had been found in buffer)
+  * 		tail2virtualTail_ - liczba (size_t), która informuje o odległości pomiędzy tail_,
+  * 		 a pozycją, w której odnaleziono informacje. W szczególnych przypadkach może
+  * 		 przyjmować 0, gdy:
+  * 				- isFound = flase (nie znaleziono informacji)
+  * 				- szukana informacja znajduje sie w pozycji tail_
+  */
+struct circularBufferSearchResult{
+	bool isFound;
+	size_t tail2virtualTail_;
+};
+
+/**
+* @brief  	CircularBuffer to klasa obsługująca bufor kołowy.
+* @param  	T 		- typ zmiennej jaka ma być przechowywana w buforze kołowym
+* 			Size	- wielkośc bufora kołowego
+* 			Mirrored - true: tablica ma rozmiar 2*Size i każda dana jest
+* 					   zapisywana dwa razy (buf_[i] i buf_[i+Size]), dzięki
+* 					   czemu dane od tail_ (max. Size) są zawsze ciągłe w
+* 					   pamięci. Wyszukiwanie to jeden memcmp na pozycję, a
+* 					   linearData() zwraca wskaźnik do wszystkich danych.
+* 					   Koszt: 2x pamięci i dwa zapisy w put().
+*
+*/
+template<typename T, size_t Size, bool Mirrored = false> class CircularBuffer {
+	static_assert(std::is_trivially_copyable<T>::value, "CircularBuffer: T is compared with memcmp and has to be trivially copyable");
+	static_assert(Size > 0, "CircularBuffer: Size has to be > 0");
+
+public:
+	/*
+	 * const_iterator przechodzi po danych od tail_ do head_ (bez ich czytania),
+	 * może być użyty w std::find, std::search, std::count itp.
+	 * Iterator traci ważność po put(), get() i przesunięciu tail_ przez wyszukiwanie.
+	 */
+	class const_iterator {
+	public:
+		typedef std::forward_iterator_tag	iterator_category;
+		typedef T							value_type;
+		typedef ptrdiff_t					difference_type;
+		typedef const T*					pointer;
+		typedef const T&					reference;
+
+		const_iterator(void): pBuffer(0), distance_(0) {}
+		const_iterator(const CircularBuffer* pCircularBuffer, size_t distance): pBuffer(pCircularBuffer), distance_(distance) {}
+		reference operator*(void) const { return pBuffer->buf_[pBuffer->position(distance_)]; }
+		pointer operator->(void) const { return &pBuffer->buf_[pBuffer->position(distance_)]; }
+		const_iterator& operator++(void) { distance_++; return *this; }
+		const_iterator operator++(int) { const_iterator previous = *this; distance_++; return previous; }
+		bool operator==(const const_iterator& other) const { return distance_ == other.distance_ && pBuffer == other.pBuffer; }
+		bool operator!=(const const_iterator& other) const { return !(*this == other); }
+		size_t distance(void) const { return distance_; }		//odległość od tail_
+	private:
+		const CircularBuffer* pBuffer;
+		size_t distance_;
+	};
+
+	CircularBuffer(void);
+	~CircularBuffer(void);
+	void put(T item);
+	T get(void);
+	bool isEmpty(void) const;
+	bool isFull(void) const;
+	bool isOverflowed(void) const;
+	void resetCircularBuffer(void);
+	size_t capacity(void) const;
+	size_t dataSize(void) const;
+	bool searchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate= true);
+	circularBufferSearchResult SearchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate= true);
+	bool searchItem(const void* item, size_t items, bool tailPosUpdate = true);
+	circularBufferSearchResult SearchItem(const void* item, size_t items, bool tailPosUpdate = true);
+	circularBufferSearchResult SearchItemTail2Range(const T *item, size_t items, size_t range, bool tailPosUpdate= true);	//typowane wersje, items to liczba elementów T
+	circularBufferSearchResult SearchItem(const T* item, size_t items, bool tailPosUpdate = true);
+	const_iterator find(const T* item, size_t items) const;	//wyszukiwanie bez zmiany tail_, end() jeśli nie znaleziono
+	const_iterator begin(void) const;
+	const_iterator end(void) const;
+	T peek(size_t distance = 0) const;				//dana w odległości distance od tail_ bez jej czytania
+	const T* linearData(size_t* pLength) const;		//wskaźnik do danych od tail_ i liczba danych ciągłych w pamięci (peek span)
+	void release(size_t items);						//zwolnienie items danych przeczytanych przez linearData()
+	T* reserve(size_t items, size_t* pReserved);	//ciągłe wolne miejsce od head_ do zapisu np. przez DMA
+	void commit(size_t items);						//items danych zapisanych w miejscu z reserve()
+	size_t putN(const T* pItems, size_t items);		//zapis bez nadpisywania, zwraca liczbę zapisanych danych
+	size_t getN(T* pItems, size_t items);			//odczyt, zwraca liczbę przeczytanych danych
+
+
+
+protected:
+
+private:
+	T buf_[Mirrored ? 2*Size : Size];				//bufor, w trybie Mirrored druga połowa jest kopią pierwszej
+	size_t head_ = 0;								//miejsce zapisu danych
+	size_t tail_ = 0;								//miejsce odczytu danych
+	size_t max_size_ = Size;						//pojemnośc bufora
+	bool overflow = false;							//informacja o przepełnieniu bufora
+	bool full_ = 0;									//zmienia wartośc na 1 jeśli bufor zawiera conajmniej 1 daną
+	void poisonBuffer(void);						//debug: wypełnia bufor CIRCULARBUFFER_DEBUG_POISON
+	size_t position(size_t distance) const;			//pozycja w buf_ danej w odległości distance od tail_
+	bool findItems(const T* item, size_t items, size_t range, size_t* pDistance) const;
+	bool isMatch(size_t position, const T* item, size_t items) const;	//porównanie danych od pozycji position z item
+	size_t findFirstItem(size_t distance, size_t end, const T* item) const;	//odległość od tail_ pierwszego wystąpienia *item
+	static size_t scanBytes(const uint8_t* pData, size_t length, uint8_t value);	//SWAR, 4 bajty na krok
+};
+
+
+
+/****************************************************************************************************
+*
+*
+*
+*
+****************************************************************************************************/
+
+
+/**
+* @brief  Konstruktor klasy.
+* @note   example: CircularBuffer<char, 25> nameOfBuffer;
+* @param  n/a.
+* @note   n/a.
+* @retval n/a.
+*/
+template<typename T, size_t Size, bool Mirrored> CircularBuffer<T, Size, Mirrored>::CircularBuffer(void) {
+	poisonBuffer();
+}
+
+
+/**
+* @brief  destruktor klasy.
+* @note   n/a.
+* @param  n/a.
+* @note   Czyści dane w obiekcie.
+* @retval n/a.
+*/
+template<typename T, size_t Size, bool Mirrored> CircularBuffer<T, Size, Mirrored>::~CircularBuffer(void) {
+	head_ = 0;
+	tail_ = 0;
+	max_size_ = Size;
+}
+
+
+
+/**
+* @brief  Zeruje parametry obiektu.
+* @note   Wymagane m.in. w przypadku, gdby bufor został przepełniony.
+* 		  Czas stały (O(1)) - zawartość tablicy nie jest czyszczona,
+* 		  wyszukiwanie i odczyt są ograniczone do dataSize(), więc stare
+* 		  dane nie są widoczne.
+*
+* @param  n/a.
+*
+* @note   Zmienia parmetry: head_, tail_, full_ , overflow
+*
+* @retval Zwraca: n/a.
+*/
+template <typename T, size_t Size, bool Mirrored> void CircularBuffer<T, Size, Mirrored>::resetCircularBuffer(void) {
+	head_ = 0;
+	tail_ = 0;
+	full_ = false;
+	overflow = false;
+	poisonBuffer();
+}
+
+/**
+* @brief  Wypełnia bufor bajtem CIRCULARBUFFER_DEBUG_POISON (tylko debug).
+* @note   Bez CIRCULARBUFFER_DEBUG_POISON nic nie robi.
+*/
+template <typename T, size_t Size, bool Mirrored> void CircularBuffer<T, Size, Mirrored>::poisonBuffer(void) {
+#ifdef CIRCULARBUFFER_DEBUG_POISON
+	memset(buf_, CIRCULARBUFFER_DEBUG_POISON, sizeof(buf_));
+#endif
+}
+
+
+
+
+/**
+* @brief  Sprawdza czy w buforze znajdują się jakieś nieprzeczytane dane.
+* @note   n/a.
+*
+* @param  n/a.
+*
+* @note   n/a.
+*
+* @retval Zwraca:
+* 			- TRUE jeśli bufor jest pusty
+* 			- FALSE jeśli w buforze znajduje się jakakolwiek nieprzeczytana informacja
+*/
+template<typename T, size_t Size, bool Mirrored> bool  CircularBuffer<T, Size, Mirrored>::isEmpty(void) const {
+	return (!full_ && (head_ == tail_));
+}
+
+
+/**
+* @brief  Sprawdza czy do bufora można wpisać jeszcze jakieś dane.
+* @note   n/a.
+*
+* @param  n/a.
+*
+* @note   n/a.
+*
+* @retval Zwraca:
+*  			- TRUE jeśli bufor jest pełny dataSize == max_size
+*  			- FALSE jeśli w buforze jest jeszcze miejsce do zapisania danych
+*/
+template<typename T, size_t Size, bool Mirrored> bool  CircularBuffer<T, Size, Mirrored>::isFull(void) const {
+	return full_;
+}
+
+
+/**
+* @brief  Zwraca informację czy bufor nie został przepełniony.
+* @note   Przepełnienie oznacza brak spójności w konsystencji danych
+*
+* @param  n/a.
+*
+* @note   n/a.
+*
+* @retval Zwraca: TRUE FALSE
+*/
+template<typename T, size_t Size, bool Mirrored> bool CircularBuffer<T, Size, Mirrored>::isOverflowed(void) const {
+	return overflow;
+}
+
+
+/**
+* @brief  Zwraca informację na temat max pojemności bufora.
+* @note   n/a.
+*
+* @param  n/a.
+*
+* @note   n/a.
+*
+* @retval Zwraca wartośc (size_t) na temat maksymalniej pojemnosci bufora
+*/
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::capacity(void) const {
+	return max_size_;
+}
+
+
+
+/**
+* @brief  Zwraca informację na temat ilości danych przechowywanych w buforze.
+* @note   n/a.
+*
+* @param  n/a.
+*
+* @note   n/a.
+*
+* @retval Zwraca wartośc (size_t) ilości danych przechowywanych w buforze
+*/
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::dataSize(void) const {
+
+	size_t size = max_size_;
+	if (!full_) {
+		if (head_ >= tail_) {
+			return size = head_ - tail_;
+		} else {
+			return size = max_size_ + head_ - tail_;
+		}
+	}
+
+	return size;
+}
+
+
+/**
+* @brief  Wstawia do obiektu daną.
+* @note   Wstawia w miejsce wskazane przez head_
+
+* @param  n/a.
+* @note   Uaktualnia przy tym następujące zmienne w klasie:
+* 		- head_
+* 		- full,
+* 		- overflow
+* @retval n/a.
+*/
+template<typename T, size_t Size, bool Mirrored> void CircularBuffer<T, Size, Mirrored>::put(T item) {				//put item into buffer
+	buf_[head_] = item;
+	if (Mirrored)
+		buf_[head_ + Size] = item;						//kopia lustrzana, dane od tail_ są ciągłe
+
+	if (full_) {
+		tail_ = (tail_ + 1) % max_size_;
+		overflow = true;
+	}
+
+	head_ = (head_ + 1) % max_size_;
+	full_ = head_ == tail_;
+}
+
+
+
+/**
+* @brief  Czyta dane z bufora kołowego.
+* @note   Czyta daną z bufora kołowego wskazaną przez tail_
+*
+* @param  n/a.
+*
+* @note   Uaktualnia przy tym następujące zmienne w klasie:
+* 		- full,
+* 		- tail_
+*
+* @retval Zwraca:
+* 			- warość typu T znajdującą się w przeczytanej komórce bufora jeśli isEmpty()!= TRUE
+* 			- T() jeśli isEmpty()== TRUE
+*/
+template<typename T, size_t Size, bool Mirrored> T CircularBuffer<T, Size, Mirrored>::get(void) {					//read item from buffer
+	if (isEmpty()) {
+		return T();
+	}
+	T val = buf_[tail_];
+	full_ = false;
+	tail_ = (tail_ + 1) % max_size_;
+
+	return val;
+}
+
+
+/**
+* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
+* @note   Wyszukuje w zakresie od tail_ do tail_ + range
+*
+* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
+* 		  items 		- ilość danych typu T jaka ma być wyszukana
+* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
+* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
+* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
+* @note   n/a.
+*
+* @retval Zwraca strukturę circularBufferSearchResult o następujących polach:
+		  - isFound przyjmujących wartości:
+* 				- TRUE jeśli szukana wartośc została odnaleziona
+* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
+								nie znaleziono szukanej sekwencji
+								bufor został przepełniony i istnieje ryzyko błędnego odczytu
+		  - tail2virtualTail przyjmującą wartości:
+		  	    - > 0 wskazującą miejsce w buforze, w którym dana sekwencja jest zlokalizowana
+		  	    -   0 gdy nie znaleziono szukanej sekwencji lub znajduje się ona w pozycji 0 bufora
+		  	  	 -
+*/
+template<typename T, size_t Size, bool Mirrored> circularBufferSearchResult CircularBuffer<T, Size, Mirrored>::SearchItemTail2Range(const T *item, size_t items, size_t range, bool tailPosUpdate){
+	circularBufferSearchResult returnVAL;
+	returnVAL.isFound = findItems(item, items, range, &returnVAL.tail2virtualTail_);
+	if (returnVAL.isFound == true && tailPosUpdate == true && returnVAL.tail2virtualTail_ > 0)
+	{
+		tail_ = position(returnVAL.tail2virtualTail_);		//ustawnienie pozycji odczytu na miejsce taila
+		full_ = false;
+	}
+	return returnVAL;
+}
+
+template<typename T, size_t Size, bool Mirrored> circularBufferSearchResult CircularBuffer<T, Size, Mirrored>::SearchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate){
+	return SearchItemTail2Range((const T*) item, items, range, tailPosUpdate);
+}
+
+
+/**
+* @brief  Wyszukuje item w zakresie od tail_ do tail_ + range bez zmiany tail_.
+* @note   Odległość jest liczona w elementach T (nie w bajtach).
+*
+* @param  *item 		- szukane dane
+* 		  items 		- ilość danych typu T
+* 		  range 		- zakres przeszukiwania, ograniczany do dataSize()
+* 		  *pDistance	- odległość od tail_ znalezionej sekwencji, 0 jeśli nie znaleziono
+*
+* @retval FALSE jeśli: 	szukany ciąg jest dłuższy niż dane w buforze lub
+* 						nie znaleziono szukanej sekwencji
+* 						bufor został przepełniony i istnieje ryzyko błędnego odczytu
+*/
+template<typename T, size_t Size, bool Mirrored> bool CircularBuffer<T, Size, Mirrored>::findItems(const T* item, size_t items, size_t range, size_t* pDistance) const {
+	*pDistance = 0;
+	if (isOverflowed() || items == 0)
+		return false;
+	if (range > dataSize())							//poza danymi są tylko stare (przeczytane) dane
+		range = dataSize();
+
+	for (size_t tail2virtualTail_Distance = 0; tail2virtualTail_Distance + items <= range; tail2virtualTail_Distance++)
+	{
+		tail2virtualTail_Distance = findFirstItem(tail2virtualTail_Distance, range - items + 1, item);	//przeskok do kandydata (zgodny pierwszy element)
+		if (tail2virtualTail_Distance + items > range)
+			break;
+		if (isMatch(Mirrored ? tail_ + tail2virtualTail_Distance : position(tail2virtualTail_Distance), item, items))
+		{
+			*pDistance = tail2virtualTail_Distance;
+			return true;							//znaleziono poprawną sekwencję
+		}
+	}
+	return false;
+}
+
+
+/**
+* @brief  Typowe API do danych bez ich czytania.
+* @note   find() nie zmienia tail_, zwraca iterator do początku
+* 		  znalezionej sekwencji lub end().
+* 		  peek() zwraca T() jeśli distance >= dataSize().
+*/
+template<typename T, size_t Size, bool Mirrored> typename CircularBuffer<T, Size, Mirrored>::const_iterator CircularBuffer<T, Size, Mirrored>::find(const T* item, size_t items) const {
+	size_t distance;
+	if (findItems(item, items, dataSize(), &distance))
+		return const_iterator(this, distance);
+	return end();
+}
+
+template<typename T, size_t Size, bool Mirrored> typename CircularBuffer<T, Size, Mirrored>::const_iterator CircularBuffer<T, Size, Mirrored>::begin(void) const {
+	return const_iterator(this, 0);
+}
+
+template<typename T, size_t Size, bool Mirrored> typename CircularBuffer<T, Size, Mirrored>::const_iterator CircularBuffer<T, Size, Mirrored>::end(void) const {
+	return const_iterator(this, dataSize());
+}
+
+template<typename T, size_t Size, bool Mirrored> T CircularBuffer<T, Size, Mirrored>::peek(size_t distance) const {
+	if (distance >= dataSize())
+		return T();
+	return buf_[position(distance)];
+}
+
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::position(size_t distance) const {
+	size_t position = tail_ + distance;
+	if (position >= max_size_)
+		position -= max_size_;
+	return position;
+}
+
+
+/**
+* @brief  Porównuje dane bufora od pozycji position z item.
+* @note   W trybie Mirrored dane są ciągłe, więc wystarcza jeden memcmp,
+* 		  w zwykłym trybie porównanie jest dzielone na koniec i początek
+* 		  tablicy.
+*
+* @param  position	- pozycja w buf_ (< Size)
+* 		  *item		- szukane dane
+* 		  items		- ilość danych typu T
+*
+* @retval TRUE jeśli dane są zgodne
+*/
+template<typename T, size_t Size, bool Mirrored> bool CircularBuffer<T, Size, Mirrored>::isMatch(size_t position, const T* item, size_t items) const {
+	if (Mirrored)
+		return memcmp(buf_ + position, item, sizeof(T)*items) == 0;
+
+	size_t itemsOnTheEnd = max_size_ - position;		//liczba pamięta ile danych memcmp powinno sprawdzić na końcu bufora kołowego, a ile na jego początku
+	if (itemsOnTheEnd > items)
+		itemsOnTheEnd = items;
+	if (memcmp(buf_ + position, item, sizeof(T)*itemsOnTheEnd) != 0)					//sprawdzanie danych na końcu bufora kołowego
+		return false;
+	return memcmp(buf_, item + itemsOnTheEnd, sizeof(T)*(items - itemsOnTheEnd)) == 0;	//sprawdzanie danych na początku bufora kołowego
+}
+
+
+/**
+* @brief  Szuka pierwszego elementu item[0] w zakresie odległości od tail_ <distance, end).
+* @note   Dla T o rozmiarze 1 bajta dane są przeszukiwane słowami 32-bit
+* 		  (scanBytes), w pozostałych przypadkach element po elemencie.
+* 		  W zwykłym trybie zakres jest dzielony na koniec i początek tablicy.
+*
+* @param  distance	- odległość od tail_, od której zaczyna się szukanie
+* 		  end		- odległość od tail_, na której szukanie się kończy
+* 		  *item		- szukane dane (liczy się tylko pierwszy element)
+*
+* @retval odległość od tail_ znalezionego elementu lub end, jeśli nie znaleziono
+*/
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::findFirstItem(size_t distance, size_t end, const T* item) const {
+	while (distance < end)
+	{
+		size_t position = Mirrored ? tail_ + distance : this->position(distance);
+		size_t length = end - distance;
+		if (!Mirrored && position + length > max_size_)
+			length = max_size_ - position;				//do końca tablicy, reszta w następnym przebiegu
+
+		size_t found = 0;
+		if (sizeof(T) == 1)
+			found = scanBytes((const uint8_t*) (buf_ + position), length, *(const uint8_t*) item);
+		else
+			while (found < length && memcmp(buf_ + position + found, item, sizeof(T)) != 0)
+				found++;
+
+		distance += found;
+		if (found < length)
+			return distance;
+	}
+	return end;
+}
+
+
+/**
+* @brief  Szuka bajtu value w pData, 4 bajty na krok (SWAR).
+* @note   Słowo jest XOR-owane z value powielonym na 4 bajty, więc szukany
+* 		  bajt to bajt zerowy słowa:
+* 		  - Cortex-M4/M7 (__ARM_FEATURE_SIMD32): USUB8 ustawia flagi GE dla
+* 		    bajtów niezerowych, SEL wybiera 0xFF dla bajtów zerowych,
+* 		  - pozostałe platformy: ~(((v & 0x7F..) + 0x7F..) | v | 0x7F..).
+* 		  Pierwszy ustawiony bit maski (ctz/clz wg endianness) wskazuje pierwszy
+* 		  zgodny bajt. Resztę (< 4 bajtów) sprawdza pętla bajtowa.
+* 		  Ścieżka USUB8/SEL nie była dotąd skompilowana ani uruchomiona, testy
+* 		  hosta sprawdzają tylko wersję ogólną. Kompilację dla Cortex-M4
+* 		  sprawdza "make armcheck" w tests/ (wymaga arm-none-eabi-g++).
+*
+* @param  pData		- dane
+* 		  length	- liczba bajtów
+* 		  value		- szukany bajt
+*
+* @retval pozycja znalezionego bajtu lub length, jeśli nie znaleziono
+*/
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::scanBytes(const uint8_t* pData, size_t length, uint8_t value) {
+	const uint32_t pattern = value * 0x01010101u;
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		uint32_t word;
+		memcpy(&word, pData + i, 4);					//Cortex-M4 pozwala na niewyrównany odczyt, kompilator robi z tego jeden LDR
+		word ^= pattern;
+#ifdef __ARM_FEATURE_SIMD32
+		(void) __usub8(word, 0x01010101u);			//wynik celowo pominięty: potrzebne są tylko flagi GE (GE[n] = bajt n != 0), które czyta __sel
+		uint32_t zeros = __sel(0, 0xFFFFFFFFu);
+#else
+		uint32_t zeros = ~(((word & 0x7F7F7F7Fu) + 0x7F7F7F7Fu) | word | 0x7F7F7F7Fu);	//0x80 tylko w bajtach zerowych (bez przeniesień między bajtami)
+#endif
+		if (zeros != 0)
+		{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+			return i + (__builtin_clz(zeros) >> 3);
+#else
+			return i + (__builtin_ctz(zeros) >> 3);
+#endif
+		}
+	}
+	for (; i < length; i++)
+		if (pData[i] == value)
+			return i;
+	return length;
+}
+
+
+/**
+* @brief  Zwraca wskaźnik do danych od tail_.
+* @note   W trybie Mirrored wszystkie dane (dataSize()) są ciągłe i mogą
+* 		  być przekazane do memchr, memcmp, std::search itp.
+* 		  W zwykłym trybie ciągłe są tylko dane do końca tablicy.
+*
+* @param  *pLength	- liczba danych ciągłych w pamięci od zwróconego wskaźnika
+*
+* @retval wskaźnik do danej w pozycji tail_
+*/
+template<typename T, size_t Size, bool Mirrored> const T* CircularBuffer<T, Size, Mirrored>::linearData(size_t* pLength) const {
+	size_t length = dataSize();
+	if (!Mirrored && tail_ + length > max_size_)
+		length = max_size_ - tail_;
+	*pLength = length;
+	return buf_ + tail_;
+}
+
+
+/**
+* @brief  Zwalnia items danych od tail_ (po ich przeczytaniu przez linearData()).
+* @note   items jest ograniczane do dataSize().
+*
+* @param  items - liczba danych do zwolnienia
+*
+* @retval n/a.
+*/
+template<typename T, size_t Size, bool Mirrored> void CircularBuffer<T, Size, Mirrored>::release(size_t items) {
+	if (items > dataSize())
+		items = dataSize();
+	if (items == 0)
+		return;
+	tail_ = position(items);
+	full_ = false;
+}
+
+
+/**
+* @brief  Rezerwuje ciągłe wolne miejsce od head_.
+* @note   Dane nie są nadpisywane, miejsce kończy się na tail_ lub na
+* 		  końcu tablicy (reszta jest dostępna po commit()).
+* 		  Przykład (UART DMA / transport):
+* 		  	T* p = reserve(n, &reserved);
+* 		  	received = receive(p, reserved);
+* 		  	commit(received);
+* 		  Między reserve() i commit() nie wolno wywoływać put()/putN().
+*
+* @param  items			- ile danych chcemy zapisać
+* 		  *pReserved	- ile danych można zapisać pod zwróconym adresem (0 gdy bufor jest pełny)
+*
+* @retval wskaźnik do miejsca zapisu
+*/
+template<typename T, size_t Size, bool Mirrored> T* CircularBuffer<T, Size, Mirrored>::reserve(size_t items, size_t* pReserved) {
+	size_t reserved = max_size_ - dataSize();
+	if (reserved > max_size_ - head_)
+		reserved = max_size_ - head_;
+	if (reserved > items)
+		reserved = items;
+	*pReserved = reserved;
+	return buf_ + head_;
+}
+
+
+/**
+* @brief  Dodaje do bufora items danych zapisanych w miejscu z reserve().
+* @note   W trybie Mirrored dane są kopiowane do drugiej połowy tablicy.
+*
+* @param  items - liczba zapisanych danych (<= *pReserved z reserve())
+*
+* @retval n/a.
+*/
+template<typename T, size_t Size, bool Mirrored> void CircularBuffer<T, Size, Mirrored>::commit(size_t items) {
+	if (items == 0)
+		return;
+	if (Mirrored)
+		memcpy(buf_ + head_ + Size, buf_ + head_, sizeof(T)*items);
+	head_ = (head_ + items) % max_size_;
+	full_ = head_ == tail_;
+}
+
+
+/**
+* @brief  Zapisuje do bufora pItems bez nadpisywania nieprzeczytanych danych.
+* @note   W odróżnieniu od put() nie ustawia overflow, dane które się nie
+* 		  zmieściły zostają u wywołującego.
+*
+* @param  *pItems	- dane
+* 		  items		- liczba danych
+*
+* @retval liczba zapisanych danych
+*/
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::putN(const T* pItems, size_t items) {
+	size_t stored = 0;
+	size_t reserved;
+
+	while (stored < items)
+	{
+		T* pDestination = reserve(items - stored, &reserved);
+		if (reserved == 0)
+			break;
+		memcpy(pDestination, pItems + stored, sizeof(T)*reserved);
+		commit(reserved);
+		stored += reserved;
+	}
+	return stored;
+}
+
+
+/**
+* @brief  Czyta z bufora do pItems maksymalnie items danych.
+*
+* @param  *pItems	- miejsce na dane
+* 		  items		- maksymalna liczba danych
+*
+* @retval liczba przeczytanych danych
+*/
+template<typename T, size_t Size, bool Mirrored> size_t CircularBuffer<T, Size, Mirrored>::getN(T* pItems, size_t items) {
+	size_t read = 0;
+	size_t length;
+
+	while (read < items)
+	{
+		const T* pSource = linearData(&length);
+		if (length == 0)
+			break;
+		if (length > items - read)
+			length = items - read;
+		memcpy(pItems + read, pSource, sizeof(T)*length);
+		release(length);
+		read += length;
+	}
+	return read;
+}
+
+
+/**
+* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
+* @note   Wyszukuje w zakresie od tail_ do head_
+*
+* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
+* 		  items 		- ilość danych typu T jaka ma być wyszukana
+* 		  range 		- zakres przeszukiwania
+* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
+* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
+* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
+* @note   n/a.
+*
+* @retval Zwraca strukturę circularBufferSearchResult o następujących polach:
+		  - isFound przyjmujących wartości:
+* 				- TRUE jeśli szukana wartośc została odnaleziona
+* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
+								nie znaleziono szukanej sekwencji
+								bufor został przepełniony i istnieje ryzyko błędnego odczytu
+		  - tail2virtualTail przyjmującą wartości:
+				- > 0 wskazującą miejsce w buforze, w którym dana sekwencja jest zlokalizowana
+
+*/
+template<typename T, size_t Size, bool Mirrored> circularBufferSearchResult CircularBuffer<T, Size, Mirrored>::SearchItem(const void *item, size_t items, bool tailPosUpdate) {
+	return SearchItemTail2Range ((const T*) item, items, dataSize(), tailPosUpdate);
+}
+
+template<typename T, size_t Size, bool Mirrored> circularBufferSearchResult CircularBuffer<T, Size, Mirrored>::SearchItem(const T *item, size_t items, bool tailPosUpdate) {
+	return SearchItemTail2Range (item, items, dataSize(), tailPosUpdate);
+}
+
+
+/**
+* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
+* @note   Wyszukuje w zakresie od tail_ do head_
+*
+* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
+* 		  items 		- ilość danych typu T jaka ma być wyszukana
+* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
+* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
+* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
+* @note   n/a.
+*
+* @retval Zwraca:
+* 				- TRUE jeśli szukana wartośc została odnaleziona
+* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
+								nie znaleziono szukanej sekwencji
+								bufor został przepełniony i istnieje ryzyko błędnego odczytu
+*/
+template<typename T, size_t Size, bool Mirrored> bool CircularBuffer<T, Size, Mirrored>::searchItem(const void *item, size_t items, bool tailPosUpdate) {
+	return searchItemTail2Range(item, items, dataSize(), tailPosUpdate);
+}
+
+
+
+
+/**
+* @brief  Sprawdza czy bufor kołowy zawiera interesujące nas dane.
+* @note   Wyszukuje w zakresie od tail_ do tail_ + range
+*
+* @param  *item 		- wskaźnik do bufora zawierającego szukane informacje
+* 		  items 		- ilość danych typu T jaka ma być wyszukana
+* 		  range 		- zakres przeszukiwania
+* 		  tailPosUpdate - informuje obiekt czy po znalezieniu szykanej wartości ustawić na nią tail_
+* 		  					TRUE - wartośc domyśla oznacza, że tail_ powinien być uaktualniony
+* 		  					FALSE - oznacza, że tail_ nie powinien być uaktualniony
+* @note   n/a.
+*
+* @retval Zwraca:
+* 				- TRUE jeśli szukana wartośc została odnaleziona
+* 				- FALSE jeśli: 	szukany ciąg nazków jest dłuższy niż dane w buforze lub
+								nie znaleziono szukanej sekwencji
+								bufor został przepełniony i istnieje ryzyko błędnego odczytu
+*/
+template<typename T, size_t Size, bool Mirrored> bool CircularBuffer<T, Size, Mirrored>::searchItemTail2Range(const void *item, size_t items, size_t range, bool tailPosUpdate) {
+	return SearchItemTail2Range((const T*) item, items, range, tailPosUpdate).isFound;
+}
+
+#endif
+/* CIRCULARBUFFER_H_ */
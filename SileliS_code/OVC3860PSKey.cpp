@@ -1,341 +1,422 @@
-/**
-  ******************************************************************************
-  * @file    OVC3860PSKey.cpp
-  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
-  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
-  * @brief   OVC3860 PSKey manage class
-  *          This file provides code to manage OVC3860 PSKeys.
-  *          It is written in C++ and SMT32 HAL.
-  *          To write this module author uses helpful informations from:
-  *          		- OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  *          		- https://github.com/tomaskovacik/OVC3860
-					- https://github.com/rigelinorion/OVC3860-MemoryMap
-  *
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
-  * All rights reserved.</center></h2>
-  *
-  *For education and private projects:
-  * This software component is licensed by GNU Public Licence, * the "License" *;
-  * You to copy this scope of file to give informations about copyright to future
-  * commercial / open source projects.
-  *
-  *To use this library for commercial and open source projects please contact with
-  *To  author to agree the terms of use.
-  ******************************************************************************
-  */
-
-#include "OVC3860PSKey.h"
-
-/**
-  * @brief Object constructor.
-  * @note  Constructs object, set hardware properties, clead buffers.
-  *
-  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
-  *               the configuration information for the specified UART module.
-  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
-  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
-  * @retval n/a
-  */
-OVC3860PSKey::OVC3860PSKey(UART_HandleTypeDef* huart  /*block mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin)
-			 :OVC3860HardWare(huart  /*in DMA mode*/, ResetGPIOx, GPIO_Pin)
-{
-	_cleanReceiveDataArray();
-	_cleanCommandDataArray();
-}
-
-/**
-  * @brief Object destructor.
-  * @note  n/a
-  *
-  * @param  n/a
-  * @retval n/a
-  */
-OVC3860PSKey::~OVC3860PSKey(){
-
-}
-
-/**
-  * @brief send command (read / write / quit) to OVC
-  * @note  Command is build with appropriate method buildReadCommand/
-  * 		buildWriteCommand.
-  * 		Command is sent in blocking mode.
-  *
-  * @param  pAddress pointer to command array.
-  * @param  Size amount of data to be send (mostly OVC header length for reading
-  * 		 + additional data if writing
-  * @retval true is UART gives 'HAL_OK'.
-  */
-bool OVC3860PSKey::sendRawData(uint8_t * pAddress, uint16_t Size){
-	_cleanReceiveDataArray();
-	if (HAL_UART_Transmit(OVC_huart, pAddress, Size, HAL_MAX_DELAY)==HAL_OK)
-		return true;
-	else
-		return false;
-}
-
-
-/**
-  * @brief receive data from OVC which are answer to (read / write
-  * 		/ quit)
-  * @note  Command is build with appropriate method buildReadCommand/
-  * 		buildWriteCommand.
-  * 		Command is sent in blocking mode.
-  *
-  * @param  pAddress pointer to command array.
-  * @param  Size amount of data to be send (mostly OVC header length for reading
-  * 		 + additional data if writing
-  * @retval true is UART gives 'HAL_OK'.
-  */
-void OVC3860PSKey::receiveRawData(uint16_t Size, uint32_t Timeout){
-	HAL_UART_Receive(OVC_huart, receiveDataArry, Size, Timeout);
-}
-
-/**
-  * @brief build PSkey read mode command header and send
-  * 		it to OVC3860
-  * @note  sending 4 bytes because this is the length of
-  * 		read command header
-  *
-  * @param  type - PSKey mode command type
-  * @param  address - PSkey address it was counted based
-  * 		 on PSkeys numbers and its data Range(byte) -
-  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  *
-  * 		 also You can give this number from OVC3860_memmap
-  * 		 file uploaded on Github
-  * @param  data2readLenght - amount of data to read, pls
-  * 		 take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  * 		 for Range(byte)
-  * @retval	true if data had been send correctly
-  */
-bool OVC3860PSKey::buildReadCommand(uint8_t type, uint16_t address, uint16_t data2readLenght){
-	_cleanCommandDataArray();
-	//build command header
-	commandDataArry[0]=type<<4;
-	commandDataArry[0]= commandDataArry[0] | (uint8_t) (address >>8);
-	commandDataArry[1]= (uint8_t) (address & 0b11111111);
-	commandDataArry[2]= (uint8_t) (data2readLenght>>8);
-	commandDataArry[3]= (uint8_t) (data2readLenght & 0b11111111);
-	//send command
-	return sendRawData(commandDataArry, 4);			//lenght of 4 because it is only read mode
-}
-
-
-/**
-  * @brief	build PSkey write mode command header and send
-  * 		it to OVC3860
-  * @note	sending 4 bytes +  data2writeLenght because whole
-  * 		 command is header + data
-  *
-  * @param	type - PSKey mode command type
-  * @param	address - PSkey address it was counted based
-  * 		 on PSkeys numbers and its data Range(byte) -
-  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  *
-  * 		 also You can give this number from OVC3860_memmap
-  * 		 file uploaded on Github
-  * @param	data2write - array with data that should be written in
-  * 		 module
-  * @param	data2writeLenght - "data2write" length. The max value
-  * 		 of written data is given in OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  * 		  in Range(byte) for each PSKey.
-  * @retval	true if data had been send correctly
-  */
-bool OVC3860PSKey::buildWriteCommand(uint8_t type, uint16_t address, const void* data2write, uint16_t data2writeLenght){
-	_cleanCommandDataArray();
-	//build command header
-	commandDataArry[0]=type<<4;
-	commandDataArry[0]= commandDataArry[0] | (uint8_t) (address >>8);
-	commandDataArry[1]= (uint8_t) (address & 0b11111111);
-	commandDataArry[2]= (uint8_t) (data2writeLenght>>8);
-	commandDataArry[3]= (uint8_t) (data2writeLenght & 0b11111111);
-	//copy data which have to be written to OVC3860
-	memcpy(&commandDataArry[4], data2write, data2writeLenght);
-	return sendRawData(commandDataArry, data2writeLenght+4);	//lenght of 4 + data2writeLenght because it is sends header + data to write
-}
-
-
-/**
-  * @brief	Read data from OVC3860
-  * @note	Send read command to OVC3860 and recives answer.
-  * 		 Check if answer is correct for particular type
-  * 		  of command
-  *
-  * @param 	 address - PSkey address it was counted based
-  * 		 on PSkeys numbers and its data Range(byte) -
-  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  *
-  * 		 also You can give this number from OVC3860_memmap
-  * 		 file uploaded on Github
-  * @param  data2readLenght - amount of data to read, pls
-  * 		 take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  * 		 for Range(byte).
-  * @retval	true if data had been send correctly and answer is correct.
-  */
-bool OVC3860PSKey::readDataFromOVC(uint16_t address, uint16_t data2readLenght){
-	bool retVAL = buildReadCommand(CommandType.read, address, data2readLenght);
-	receiveRawData(data2readLenght+4, 200);					//4 bytes is message header + data2readLenght
-	if ((receiveDataArry[0]>>4) ==CommandType.readACK)
-		return retVAL;
-	return false;
-}
-
-
-/**
-  * @brief	write data from OVC3860
-  * @note	Send write command to OVC3860 and recives answer.
-  * 		 Check if answer is correct for particular type
-  * 		  of command
-  *
-  * @param 	 address - PSkey address it was counted based
-  * 		 on PSkeys numbers and its data Range(byte) -
-  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  *
-  * 		 also You can give this number from OVC3860_memmap
-  * 		 file uploaded on Github
-  * @param 	 data2write - information that should be written.
-  * @param  data2writeLenght - amount of data to write, pls
-  * 		 take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
-  * 		 for Range(byte).
-  * @retval	true if data to write had been send correctly and
-  * 		 answer is correct.
-  */
-bool OVC3860PSKey::writeData2OVC(uint16_t address, const char* data2write, uint16_t data2writeLenght){
-		bool retVAL = buildWriteCommand(CommandType.wrtite, address, (void*) data2write, data2writeLenght);
-		receiveRawData(4, 200);
-		if ((receiveDataArry[0]>>4) ==CommandType.wrtiteACK)
-				return retVAL;
-			return false;
-}
-
-/**
-  * @brief	Clean receive data array.
-  * @note	Set value at '\0' which in some cases it
-  * 		 character that point OVC3860 value
-  * 		  termination mark
-  *
-  * @param	n/a
-  * @retval n/a
-  */
-void OVC3860PSKey::_cleanReceiveDataArray(){
-	memset(&receiveDataArry, '\0', receiveDataArry_lenght);
-}
-
-/**
-  * @brief	Clean command data array.
-  * @note	Set value at '\0' which in some cases it
-  * 		 character that point OVC3860 value
-  * 		  termination mark
-  *
-  * @param	n/a
-  * @retval n/a
-  */
-void OVC3860PSKey::_cleanCommandDataArray(){
-	memset(&commandDataArry, '\0', receiveDataArry_lenght);
-}
-
-/**
-  * @brief	Enter OVC3860 into PSKey configuration
-  * 		 mode by sending appropriate command.
-  * @note	It is importand to send enterConfig
-  * 		 before module send '\r\n' sequence of
-  * 		  welcome message.
-  * 		Normally welcome message is {0x04, 0x0F,
-  * 		 0x04, 0x00, 0x01, 0x00, 0x00, '\r',
-  * 		 '\n'} but to enter configuration mode
-  * 		 You have to do this before '\r\n'.
-  *
-  * @param	n/a
-  * @retval	true - if config mode had been entered
-  */
-bool OVC3860PSKey::enterConfigMode(){
-	struct {
-		uint8_t const welcome[7] 			= {0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00};
-		uint8_t const enterConfig[9] 		= {0xC5, 0xC7, 0xC7, 0xC9, 0xD0, 0xD7, 0xC9, 0xD1, 0xCD};
-		uint8_t const enterConfigACK[7]		= {0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00};
-	} const Message;
-
-	resetModule();
-
-	receiveRawData(7); 		//this should be executed ASAP after reset line goes high
-	if (memcmp(&receiveDataArry,&Message.welcome, 7)==0)
-	{
-		sendRawData((uint8_t*) &Message.enterConfig, 9);		//to enter config mode appropriate message should be sent
-		receiveRawData(7);
-
-		if (memcmp(&receiveDataArry,&Message.enterConfigACK, 7)==0){		//check for module answer
-			return true;													//config message enabled
-		}
-	}
-		return false;														//problem with config message enabling
-}
-
-/**
-  * @brief	quit configuration mode.
-  * @note	After quitting it's better to reset
-  * 		 module.
-  *
-  * @param	n/a
-  * @retval	true - if quited config mode.
-  */
-bool OVC3860PSKey::quitConfigMode(){
-	if (buildReadCommand(CommandType.quitConfigMode, 0x0, 0x0))				//quit config mode command if 0x5 0x0 0x0 0x0
-	{
-		receiveRawData(4);
-		if ((receiveDataArry[0]>>4) == CommandType.quitConfigModeACK)
-			return true;
-	}
-	return false;
-}
-
-/**
-  * @brief	read Bluetooth name with which other devices
-  * 		 detects OVC3860.
-  * @note	Name is stored in receiveDataArry at position [0].
-  * 		returned value is length of name.
-  * 		data2readLength is fixed at 16, because acc. to
-  * 		OVC3860_RevE_PSKeys_Setting_v1.2.pdf for localname
-  * 		it is max length.
-  *
-  * 		OVC3860 detects the end of name as '\0' mark so answer:
-  * 		'N','A','M','E','_','1','\0','g,'a','r','b','a','g','e'
-  * 		means that OVC mane is "NAME_1".
-  *
-  * 		I do not check what will happen if name is full 16 bytes without '\0'.
-  *
-  * @param	n/a
-  * @retval length - of name. The read NAME itself is stored in receiveDataArry starting with position 0
-  */
-uint8_t OVC3860PSKey::readBtName(){
-	if (readDataFromOVC(OVC3860_PSKEY_ADDR_NAME, 16))
-		{
-		memmove(receiveDataArry, receiveDataArry+4, 16);
-
-		uint8_t i =0;
-		do
-		{
-			i++;
-		}while(receiveDataArry[i]!= '\0' && i < 16);
-
-		return i;			//return lenght of name, name is stored in receiveDataArry
-		}
-}
-
-
-/**
-  * @brief	Write / change name of OVC3860 which will be
-  * 		 broadcasted to other devices.
-  * @note	Commans have length of 16 (max length of this type of command).
-  * 		The name array should be ended with '\0' which means the end of name.
-  *
-  * 		I do not check what will happen if name is full 16 bytes without '\0'.
-  *
-  * @param	name - pointer to char array fith name i.e. xxx.writeBtName("Name_1");
-  * @retval	true - if write command was executed correctly.
-  */
-bool 	OVC3860PSKey::writeBtName(const char* name){
-		return writeData2OVC(OVC3860_PSKEY_ADDR_NAME, name,  16);
-}
+/**
+  ******************************************************************************
+  * @file    OVC3860PSKey.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 PSKey manage class
+  *          This file provides code to manage OVC3860 PSKeys.
+  *          It is written in C++ and SMT32 HAL.
+  *          To write this module author uses helpful informations from:
+  *          		- OVC3860_RevE_PSKeys_Setting_v1.2.pdf
+  *          		- https://github.com/tomaskovacik/OVC3860
+					- https://github.com/rigelinorion/OVC3860-MemoryMap
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+  */
+
+#include "OVC3860PSKey.h"
+#include <string.h>
+
+/**
+  * @brief Object constructor.
+  * @note  Constructs object, set hardware properties, clead buffers.
+  *
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
+  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
+  * @retval n/a
+  */
+#ifdef OVC3860_TRANSPORT_STM32HAL
+OVC3860PSKey::OVC3860PSKey(UART_HandleTypeDef* huart  /*block mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin)
+			 :OVC3860HardWare(huart  /*in DMA mode*/, ResetGPIOx, GPIO_Pin)
+{
+	_cleanReceiveDataArray();
+}
+#endif
+
+/**
+  * @brief Object constructor.
+  * @note  Transport independent version, i.e. for POSIX
+  * 		serial port or loopback.
+  *
+  * @param  Transport - transport object (handle), it is copied
+  * @retval n/a
+  */
+OVC3860PSKey::OVC3860PSKey(const OVC3860Transport& Transport)
+			 :OVC3860HardWare(Transport)
+{
+	_cleanReceiveDataArray();
+}
+
+/**
+  * @brief Object destructor.
+  * @note  n/a
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+OVC3860PSKey::~OVC3860PSKey(){
+
+}
+
+/**
+  * @brief send command (read / write / quit) to OVC
+  * @note  Command is sent in blocking mode. Header and
+  * 		write data are sent by separate calls, so data
+  * 		are taken directly from caller memory.
+  *
+  * @param  pAddress pointer to data to send.
+  * @param  Size amount of data to be send
+  * @retval true if transport sent all data.
+  */
+bool OVC3860PSKey::sendRawData(const uint8_t* pAddress, uint16_t Size){
+	return transport.transmitBlocking(pAddress, Size, OVC3860_TransportMaxDelay);
+}
+
+
+/**
+  * @brief receive data from OVC which are answer to (read / write
+  * 		/ quit)
+  * @note  Received in blocking mode.
+  *
+  * @param  pAddress - destination, at least Size long
+  * @param  Size amount of data to be received
+  * @param  Timeout - ms
+  * @retval true if transport received all data.
+  */
+bool OVC3860PSKey::receiveRawData(uint8_t* pAddress, uint16_t Size, uint32_t Timeout){
+	return transport.receiveBlocking(pAddress, Size, Timeout);
+}
+
+bool OVC3860PSKey::receiveRawData(uint16_t Size, uint32_t Timeout){
+	return receiveRawData(receiveDataArry, Size, Timeout);
+}
+
+/**
+  * @brief build PSKey command header (read / write / quit)
+  * 		and send it to OVC3860
+  * @note  Header is 4 bytes: type<<4 | address[11:8],
+  * 		address[7:0], length[15:8], length[7:0].
+  * 		Data of write command are sent separately
+  * 		by sendRawData().
+  * 		Access which does not fit below
+  * 		 OVC3860_PSKeyMaxAddress is not sent, its address
+  * 		 would overwrite type bits or wrap around.
+  *
+  * @param  type - PSKey mode command type
+  * @param  address - PSkey address it was counted based
+  * 		 on PSkeys numbers and its data Range(byte) -
+  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
+  *
+  * 		 also You can give this number from OVC3860_memmap
+  * 		 file uploaded on Github
+  * @param  dataLenght - amount of data to read / write (max.
+  * 		 OVC3860_PSKeyMaxPayload), 0 for quit
+  * @retval	true if header had been send correctly
+  */
+bool OVC3860PSKey::sendCommandHeader(uint8_t type, uint16_t address, uint16_t dataLenght){
+	uint8_t header[OVC3860_PSKeyHeaderLength];
+
+	if ((uint32_t) address + dataLenght > OVC3860_PSKeyMaxAddress)
+		return false;
+	header[0] = (uint8_t) (type<<4) | (uint8_t) (address >>8);
+	header[1] = (uint8_t) (address & 0b11111111);
+	header[2] = (uint8_t) (dataLenght>>8);
+	header[3] = (uint8_t) (dataLenght & 0b11111111);
+	return sendRawData(header, OVC3860_PSKeyHeaderLength);
+}
+
+/**
+  * @brief	Read one PSKey frame.
+  * @note	Answer header is checked, payload is received
+  * 		 directly to pData.
+  *
+  * @param	address - PSKey address of the first byte
+  * @param	pData - destination, at least length long
+  * @param	length - max. OVC3860_PSKeyMaxPayload
+  * @retval	true if answer is correct.
+  */
+bool OVC3860PSKey::readFrame(uint16_t address, uint8_t* pData, uint16_t length){
+	uint8_t header[OVC3860_PSKeyHeaderLength];
+
+	if (!sendCommandHeader(CommandType.read, address, length))
+		return false;
+	if (!receiveRawData(header, OVC3860_PSKeyHeaderLength, OVC3860_PSKeyReplyTimeout))
+		return false;
+	if ((header[0]>>4) != CommandType.readACK)
+		return false;
+	return receiveRawData(pData, length, OVC3860_PSKeyReplyTimeout);
+}
+
+/**
+  * @brief	Write one PSKey frame.
+  *
+  * @param	address - PSKey address of the first byte
+  * @param	pData - data to write, sent directly from caller memory
+  * @param	length - max. OVC3860_PSKeyMaxPayload
+  * @retval	true if write was acknowledged.
+  */
+bool OVC3860PSKey::writeFrame(uint16_t address, const uint8_t* pData, uint16_t length){
+	uint8_t header[OVC3860_PSKeyHeaderLength];
+
+	if (!sendCommandHeader(CommandType.wrtite, address, length) || !sendRawData(pData, length))
+		return false;
+	if (!receiveRawData(header, OVC3860_PSKeyHeaderLength, OVC3860_PSKeyReplyTimeout))
+		return false;
+	return (header[0]>>4) == CommandType.wrtiteACK;
+}
+
+/**
+  * @brief	Read PSKeys of any length.
+  * @note	Data are split into frames of max.
+  * 		 OVC3860_PSKeyMaxPayload bytes, each frame
+  * 		 is written directly to pData. Module has to be
+  * 		 in config mode (enterConfigMode()).
+  *
+  * @param	address - PSKey address of the first byte, see
+  * 		 OVC3860_RevE_PSKeys_Setting_v1.2.pdf or PSkeys_xxx
+  * @param	pData - destination, at least length long
+  * @param	length - number of bytes to read
+  * @retval	true if all frames had been read correctly, false
+  * 		 if address + length is above OVC3860_PSKeyMaxAddress
+  * 		 (nothing is read).
+  */
+bool OVC3860PSKey::readPSKey(uint16_t address, uint8_t* pData, size_t length){
+	if (length > OVC3860_PSKeyMaxAddress || address > OVC3860_PSKeyMaxAddress - length)
+		return false;
+	while (length > 0)
+	{
+		uint16_t frameLength = (length > OVC3860_PSKeyMaxPayload) ? OVC3860_PSKeyMaxPayload : (uint16_t) length;
+		if (!readFrame(address, pData, frameLength))
+			return false;
+		address += frameLength;
+		pData += frameLength;
+		length -= frameLength;
+	}
+	return true;
+}
+
+/**
+  * @brief	Write PSKeys of any length.
+  * @note	Data are split into frames of max.
+  * 		 OVC3860_PSKeyMaxPayload bytes. Module has to be
+  * 		 in config mode (enterConfigMode()).
+  *
+  * @param	address - PSKey address of the first byte
+  * @param	pData - data to write
+  * @param	length - number of bytes to write
+  * @retval	true if all frames had been acknowledged, false
+  * 		 if address + length is above OVC3860_PSKeyMaxAddress
+  * 		 (nothing is written).
+  */
+bool OVC3860PSKey::writePSKey(uint16_t address, const uint8_t* pData, size_t length){
+	if (length > OVC3860_PSKeyMaxAddress || address > OVC3860_PSKeyMaxAddress - length)
+		return false;
+	while (length > 0)
+	{
+		uint16_t frameLength = (length > OVC3860_PSKeyMaxPayload) ? OVC3860_PSKeyMaxPayload : (uint16_t) length;
+		if (!writeFrame(address, pData, frameLength))
+			return false;
+		address += frameLength;
+		pData += frameLength;
+		length -= frameLength;
+	}
+	return true;
+}
+
+
+/**
+  * @brief	Read data from OVC3860
+  * @note	Send read command to OVC3860 and recives answer.
+  * 		 Check if answer is correct for particular type
+  * 		  of command.
+  * 		Data are stored in receiveDataArry starting with
+  * 		 position OVC3860_PSKeyHeaderLength (as before),
+  * 		 use readPSKey() to read to own buffer.
+  *
+  * @param 	 address - PSkey address it was counted based
+  * 		 on PSkeys numbers and its data Range(byte) -
+  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
+  *
+  * 		 also You can give this number from OVC3860_memmap
+  * 		 file uploaded on Github
+  * @param  data2readLenght - amount of data to read, max.
+  * 		 OVC3860_PSKeyMaxPayload.
+  * @retval	true if data had been send correctly and answer is correct.
+  */
+bool OVC3860PSKey::readDataFromOVC(uint16_t address, uint16_t data2readLenght){
+	if (data2readLenght > OVC3860_PSKeyMaxPayload)
+		return false;												//receiveDataArry would be overrun
+	return readFrame(address, receiveDataArry + OVC3860_PSKeyHeaderLength, data2readLenght);
+}
+
+
+/**
+  * @brief	write data from OVC3860
+  * @note	Send write command to OVC3860 and recives answer.
+  * 		 Check if answer is correct for particular type
+  * 		  of command
+  *
+  * @param 	 address - PSkey address it was counted based
+  * 		 on PSkeys numbers and its data Range(byte) -
+  * 		 pls take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
+  *
+  * 		 also You can give this number from OVC3860_memmap
+  * 		 file uploaded on Github
+  * @param 	 data2write - information that should be written.
+  * @param  data2writeLenght - amount of data to write, pls
+  * 		 take a look at OVC3860_RevE_PSKeys_Setting_v1.2.pdf
+  * 		 for Range(byte). Longer data are split into frames.
+  * @retval	true if data to write had been send correctly and
+  * 		 answer is correct.
+  */
+bool OVC3860PSKey::writeData2OVC(uint16_t address, const char* data2write, uint16_t data2writeLenght){
+	return writePSKey(address, (const uint8_t*) data2write, data2writeLenght);
+}
+
+/**
+  * @brief	Clean receive data array.
+  * @note	Set value at '\0' which in some cases it
+  * 		 character that point OVC3860 value
+  * 		  termination mark.
+  * 		Done once in constructor, not before every command.
+  *
+  * @param	n/a
+  * @retval n/a
+  */
+void OVC3860PSKey::_cleanReceiveDataArray(){
+	memset(&receiveDataArry, '\0', receiveDataArry_lenght);
+}
+
+/**
+  * @brief	Enter OVC3860 into PSKey configuration
+  * 		 mode by sending appropriate command.
+  * @note	It is importand to send enterConfig
+  * 		 before module send '\r\n' sequence of
+  * 		  welcome message.
+  * 		Normally welcome message is {0x04, 0x0F,
+  * 		 0x04, 0x00, 0x01, 0x00, 0x00, '\r',
+  * 		 '\n'} but to enter configuration mode
+  * 		 You have to do this before '\r\n'.
+  * 		Takes reset pulse width (setResetPulseWidth())
+  * 		 plus real boot time of module, welcome message
+  * 		 is awaited max. OVC3860_ResetReadyTimeout, ACK
+  * 		 max. OVC3860_PSKeyReplyTimeout.
+  *
+  * @param	n/a
+  * @retval	true - if config mode had been entered
+  */
+bool OVC3860PSKey::enterConfigMode(){
+	struct {
+		uint8_t const welcome[7] 			= {0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00};
+		uint8_t const enterConfig[9] 		= {0xC5, 0xC7, 0xC7, 0xC9, 0xD0, 0xD7, 0xC9, 0xD1, 0xCD};
+		uint8_t const enterConfigACK[7]		= {0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00};
+	} const Message;
+
+	resetModule();
+
+	//this should be executed ASAP after reset line goes high, returns as soon as module is ready
+	if (receiveRawData(7, OVC3860_ResetReadyTimeout) && memcmp(&receiveDataArry,&Message.welcome, 7)==0)
+	{
+		moduleReady();
+		sendRawData((uint8_t*) &Message.enterConfig, 9);		//to enter config mode appropriate message should be sent
+
+		if (receiveRawData(7, OVC3860_PSKeyReplyTimeout) && memcmp(&receiveDataArry,&Message.enterConfigACK, 7)==0){		//check for module answer
+			return true;													//config message enabled
+		}
+	}
+		return false;														//problem with config message enabling
+}
+
+/**
+  * @brief	quit configuration mode.
+  * @note	After quitting it's better to reset
+  * 		 module.
+  * 		ACK is awaited max. OVC3860_PSKeyReplyTimeout.
+  *
+  * @param	n/a
+  * @retval	true - if quited config mode.
+  */
+bool OVC3860PSKey::quitConfigMode(){
+	if (sendCommandHeader(CommandType.quitConfigMode, 0x0, 0x0))				//quit config mode command if 0x5 0x0 0x0 0x0
+	{
+		if (receiveRawData(OVC3860_PSKeyHeaderLength, OVC3860_PSKeyReplyTimeout) && (receiveDataArry[0]>>4) == CommandType.quitConfigModeACK)
+			return true;
+	}
+	return false;
+}
+
+/**
+  * @brief	read Bluetooth name with which other devices
+  * 		 detects OVC3860.
+  * @note	data2readLength is fixed at OVC3860_PSKeyNameLength
+  * 		 (16), because acc. to OVC3860_RevE_PSKeys_Setting_v1.2.pdf
+  * 		 for localname it is max length.
+  *
+  * 		OVC3860 detects the end of name as '\0' mark so answer:
+  * 		'N','A','M','E','_','1','\0','g,'a','r','b','a','g','e'
+  * 		means that OVC mane is "NAME_1".
+  *
+  * 		Name is read directly to pName and always ended
+  * 		 with '\0', full 16 bytes name needs 17 bytes pName.
+  *
+  * @param	pName - destination
+  * @param	maxLength - size of pName
+  * @retval length - of name, 0 if name could not be read
+  */
+size_t OVC3860PSKey::readBtName(char* pName, size_t maxLength){
+	if (pName == 0 || maxLength == 0)
+		return 0;
+	size_t readLength = (maxLength - 1 < OVC3860_PSKeyNameLength) ? maxLength - 1 : OVC3860_PSKeyNameLength;
+
+	pName[0] = '\0';
+	if (!readPSKey(OVC3860_PSKEY_ADDR_NAME, (uint8_t*) pName, readLength))
+		return 0;
+	pName[readLength] = '\0';
+	return strlen(pName);
+}
+
+/**
+  * @brief	read Bluetooth name with which other devices
+  * 		 detects OVC3860.
+  * @note	Name is stored in receiveDataArry at position [0],
+  * 		 ended with '\0'.
+  *
+  * @param	n/a
+  * @retval length - of name, 0 if name could not be read
+  */
+uint8_t OVC3860PSKey::readBtName(){
+	return (uint8_t) readBtName((char*) receiveDataArry, OVC3860_PSKeyNameLength + 1);
+}
+
+
+/**
+  * @brief	Write / change name of OVC3860 which will be
+  * 		 broadcasted to other devices.
+  * @note	Commans have length of 16 (max length of this type of command).
+  * 		The name is padded with '\0' which means the end of name,
+  * 		 longer name is cut to 16 characters.
+  *
+  * @param	name - pointer to char array fith name i.e. xxx.writeBtName("Name_1");
+  * @retval	true - if write command was executed correctly.
+  */
+bool 	OVC3860PSKey::writeBtName(const char* name){
+	char paddedName[OVC3860_PSKeyNameLength] = {0};
+
+	memcpy(paddedName, name, strnlen(name, OVC3860_PSKeyNameLength));		//name literal may be shorter than 16 bytes
+	return writePSKey(OVC3860_PSKEY_ADDR_NAME, (const uint8_t*) paddedName, OVC3860_PSKeyNameLength);
+}
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_CodecTelemetry.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 audio codec telemetry class.
+  *          This file provides code to record OVC3860 codec history
+  *          (AA1/AA2/AA4/AA8, AE, AF, AS indications).
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_CodecTelemetry.h"
+
+/**
+  * @brief	Object constructor
+  * @note	n/a
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860CodecTelemetry::OVC3860CodecTelemetry(void){
+	resetTelemetry();
+}
+
+/**
+  * @brief	Clear history, session data and counters.
+  * @note	n/a
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860CodecTelemetry::resetTelemetry(void){
+	history.resetCircularBuffer();
+	lostEvents = 0;
+	rate = RateNone;
+	sessionOpen = false;
+	sessionStart = 0;
+	sessionEnd = 0;
+	rateStart = 0;
+	memset(timeInRate, 0, sizeof(timeInRate));
+	sessionCount = 0;
+	rateSwitchCount = 0;
+	configErrorCount = 0;
+}
+
+/**
+  * @brief	Codec reports new sample rate (AA1/AA2/AA4/AA8)
+  * 		 or phone call mode (AS).
+  * @note	If codec was closed new session is started and
+  * 		 session counters are cleared.
+  * 		Repeated indication of the same rate is not
+  * 		 treated as a switch.
+  *
+  * @param	newRate - codec mode reported by OVC3860
+  * @param	timeStamp - time of indication in ms
+  * @retval	n/a
+  */
+void OVC3860CodecTelemetry::sampleRateSet(codecRate newRate, uint32_t timeStamp){
+	if (!sessionOpen)
+	{
+		sessionOpen = true;
+		sessionStart = timeStamp;
+		sessionEnd = timeStamp;
+		memset(timeInRate, 0, sizeof(timeInRate));
+		rateSwitchCount = 0;
+		configErrorCount = 0;
+		sessionCount++;
+		rate = newRate;
+		rateStart = timeStamp;
+		addEvent(CodecOpen, timeStamp);
+	}
+	else if (newRate != rate)
+	{
+		closeRatePeriod(timeStamp);
+		rateSwitchCount++;
+		rate = newRate;
+		rateStart = timeStamp;
+		addEvent(SampleRateSwitch, timeStamp);
+	}
+}
+
+/**
+  * @brief	Codec reports that it is closed (AF).
+  * @note	Closes current session. Session data stay
+  * 		 available until next codec opening.
+  *
+  * @param	timeStamp - time of indication in ms
+  * @retval	n/a
+  */
+void OVC3860CodecTelemetry::codecClosed(uint32_t timeStamp){
+	if (sessionOpen)
+	{
+		closeRatePeriod(timeStamp);
+		sessionOpen = false;
+		sessionEnd = timeStamp;
+		rate = RateNone;
+		addEvent(CodecClose, timeStamp);
+	}
+}
+
+/**
+  * @brief	Codec reports config error (AE).
+  * @note	n/a
+  *
+  * @param	timeStamp - time of indication in ms
+  * @retval	n/a
+  */
+void OVC3860CodecTelemetry::configError(uint32_t timeStamp){
+	configErrorCount++;
+	addEvent(ConfigError, timeStamp);
+}
+
+/**
+  * @brief	Add time spent in current rate to closed
+  * 		 periods table.
+  * @note	n/a
+  *
+  * @param	timeStamp - end of the period in ms
+  * @retval	n/a
+  */
+void OVC3860CodecTelemetry::closeRatePeriod(uint32_t timeStamp){
+	timeInRate[rate] += timeStamp - rateStart;
+	rateStart = timeStamp;
+}
+
+/**
+  * @brief	Store event in history.
+  * @note	If history is full the oldest event is
+  * 		 overwritten and counted as lost.
+  *
+  * @param	type - event type
+  * @param	timeStamp - time of event in ms
+  * @retval	n/a
+  */
+void OVC3860CodecTelemetry::addEvent(codecEventType type, uint32_t timeStamp){
+	codecEvent event;
+	event.timeStamp = timeStamp;
+	event.type = type;
+	event.rate = rate;
+
+	if (history.isFull())
+	{
+		history.get();					//drop the oldest one, buffer overflow flag is not needed here
+		lostEvents++;
+	}
+	history.put(event);
+}
+
+/**
+  * @brief	Check if there is not read event in history.
+  * @retval	true - if getEvent() returns valid event
+  */
+bool OVC3860CodecTelemetry::isEventAvailable(void) const{
+	return !history.isEmpty();
+}
+
+/**
+  * @brief	Read the oldest not read event.
+  * @note	Check isEventAvailable() first.
+  *
+  * @retval	codecEvent struct
+  */
+OVC3860CodecTelemetry::codecEvent OVC3860CodecTelemetry::getEvent(void){
+	return history.get();
+}
+
+/**
+  * @brief	Number of events overwritten because application
+  * 		 did not read history on time.
+  */
+uint32_t OVC3860CodecTelemetry::getLostEvents(void) const{
+	return lostEvents;
+}
+
+/**
+  * @brief	Codec mode currently active.
+  */
+OVC3860CodecTelemetry::codecRate OVC3860CodecTelemetry::getRate(void) const{
+	return rate;
+}
+
+/**
+  * @brief	Check if codec is opened.
+  */
+bool OVC3860CodecTelemetry::isSessionOpen(void) const{
+	return sessionOpen;
+}
+
+/**
+  * @brief	Time spent in given rate during current session
+  * 		 (or last one if codec is closed).
+  * @note	n/a
+  *
+  * @param	rateToCheck - codec mode
+  * @param	timeStamp - actual time in ms, used to count still
+  * 		 open period
+  * @retval	time in ms
+  */
+uint32_t OVC3860CodecTelemetry::getTimeInRate(codecRate rateToCheck, uint32_t timeStamp) const{
+	uint32_t time = timeInRate[rateToCheck];
+	if (sessionOpen && rateToCheck == rate)
+		time += timeStamp - rateStart;
+	return time;
+}
+
+/**
+  * @brief	Duration of current session (or last one if
+  * 		 codec is closed).
+  * @note	n/a
+  *
+  * @param	timeStamp - actual time in ms
+  * @retval	time in ms
+  */
+uint32_t OVC3860CodecTelemetry::getSessionTime(uint32_t timeStamp) const{
+	if (sessionOpen)
+		return timeStamp - sessionStart;
+	return sessionEnd - sessionStart;
+}
+
+/**
+  * @brief	Number of codec sessions since telemetry reset.
+  */
+uint32_t OVC3860CodecTelemetry::getSessionCount(void) const{
+	return sessionCount;
+}
+
+/**
+  * @brief	Number of rate switches in current / last session.
+  */
+uint32_t OVC3860CodecTelemetry::getRateSwitchCount(void) const{
+	return rateSwitchCount;
+}
+
+/**
+  * @brief	Number of AE indications in current / last session.
+  */
+uint32_t OVC3860CodecTelemetry::getConfigErrorCount(void) const{
+	return configErrorCount;
+}
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_CodecTelemetry.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 audio codec telemetry class.
+  *          This file provides code to record OVC3860 codec history
+  *          (AA1/AA2/AA4/AA8, AE, AF, AS indications).
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_CODECTELEMETRY_H_
+#define OVC3860_CODECTELEMETRY_H_
+
+#include <stdint.h>
+#include "CircularBuffer.h"
+
+#define	OVC3860_CodecHistorySize	16		//defines how many codec events are remembered until application reads them
+
+
+/*
+ * OVC3860CodecTelemetry is class to record audio codec history.
+ * It is fed by OVC3860::decodeReceivedString(void) with codec
+ *  indications and time stamps (ms) and computes how long the
+ *  codec stayed in each sample rate during current session.
+ *
+ * Session starts when codec is opened (first AAx or AS after AF)
+ *  and ends with AF (codec closed) indication.
+ */
+class OVC3860CodecTelemetry{
+public:
+	OVC3860CodecTelemetry(void);
+
+	//codec modes reported by OVC3860
+	enum codecRate
+	{
+		RateNone,				//codec closed or not yet reported
+		Rate_48000,				//AA1
+		Rate_44100,				//AA2
+		Rate_32000,				//AA4
+		Rate_16000,				//AA8
+		RatePhoneCall,			//AS
+		codecRate_count
+	};
+
+	//events stored in history
+	enum codecEventType
+	{
+		SampleRateSwitch,		//AAx or AS when codec is already opened
+		CodecOpen,				//AAx or AS when codec was closed
+		CodecClose,				//AF
+		ConfigError				//AE
+	};
+
+	struct codecEvent
+	{
+		uint32_t		timeStamp;	//ms
+		codecEventType	type;
+		codecRate		rate;		//rate active after event
+	};
+
+	void 		sampleRateSet(codecRate rate, uint32_t timeStamp);
+	void 		codecClosed(uint32_t timeStamp);
+	void 		configError(uint32_t timeStamp);
+	void 		resetTelemetry(void);
+
+	bool 		isEventAvailable(void) const;
+	codecEvent	getEvent(void);							//read the oldest not read event
+	uint32_t	getLostEvents(void) const;				//events overwritten before application read them
+
+	codecRate	getRate(void) const;
+	bool		isSessionOpen(void) const;
+	uint32_t	getTimeInRate(codecRate rate, uint32_t timeStamp) const;	//time (ms) spent in rate during current / last session
+	uint32_t	getSessionTime(uint32_t timeStamp) const;					//time (ms) of current / last session
+	uint32_t	getSessionCount(void) const;
+	uint32_t	getRateSwitchCount(void) const;			//during current / last session
+	uint32_t	getConfigErrorCount(void) const;		//during current / last session
+
+private:
+	void addEvent(codecEventType type, uint32_t timeStamp);
+	void closeRatePeriod(uint32_t timeStamp);
+
+	CircularBuffer<codecEvent, OVC3860_CodecHistorySize> history;
+	uint32_t	lostEvents = 0;
+
+	codecRate	rate = RateNone;
+	bool		sessionOpen = false;
+	uint32_t	sessionStart = 0;
+	uint32_t	sessionEnd = 0;
+	uint32_t	rateStart = 0;							//time stamp of last rate change
+	uint32_t	timeInRate[codecRate_count];			//closed periods only, open one is added in getTimeInRate()
+	uint32_t	sessionCount = 0;
+	uint32_t	rateSwitchCount = 0;
+	uint32_t	configErrorCount = 0;
+};
+
+#endif /* OVC3860_CODECTELEMETRY_H_ */
@@ -0,0 +1,299 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ConfigCache.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 module configuration cache class.
+  *          This file provides code to keep last known module
+  *          configuration in MCU persistent memory (backup SRAM,
+  *          flash) and trust it on cold start.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_ConfigCache.h"
+#include <string.h>
+
+/**
+  * @brief	Object constructor
+  * @note	Cache is empty until load() or first indication.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860ConfigCache::OVC3860ConfigCache(void){
+	memset(&Image, 0, sizeof(Image));
+	invalidate();
+}
+
+/**
+  * @brief	CRC-32 (IEEE 802.3, reflected, 0xEDB88320).
+  * @note	Bitwise version, cache image is small and it is
+  * 		 counted only on load() and getImage().
+  *
+  * @param	pData - data to count
+  * @param	length - size of pData
+  * @param	crc - previous result to continue counting, 0 to start
+  * @retval	CRC-32
+  */
+uint32_t OVC3860ConfigCache::crc32(const void* pData, size_t length, uint32_t crc){
+	const uint8_t* pByte = (const uint8_t*) pData;
+
+	crc = ~crc;
+	while (length--)
+	{
+		crc ^= *pByte++;
+		for (uint8_t bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+	}
+	return ~crc;
+}
+
+/**
+  * @brief	Load cache image read from persistent memory.
+  * @note	Image is accepted if magic, layout and CRC are
+  * 		 correct. Values are trusted but not validated,
+  * 		 module confirms them later.
+  *
+  * @param	pStorage - image, i.e. (const void*) BKPSRAM_BASE
+  * @param	storageSize - size of pStorage
+  * @retval	true - image is valid and used
+  */
+bool OVC3860ConfigCache::load(const void* pStorage, size_t storageSize){
+	cacheImage loaded;
+
+	if (pStorage == 0 || storageSize < sizeof(cacheImage))
+		return false;
+	memcpy(&loaded, pStorage, sizeof(cacheImage));
+	if (loaded.magic != OVC3860_CacheMagic || loaded.layout != OVC3860_CacheLayout)
+		return false;
+	if (loaded.crc != crc32(&loaded, offsetof(cacheImage, crc)))
+		return false;
+
+	loaded.version[OVC3860_CacheVersionLength] = '\0';
+	loaded.name[OVC3860_CacheNameLength] = '\0';
+	loaded.pin[OVC3860_CachePinLength] = '\0';
+	Image = loaded;
+	dirty = false;
+	validatedFields = 0;
+	queriedFields = 0;
+	revalidationStarted = false;
+	return true;
+}
+
+/**
+  * @brief	Forget all cached values.
+  * @note	Generation stamp is kept, so image saved after
+  * 		 invalidation is newer than previous one.
+  */
+void OVC3860ConfigCache::invalidate(void){
+	uint32_t generation = (Image.magic == OVC3860_CacheMagic) ? Image.generation : 0;
+
+	memset(&Image, 0, sizeof(Image));
+	Image.magic = OVC3860_CacheMagic;
+	Image.layout = OVC3860_CacheLayout;
+	Image.generation = generation;
+	dirty = false;
+	validatedFields = 0;
+	queriedFields = 0;
+	revalidationStarted = false;
+}
+
+/**
+  * @brief	Cache image to be written to persistent memory.
+  * @note	CRC is counted here.
+  */
+const OVC3860ConfigCache::cacheImage& OVC3860ConfigCache::getImage(void){
+	Image.crc = crc32(&Image, offsetof(cacheImage, crc));
+	return Image;
+}
+
+/**
+  * @brief	Check if cache changed since load() / markSaved().
+  */
+bool OVC3860ConfigCache::isDirty(void) const{
+	return dirty;
+}
+
+/**
+  * @brief	Application wrote getImage() to persistent memory.
+  */
+void OVC3860ConfigCache::markSaved(void){
+	dirty = false;
+}
+
+/**
+  * @brief	Check if value is known.
+  */
+bool OVC3860ConfigCache::isValid(cacheField field) const{
+	return (Image.validFields & (1 << field)) != 0;
+}
+
+/**
+  * @brief	Check if value was confirmed by module since
+  * 		 load().
+  */
+bool OVC3860ConfigCache::isValidated(cacheField field) const{
+	return (validatedFields & (1 << field)) != 0;
+}
+
+/**
+  * @brief	Module is ready, revalidation queries may be
+  * 		 sent after OVC3860_CacheRevalidateDelay.
+  * @note	Delay lets the module finish its own boot traffic
+  * 		 (auto connection) first.
+  *
+  * @param	timeStamp - time of WELCOME / IS in ms
+  * @retval	n/a
+  */
+void OVC3860ConfigCache::startRevalidation(uint32_t timeStamp){
+	revalidationStarted = true;
+	revalidationTime = timeStamp + OVC3860_CacheRevalidateDelay;
+	queriedFields = 0;
+}
+
+/**
+  * @brief	Check if value should be queried now.
+  * @note	True is returned once per startRevalidation()
+  * 		 for each value not yet confirmed by module.
+  *
+  * @param	field - cached value
+  * @param	timeStamp - actual time in ms
+  * @retval	true - send query now
+  */
+bool OVC3860ConfigCache::isRevalidationDue(cacheField field, uint32_t timeStamp){
+	uint16_t mask = 1 << field;
+
+	if (!revalidationStarted || (int32_t) (timeStamp - revalidationTime) < 0)
+		return false;
+	if ((validatedFields & mask) || (queriedFields & mask))
+		return false;
+	queriedFields |= mask;
+	return true;
+}
+
+/**
+  * @brief	Time left to revalidation queries.
+  * @note	Used by OVC3860::getTimeToNextDeadline(void).
+  * 		Only version and auto answer / auto connect are
+  * 		 queried, other values are confirmed by indications.
+  *
+  * @param	timeStamp - actual time in ms
+  * @param	pTimeLeft - ms, 0 if queries are already due
+  * @retval	false - nothing to revalidate, pTimeLeft is not changed
+  */
+bool OVC3860ConfigCache::getTimeToRevalidation(uint32_t timeStamp, uint32_t* pTimeLeft) const{
+	uint16_t queried = (1 << CacheVersion) | (1 << CacheAutoAnswer) | (1 << CacheAutoConnect);
+	int32_t timeLeft = (int32_t) (revalidationTime - timeStamp);
+
+	if (!revalidationStarted || ((validatedFields | queriedFields) & queried) == queried)
+		return false;
+	*pTimeLeft = (timeLeft < 0) ? 0 : (uint32_t) timeLeft;
+	return true;
+}
+
+/**
+  * @brief	Value received from module.
+  */
+void OVC3860ConfigCache::fieldReceived(cacheField field, bool isChanged){
+	uint16_t mask = 1 << field;
+
+	validatedFields |= mask;
+	if (isChanged || !(Image.validFields & mask))
+	{
+		Image.validFields |= mask;
+		if (!dirty)
+			Image.generation++;					//one generation per saved image
+		dirty = true;
+	}
+}
+
+void OVC3860ConfigCache::setText(cacheField field, char* pDestination, size_t maxLength, const char* pSource, size_t length){
+	if (length > maxLength)
+		length = maxLength;
+	bool isChanged = strncmp(pDestination, pSource, length) != 0 || pDestination[length] != '\0';
+	if (isChanged)
+	{
+		memcpy(pDestination, pSource, length);
+		memset(pDestination + length, 0, maxLength + 1 - length);
+	}
+	fieldReceived(field, isChanged);
+}
+
+void OVC3860ConfigCache::setValue(cacheField field, uint8_t* pDestination, uint8_t value){
+	bool isChanged = *pDestination != value;
+	*pDestination = value;
+	fieldReceived(field, isChanged);
+}
+
+/**
+  * @brief	Setters used by OVC3860::decodeReceivedString(void)
+  * 		 and by application (i.e. after PSKey read / write).
+  */
+void OVC3860ConfigCache::setVersion(const char* pVersion, size_t length){
+	setText(CacheVersion, Image.version, OVC3860_CacheVersionLength, pVersion, length);
+}
+
+void OVC3860ConfigCache::setName(const char* pName, size_t length){
+	setText(CacheName, Image.name, OVC3860_CacheNameLength, pName, length);
+}
+
+void OVC3860ConfigCache::setPin(const char* pPin, size_t length){
+	setText(CachePin, Image.pin, OVC3860_CachePinLength, pPin, length);
+}
+
+void OVC3860ConfigCache::setBaudrate(uint8_t baudrate){
+	setValue(CacheBaudrate, &Image.baudrate, baudrate);
+}
+
+void OVC3860ConfigCache::setAutoAnswer(bool isOn){
+	setValue(CacheAutoAnswer, &Image.autoAnswer, isOn);
+}
+
+void OVC3860ConfigCache::setAutoConnect(bool isOn){
+	setValue(CacheAutoConnect, &Image.autoConnect, isOn);
+}
+
+/**
+  * @brief	Getters, check isValid() first.
+  */
+const char* OVC3860ConfigCache::getVersion(void) const{
+	return Image.version;
+}
+
+const char* OVC3860ConfigCache::getName(void) const{
+	return Image.name;
+}
+
+const char* OVC3860ConfigCache::getPin(void) const{
+	return Image.pin;
+}
+
+uint8_t OVC3860ConfigCache::getBaudrate(void) const{
+	return Image.baudrate;
+}
+
+bool OVC3860ConfigCache::getAutoAnswer(void) const{
+	return Image.autoAnswer != 0;
+}
+
+bool OVC3860ConfigCache::getAutoConnect(void) const{
+	return Image.autoConnect != 0;
+}
+
+uint32_t OVC3860ConfigCache::getGeneration(void) const{
+	return Image.generation;
+}
@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ConfigCache.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 module configuration cache class.
+  *          This file provides code to keep last known module
+  *          configuration in MCU persistent memory (backup SRAM,
+  *          flash) and trust it on cold start.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_CONFIGCACHE_H_
+#define OVC3860_CONFIGCACHE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define	OVC3860_CacheMagic				0x3343564F	//"OVC3", marks valid cache image
+#define	OVC3860_CacheLayout				1			//change it when cacheImage struct changes, old images are rejected
+#define	OVC3860_CacheVersionLength		16			//max. length of IS<version> / MW<version>
+#define	OVC3860_CacheNameLength			16			//max. length of local name (PSKey localname)
+#define	OVC3860_CachePinLength			4			//length of pin code (PSKey pincode)
+#define	OVC3860_CacheRevalidateDelay	2000		//ms, delay between module readiness and revalidation queries
+
+
+/*
+ * OVC3860ConfigCache is class to keep last known module configuration
+ *  (version, name, PIN, UART baudrate, auto answer / auto connect).
+ *
+ * Cache image (cacheImage struct) is stored by application in backup
+ *  SRAM or flash, it is protected with CRC-32 and has generation
+ *  stamp incremented with each change. On cold start application
+ *  gives stored image to load() and may use cached values at once.
+ *
+ * Cached values are revalidated lazily: OVC3860::decodeReceivedString(void)
+ *  updates cache with IS/MW, MM, MN, MF indications and
+ *  OVC3860::periodicTask(void) queries not yet confirmed values
+ *  OVC3860_CacheRevalidateDelay after module is ready.
+ */
+class OVC3860ConfigCache{
+public:
+	OVC3860ConfigCache(void);
+
+	enum cacheField
+	{
+		CacheVersion,
+		CacheName,
+		CachePin,
+		CacheBaudrate,			//OVC3860_BAUDRATE_xxx code (OVC3860PSKey.h)
+		CacheAutoAnswer,
+		CacheAutoConnect,
+		cacheField_count
+	};
+
+	struct cacheImage
+	{
+		uint32_t	magic;
+		uint16_t	layout;
+		uint16_t	validFields;							//bit mask of cacheField
+		uint32_t	generation;								//incremented with each change
+		char		version[OVC3860_CacheVersionLength + 1];	//'\0' terminated
+		char		name[OVC3860_CacheNameLength + 1];			//'\0' terminated
+		char		pin[OVC3860_CachePinLength + 1];			//'\0' terminated
+		uint8_t		baudrate;
+		uint8_t		autoAnswer;
+		uint8_t		autoConnect;
+		uint32_t	crc;									//CRC-32 of all previous fields
+	};
+
+	bool 		load(const void* pStorage, size_t storageSize);		//true - image is valid and trusted
+	void 		invalidate(void);
+	const cacheImage&	getImage(void);								//write it to persistent memory when isDirty()
+	bool 		isDirty(void) const;
+	void 		markSaved(void);
+
+	bool 		isValid(cacheField field) const;					//value is known (cached or received)
+	bool 		isValidated(cacheField field) const;				//value was confirmed by module since load()
+	bool 		isRevalidationDue(cacheField field, uint32_t timeStamp);
+	bool 		getTimeToRevalidation(uint32_t timeStamp, uint32_t* pTimeLeft) const;	//false - nothing to revalidate
+	void 		startRevalidation(uint32_t timeStamp);				//module is ready (WELCOME / IS)
+
+	void 		setVersion(const char* pVersion, size_t length);
+	void 		setName(const char* pName, size_t length);
+	void 		setPin(const char* pPin, size_t length);
+	void 		setBaudrate(uint8_t baudrate);
+	void 		setAutoAnswer(bool isOn);
+	void 		setAutoConnect(bool isOn);
+
+	const char*	getVersion(void) const;
+	const char*	getName(void) const;
+	const char*	getPin(void) const;
+	uint8_t 	getBaudrate(void) const;
+	bool 		getAutoAnswer(void) const;
+	bool 		getAutoConnect(void) const;
+	uint32_t 	getGeneration(void) const;
+
+	static uint32_t	crc32(const void* pData, size_t length, uint32_t crc = 0);
+
+private:
+	void 		setText(cacheField field, char* pDestination, size_t maxLength, const char* pSource, size_t length);
+	void 		setValue(cacheField field, uint8_t* pDestination, uint8_t value);
+	void 		fieldReceived(cacheField field, bool isChanged);
+
+	cacheImage	Image;
+	bool		dirty = false;
+	uint16_t	validatedFields = 0;						//bit mask of cacheField confirmed since load()
+	uint16_t	queriedFields = 0;							//bit mask of cacheField already revalidated by query
+	bool		revalidationStarted = false;
+	uint32_t	revalidationTime = 0;
+};
+
+#endif /* OVC3860_CONFIGCACHE_H_ */
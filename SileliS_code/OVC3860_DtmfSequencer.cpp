@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_DtmfSequencer.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 DTMF sequencer class.
+  *          This file provides code to send whole DTMF / dial string
+  *          (i.e. IVR PIN) as paced #CX commands.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_DtmfSequencer.h"
+#include <string.h>
+
+/**
+  * @brief	Object constructor
+  * @note	n/a
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860DtmfSequencer::OVC3860DtmfSequencer(void){
+	memset(digits, 0, sizeof(digits));
+}
+
+/**
+  * @brief	Check if character may be sent with #CX.
+  * @note	',' (pause) is not a digit, but is accepted by start().
+  */
+bool OVC3860DtmfSequencer::isValidDigit(char digit){
+	return (digit >= '0' && digit <= '9') || digit == '*' || digit == '#'
+			|| (digit >= 'A' && digit <= 'D') || (digit >= 'a' && digit <= 'd');
+}
+
+/**
+  * @brief	Start sending DTMF string.
+  * @note	String is copied, so pDigits does not have to exist
+  * 		 after call. Previous string is replaced. The first
+  * 		 digit is sent with the next periodicTask(void).
+  *
+  * @param	pDigits - i.e. "1234#" or "0,,123#"
+  * @param	length - number of characters
+  * @param	timeStamp - actual time in ms
+  * @retval	false - empty, longer than OVC3860_DtmfMaxDigits or
+  * 		 with invalid character, nothing is sent
+  */
+bool OVC3860DtmfSequencer::start(const char* pDigits, size_t newLength, uint32_t timeStamp){
+	if (pDigits == 0 || newLength == 0 || newLength > OVC3860_DtmfMaxDigits)
+		return false;
+	for (size_t i = 0; i < newLength; i++)
+		if (!isValidDigit(pDigits[i]) && pDigits[i] != ',')
+			return false;
+
+	for (size_t i = 0; i < newLength; i++)
+		digits[i] = (pDigits[i] >= 'a' && pDigits[i] <= 'd') ? pDigits[i] - 'a' + 'A' : pDigits[i];
+	length = newLength;
+	position = 0;
+	sentDigits = 0;
+	nextTime = timeStamp;
+	status = DtmfPlaying;
+	return true;
+}
+
+/**
+  * @brief	Stop sending, not sent digits are dropped.
+  */
+void OVC3860DtmfSequencer::cancel(void){
+	if (status == DtmfPlaying)
+		status = DtmfCancelled;
+}
+
+/**
+  * @brief	Check if next digit should be sent now.
+  * @note	Pauses (',') are passed here without sending.
+  * 		Digit stays due until digitSent() is called, so it
+  * 		 is returned again if its #CX could not be queued.
+  *
+  * @param	timeStamp - actual time in ms
+  * @param	pDigit - digit to send with #CX
+  * @retval	true - send pDigit now
+  */
+bool OVC3860DtmfSequencer::isDigitDue(uint32_t timeStamp, char* pDigit){
+	while (status == DtmfPlaying && (int32_t) (timeStamp - nextTime) >= 0)
+	{
+		if (digits[position] != ',')
+		{
+			*pDigit = digits[position];
+			return true;
+		}
+		nextTime += OVC3860_DtmfPause;
+		if (++position >= length)
+			status = DtmfCompleted;
+	}
+	return false;
+}
+
+/**
+  * @brief	Digit returned by isDigitDue() was queued.
+  * @note	Next digit is due digitGap ms later. Status is
+  * 		 DtmfCompleted after the last digit.
+  *
+  * @param	timeStamp - actual time in ms
+  * @retval	n/a
+  */
+void OVC3860DtmfSequencer::digitSent(uint32_t timeStamp){
+	if (status != DtmfPlaying)
+		return;
+	if (++position >= length)
+		status = DtmfCompleted;
+	nextTime = timeStamp + digitGap;
+	sentDigits++;
+}
+
+/**
+  * @brief	Time left to next digit.
+  * @note	Used by OVC3860::getTimeToNextDeadline(void).
+  *
+  * @param	timeStamp - actual time in ms
+  * @param	pTimeLeft - ms, 0 if digit is already due
+  * @retval	false - nothing is playing, pTimeLeft is not changed
+  */
+bool OVC3860DtmfSequencer::getTimeToNextDigit(uint32_t timeStamp, uint32_t* pTimeLeft) const{
+	if (status != DtmfPlaying)
+		return false;
+	int32_t timeLeft = (int32_t) (nextTime - timeStamp);
+	*pTimeLeft = (timeLeft < 0) ? 0 : (uint32_t) timeLeft;
+	return true;
+}
+
+/**
+  * @brief	Set time between two #CX commands.
+  *
+  * @param	newGap - ms
+  * @retval	n/a
+  */
+void OVC3860DtmfSequencer::setDigitGap(uint32_t newGap){
+	digitGap = newGap;
+}
+
+uint32_t OVC3860DtmfSequencer::getDigitGap(void) const{
+	return digitGap;
+}
+
+/**
+  * @brief	Status of actual / the latest string.
+  * @note	Poll it to detect completion.
+  */
+OVC3860DtmfSequencer::sequenceStatus OVC3860DtmfSequencer::getStatus(void) const{
+	return status;
+}
+
+size_t OVC3860DtmfSequencer::getSentDigits(void) const{
+	return sentDigits;
+}
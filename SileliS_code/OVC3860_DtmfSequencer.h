@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_DtmfSequencer.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 DTMF sequencer class.
+  *          This file provides code to send whole DTMF / dial string
+  *          (i.e. IVR PIN) as paced #CX commands.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_DTMFSEQUENCER_H_
+#define OVC3860_DTMFSEQUENCER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define	OVC3860_DtmfMaxDigits		32		//max. length of DTMF string (with pauses)
+#define	OVC3860_DtmfDigitGap		250		//ms, default time between two #CX commands
+#define	OVC3860_DtmfPause			2000	//ms, pause for ',' character in DTMF string
+
+
+/*
+ * OVC3860DtmfSequencer is class which sends DTMF string one digit
+ *  at a time. Application gives whole string to start(),
+ *  OVC3860::periodicTask(void) sends #CX when isDigitDue() returns
+ *  true and reports queued command with digitSent(), so main loop
+ *  is never blocked and digit dropped by full transmit queue is
+ *  sent again.
+ *
+ * Supported characters: 0-9, '*', '#', A-D (a-d), ',' - pause of
+ *  OVC3860_DtmfPause. String is validated before start, invalid
+ *  string is not sent at all.
+ */
+class OVC3860DtmfSequencer{
+public:
+	OVC3860DtmfSequencer(void);
+
+	enum sequenceStatus
+	{
+		DtmfIdle,				//nothing was started
+		DtmfPlaying,
+		DtmfCompleted,			//all digits were sent
+		DtmfCancelled
+	};
+
+	static bool	isValidDigit(char digit);
+	bool 		start(const char* pDigits, size_t length, uint32_t timeStamp);	//false - invalid character, too long or empty
+	void 		cancel(void);
+	bool 		isDigitDue(uint32_t timeStamp, char* pDigit);					//true - send pDigit with #CX now
+	void 		digitSent(uint32_t timeStamp);									//#CX of digit from isDigitDue() is queued
+	bool 		getTimeToNextDigit(uint32_t timeStamp, uint32_t* pTimeLeft) const;	//false - nothing is playing
+
+	void 		setDigitGap(uint32_t newGap);
+	uint32_t 	getDigitGap(void) const;
+	sequenceStatus	getStatus(void) const;
+	size_t 		getSentDigits(void) const;										//of actual / the latest string
+
+private:
+	char		digits[OVC3860_DtmfMaxDigits];
+	size_t		length = 0;
+	size_t		position = 0;
+	uint32_t	nextTime = 0;					//time of next character
+	uint32_t	digitGap = OVC3860_DtmfDigitGap;
+	size_t		sentDigits = 0;
+	sequenceStatus	status = DtmfIdle;
+};
+
+#endif /* OVC3860_DTMFSEQUENCER_H_ */
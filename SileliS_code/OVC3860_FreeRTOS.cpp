@@ -0,0 +1,292 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_FreeRTOS.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 FreeRTOS integration class.
+  *          This file provides code to run OVC3860 audio/ phone class
+  *          in FreeRTOS tasks instead of busy polling main loop.
+  *          It is compiled only if OVC3860_USE_FREERTOS is defined
+  *          in OVC3860_device.h file.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_FreeRTOS.h"
+
+#ifdef OVC3860_USE_FREERTOS
+
+#include <string.h>
+
+/**
+  * @brief	Object constructor
+  * @note	Tasks are not created until start().
+  *
+  * @param	pDevice - OVC3860 object served by tasks
+  * @retval	n/a
+  */
+OVC3860RTOS::OVC3860RTOS(OVC3860* pDevice){
+	pOVC3860 = pDevice;
+}
+
+/**
+  * @brief	Object destructor
+  * @note	Deletes tasks and queues.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860RTOS::~OVC3860RTOS(){
+	pOVC3860->rtosTransmitQueue = 0;
+	if (parserTaskHandle != 0)
+		vTaskDelete(parserTaskHandle);
+	if (transmitTaskHandle != 0)
+		vTaskDelete(transmitTaskHandle);
+	if (receiveStream != 0)
+		vStreamBufferDelete(receiveStream);
+	if (commandQueue != 0)
+		vQueueDelete(commandQueue);
+	if (transmitQueue != 0)
+		vQueueDelete(transmitQueue);
+	if (stateQueue != 0)
+		vQueueDelete(stateQueue);
+}
+
+/**
+  * @brief	Create stream buffer, queues and tasks.
+  * @note	Execute it before vTaskStartScheduler() or from
+  * 		 other task. From now OVC3860 object belongs to
+  * 		 parser task.
+  *
+  * @param	priority - priority of parser and transmit tasks
+  * @retval	true - all objects created
+  */
+bool OVC3860RTOS::start(UBaseType_t priority){
+	receiveStream = xStreamBufferCreate(OVC3860_RTOSStreamBufferSize, 1);
+	commandQueue = xQueueCreate(OVC3860_RTOSCommandQueueLength, sizeof(commandRequest));
+	transmitQueue = xQueueCreate(OVC3860_TransmitQueueSize, sizeof(OVC3860::transmitCommand));
+	stateQueue = xQueueCreate(1, sizeof(uint32_t));
+	if (receiveStream == 0 || commandQueue == 0 || transmitQueue == 0 || stateQueue == 0)
+		return false;
+
+	pOVC3860->rtosTransmitQueue = transmitQueue;
+	if (xTaskCreate(OVC3860RTOS::transmitTask, "OVC3860 TX", OVC3860_RTOSStackSize, this, priority, &transmitTaskHandle) != pdPASS)
+		return false;
+	if (xTaskCreate(OVC3860RTOS::parserTask, "OVC3860 RX", OVC3860_RTOSStackSize, this, priority, &parserTaskHandle) != pdPASS)
+		return false;
+	return true;
+}
+
+/**
+  * @brief	Pass received byte to parser task.
+  * @note	Execute it in HAL_UART_RxCpltCallback instead of
+  * 		 OVC3860::getData().
+  * 		Byte which does not fit into stream buffer (parser
+  * 		 task starved) is lost and counted by getDroppedBytes().
+  *
+  * @param	RxBuff - received byte
+  * @retval	n/a
+  */
+void OVC3860RTOS::receiveFromISR(uint8_t RxBuff){
+	BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+	if (receiveStream == 0)
+		return;
+	if (xStreamBufferSendFromISR(receiveStream, &RxBuff, 1, &higherPriorityTaskWoken) == 0)
+		droppedBytes++;
+	if (RxBuff == '\n')											//wake parser only when line is complete
+		vTaskNotifyGiveFromISR(parserTaskHandle, &higherPriorityTaskWoken);
+	portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+/**
+  * @brief	Number of received bytes lost because stream buffer
+  * 		 was full.
+  */
+uint32_t OVC3860RTOS::getDroppedBytes(void) const{
+	return droppedBytes;
+}
+
+/**
+  * @brief	Inform transmit task that DMA transfer is finished.
+  * @note	Execute it in HAL_UART_TxCpltCallback.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860RTOS::transmitCompleteFromISR(void){
+	BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+	if (transmitTaskHandle == 0)
+		return;
+	vTaskNotifyGiveFromISR(transmitTaskHandle, &higherPriorityTaskWoken);
+	portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+/**
+  * @brief	Post OVC3860 command to be executed by parser task.
+  * @note	i.e. postCommand(&OVC3860::musicPlayPause);
+  *
+  * @param	pCommand - OVC3860 method without parameters
+  * @param	timeout - ticks to wait if command queue is full
+  * @retval	true - command posted
+  */
+bool OVC3860RTOS::postCommand(void (OVC3860::*pCommand)(void), TickType_t timeout){
+	commandRequest request;
+	request.pCommand = pCommand;
+	request.pCommandWithData = 0;
+	request.extraDataSize = 0;
+
+	if (xQueueSend(commandQueue, &request, timeout) != pdPASS)
+		return false;
+	xTaskNotifyGive(parserTaskHandle);
+	return true;
+}
+
+/**
+  * @brief	Post OVC3860 command with extra data to be executed
+  * 		 by parser task.
+  * @note	Extra data are copied, so pExtraData may be local.
+  * 		i.e. postCommand(&OVC3860::callDialNumber, "123456789", 9);
+  *
+  * @param	pCommand - OVC3860 method with extra data
+  * @param	pExtraData - extra data
+  * @param	ExtraDataSize - size of pExtraData, max. OVC3860_CommandMaxLength
+  * @param	timeout - ticks to wait if command queue is full
+  * @retval	true - command posted
+  */
+bool OVC3860RTOS::postCommand(void (OVC3860::*pCommand)(const char*, size_t), const char* pExtraData, size_t ExtraDataSize, TickType_t timeout){
+	commandRequest request;
+
+	if (ExtraDataSize > OVC3860_CommandMaxLength)
+		return false;
+	request.pCommand = 0;
+	request.pCommandWithData = pCommand;
+	request.extraDataSize = (uint8_t) ExtraDataSize;
+	memcpy(request.extraData, pExtraData, ExtraDataSize);
+
+	if (xQueueSend(commandQueue, &request, timeout) != pdPASS)
+		return false;
+	xTaskNotifyGive(parserTaskHandle);
+	return true;
+}
+
+/**
+  * @brief	Wait until OVC3860 states change.
+  * @note	Only the newest snapshot is kept, decode it with
+  * 		 OVC3860::snapshotState().
+  *
+  * @param	pSnapshot - destination of state snapshot
+  * @param	timeout - ticks to wait
+  * @retval	true - new snapshot received
+  */
+bool OVC3860RTOS::waitForStateChange(uint32_t* pSnapshot, TickType_t timeout){
+	return xQueueReceive(stateQueue, pSnapshot, timeout) == pdPASS;
+}
+
+/**
+  * @brief	FreeRTOS task functions, parameter is OVC3860RTOS object.
+  */
+void OVC3860RTOS::parserTask(void* pParameters){
+	((OVC3860RTOS*) pParameters)->parserLoop();
+}
+
+void OVC3860RTOS::transmitTask(void* pParameters){
+	((OVC3860RTOS*) pParameters)->transmitLoop();
+}
+
+/**
+  * @brief	Parser task body.
+  * @note	Sleeps until line is received, command is posted,
+  * 		 transmitter gets free or periodicTask(void) deadline
+  * 		 elapses.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860RTOS::parserLoop(void){
+	uint32_t publishedSnapshot = pOVC3860->getStateSnapshot();
+	xQueueOverwrite(stateQueue, &publishedSnapshot);
+
+	for (;;)
+	{
+		TickType_t sleepTime = 0;
+		if (!pOVC3860->isWorkPending())
+		{
+			uint32_t timeLeft = pOVC3860->getTimeToNextDeadline();
+			sleepTime = (timeLeft == OVC3860_NoDeadline) ? portMAX_DELAY : pdMS_TO_TICKS(timeLeft);
+		}
+		ulTaskNotifyTake(pdTRUE, sleepTime);
+
+		uint8_t received[OVC3860_RTOSReceiveChunkSize];
+		size_t receivedSize;
+		while ((receivedSize = xStreamBufferReceive(receiveStream, received, sizeof(received), 0)) > 0)
+			pOVC3860->getData(received, receivedSize);
+		pOVC3860->process();
+
+		commandRequest request;
+		while (xQueueReceive(commandQueue, &request, 0) == pdPASS)
+		{
+			if (request.pCommand != 0)
+				(pOVC3860->*request.pCommand)();
+			else
+				(pOVC3860->*request.pCommandWithData)(request.extraData, request.extraDataSize);
+		}
+
+		pOVC3860->periodicTask();
+
+		uint32_t snapshot = pOVC3860->getStateSnapshot();
+		if (OVC3860::snapshotVersion(snapshot) != OVC3860::snapshotVersion(publishedSnapshot))
+		{
+			publishedSnapshot = snapshot;
+			xQueueOverwrite(stateQueue, &publishedSnapshot);
+		}
+	}
+}
+
+/**
+  * @brief	Transmit task body.
+  * @note	Task touches only its RTOS queue, its own command
+  * 		 buffer and transmit side of transport. OVC3860
+  * 		 transmit queue belongs to parser task, which is
+  * 		 notified each time RTOS queue gets free slot and
+  * 		 checks uxQueueSpacesAvailable() itself.
+  * 		Command buffer is not reused until transfer is
+  * 		 finished, transfer which does not finish within
+  * 		 OVC3860_RTOSTransmitTimeout is aborted.
+  * 		Transports which transmit synchronously (POSIX,
+  * 		 loopback) do not wait for notification.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860RTOS::transmitLoop(void){
+	for (;;)
+	{
+		xQueueReceive(transmitQueue, &transmittedCommand, portMAX_DELAY);
+		xTaskNotifyGive(parserTaskHandle);							//queue space is free, parser moves waiting commands
+
+		ulTaskNotifyTake(pdTRUE, 0);								//clear notification of previous, aborted transfer
+		if (!pOVC3860->transport.transmit(transmittedCommand.data, transmittedCommand.length))
+			continue;
+		while (!pOVC3860->transport.isTransmitterFree())
+		{
+			if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(OVC3860_RTOSTransmitTimeout)) == 0)
+				pOVC3860->transport.abortTransmit();				//DMA stops reading transmittedCommand
+		}
+	}
+}
+
+#endif /* OVC3860_USE_FREERTOS */
@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_FreeRTOS.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 FreeRTOS integration class.
+  *          This file provides code to run OVC3860 audio/ phone class
+  *          in FreeRTOS tasks instead of busy polling main loop.
+  *          It is compiled only if OVC3860_USE_FREERTOS is defined
+  *          in OVC3860_device.h file.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_FREERTOS_H_
+#define OVC3860_FREERTOS_H_
+
+#include "OVC3860_device.h"
+
+#ifdef OVC3860_USE_FREERTOS
+
+#include "stream_buffer.h"
+
+#define	OVC3860_RTOSStreamBufferSize	128		//defines how many received bytes could wait for parser task
+#define	OVC3860_RTOSReceiveChunkSize	16		//bytes moved from stream buffer to circular buffer at once (parser task stack)
+#define	OVC3860_RTOSCommandQueueLength	8		//defines how many commands posted by other tasks could wait for parser task
+#define	OVC3860_RTOSTransmitTimeout		100		//ms, max. time of one command transmission
+#ifndef OVC3860_RTOSStackSize
+#define	OVC3860_RTOSStackSize			256		//words, stack of each task
+#endif
+
+
+/*
+ * OVC3860RTOS is class to run OVC3860 object in FreeRTOS tasks.
+ *
+ *  - UART receive ISR passes bytes with receiveFromISR() to stream
+ *    buffer and wakes parser task with direct-to-task notification,
+ *  - parser task is the only owner of OVC3860 object, it sleeps until
+ *    data arrive or OVC3860::getTimeToNextDeadline(void) elapses, so
+ *    with configUSE_TICKLESS_IDLE the core is not woken by driver
+ *    when module is silent, decodes all received lines, executes
+ *    commands posted by other tasks and runs periodicTask(void),
+ *  - transmit task sends commands passed by parser task through its
+ *    own queue and sleeps until transmitCompleteFromISR() is called,
+ *  - state snapshot is published in one item queue (mailbox) each time
+ *    it changes.
+ *
+ *  Other tasks must not call OVC3860 methods directly, use postCommand().
+ */
+class OVC3860RTOS{
+public:
+	OVC3860RTOS(OVC3860* pDevice);
+	~OVC3860RTOS();
+
+	bool 	start(UBaseType_t priority);								//create queues and tasks
+	void 	receiveFromISR(uint8_t RxBuff);								//execute in HAL_UART_RxCpltCallback
+	void 	transmitCompleteFromISR(void);								//execute in HAL_UART_TxCpltCallback
+	bool 	postCommand(void (OVC3860::*pCommand)(void), TickType_t timeout = 0);
+	bool 	postCommand(void (OVC3860::*pCommand)(const char*, size_t), const char* pExtraData, size_t ExtraDataSize, TickType_t timeout = 0);
+	bool 	waitForStateChange(uint32_t* pSnapshot, TickType_t timeout);	//snapshot of OVC3860::getStateSnapshot()
+	uint32_t getDroppedBytes(void) const;								//received bytes lost, stream buffer was full
+
+private:
+	struct commandRequest{
+		void (OVC3860::*pCommand)(void);
+		void (OVC3860::*pCommandWithData)(const char*, size_t);
+		uint8_t		extraDataSize;
+		char		extraData[OVC3860_CommandMaxLength];
+	};
+
+	static void parserTask(void* pParameters);
+	static void transmitTask(void* pParameters);
+	void 		parserLoop(void);
+	void 		transmitLoop(void);
+
+	OVC3860*				pOVC3860;
+	StreamBufferHandle_t	receiveStream = 0;
+	QueueHandle_t			commandQueue = 0;
+	QueueHandle_t			transmitQueue = 0;
+	QueueHandle_t			stateQueue = 0;
+	TaskHandle_t			parserTaskHandle = 0;
+	TaskHandle_t			transmitTaskHandle = 0;
+	volatile uint32_t		droppedBytes = 0;		//written by receiveFromISR()
+	OVC3860::transmitCommand	transmittedCommand;		//DMA source, owned by transmit task
+};
+
+#endif /* OVC3860_USE_FREERTOS */
+
+#endif /* OVC3860_FREERTOS_H_ */
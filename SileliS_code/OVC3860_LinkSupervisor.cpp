@@ -0,0 +1,250 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_LinkSupervisor.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 HFP / A2DP link supervision class.
+  *          This file provides code to recover lost Bluetooth links
+  *          with exponential backoff reconnection attempts.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_LinkSupervisor.h"
+#include <string.h>
+
+/**
+  * @brief	Object constructor
+  * @note	Supervision is disabled by default, use enable().
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860LinkSupervisor::OVC3860LinkSupervisor(void){
+	for (uint8_t i = 0; i < link_count; i++)
+	{
+		Links[i].state = NotSupervised;
+		Links[i].lostTime = 0;
+		Links[i].nextAttemptTime = 0;
+		Links[i].delay = firstDelay;
+		Links[i].attempts = 0;
+	}
+	resetStatistics();
+}
+
+/**
+  * @brief	Enable reconnection attempts.
+  * @note	Links states are tracked also when supervisor
+  * 		 is disabled, so links lost before enabling are
+  * 		 recovered as well.
+  */
+void OVC3860LinkSupervisor::enable(void){
+	enabled = true;
+}
+
+/**
+  * @brief	Disable reconnection attempts.
+  */
+void OVC3860LinkSupervisor::disable(void){
+	enabled = false;
+}
+
+/**
+  * @brief	Check if reconnection attempts are enabled.
+  */
+bool OVC3860LinkSupervisor::isEnabled(void) const{
+	return enabled;
+}
+
+/**
+  * @brief	Set exponential backoff parameters.
+  * @note	Takes effect with next link loss.
+  *
+  * @param	newFirstDelay - ms, delay between link loss and first attempt
+  * @param	newMaxDelay - ms, max. delay between attempts
+  * @param	newMaxAttempts - max. number of attempts, 0 - no limit
+  * @retval	n/a
+  */
+void OVC3860LinkSupervisor::setBackoff(uint32_t newFirstDelay, uint32_t newMaxDelay, uint8_t newMaxAttempts){
+	firstDelay = newFirstDelay;
+	maxDelay = (newMaxDelay < newFirstDelay) ? newFirstDelay : newMaxDelay;
+	maxAttempts = newMaxAttempts;
+}
+
+/**
+  * @brief	Link disconnect indication (IA, MY, M0).
+  * @note	Only connected link starts recovery, repeated
+  * 		 indications do not restart backoff.
+  *
+  * @param	lostLink - HFP / A2DP
+  * @param	timeStamp - time of indication in ms
+  * @retval	n/a
+  */
+void OVC3860LinkSupervisor::linkLost(link lostLink, uint32_t timeStamp){
+	linkSupervision* pLink = &Links[lostLink];
+
+	if (pLink->state == Linked)
+	{
+		pLink->state = Recovering;
+		pLink->lostTime = timeStamp;
+		pLink->delay = firstDelay;
+		pLink->nextAttemptTime = timeStamp + firstDelay;
+		pLink->attempts = 0;
+		Statistics[lostLink].linkLosses++;
+	}
+}
+
+/**
+  * @brief	Link connect indication (IV, MU4, MU5).
+  * @note	Stops recovery and updates time to reconnect
+  * 		 statistics.
+  * 		A2DP is connected over HFP link, so when HFP is
+  * 		 restored A2DP attempt is postponed to give the
+  * 		 phone a chance to connect A2DP itself.
+  *
+  * @param	restoredLink - HFP / A2DP
+  * @param	timeStamp - time of indication in ms
+  * @retval	n/a
+  */
+void OVC3860LinkSupervisor::linkRestored(link restoredLink, uint32_t timeStamp){
+	linkSupervision* pLink = &Links[restoredLink];
+
+	if (pLink->state == Recovering)
+	{
+		reconnectStatistics* pStatistics = &Statistics[restoredLink];
+		uint32_t time = timeStamp - pLink->lostTime;
+
+		pStatistics->recoveries++;
+		pStatistics->lastTime = time;
+		pStatistics->totalTime += time;
+		if (pStatistics->recoveries == 1 || time < pStatistics->minTime)
+			pStatistics->minTime = time;
+		if (time > pStatistics->maxTime)
+			pStatistics->maxTime = time;
+	}
+	pLink->state = Linked;
+
+	if (restoredLink == HFP && Links[A2DP].state == Recovering)
+		Links[A2DP].nextAttemptTime = timeStamp + firstDelay;
+}
+
+/**
+  * @brief	Application disconnects link on purpose.
+  * @note	Link will not be recovered until it is
+  * 		 connected again.
+  *
+  * @param	releasedLink - HFP / A2DP
+  * @retval	n/a
+  */
+void OVC3860LinkSupervisor::linkReleased(link releasedLink){
+	Links[releasedLink].state = NotSupervised;
+}
+
+/**
+  * @brief	Check if connect command should be sent now.
+  * @note	Each true result is counted as an attempt and
+  * 		 schedules next one with doubled delay.
+  * 		A2DP is not reconnected while HFP is still
+  * 		 recovering because #MI requires HFP connection.
+  *
+  * @param	linkToCheck - HFP / A2DP
+  * @param	timeStamp - actual time in ms
+  * @retval	true - send connectHSHF() / connectA2DP()
+  */
+bool OVC3860LinkSupervisor::isReconnectDue(link linkToCheck, uint32_t timeStamp){
+	linkSupervision* pLink = &Links[linkToCheck];
+
+	if (!enabled || pLink->state != Recovering)
+		return false;
+	if (linkToCheck == A2DP && Links[HFP].state == Recovering)
+		return false;
+	if ((int32_t) (timeStamp - pLink->nextAttemptTime) < 0)
+		return false;
+
+	if (maxAttempts != 0 && pLink->attempts >= maxAttempts)
+	{
+		pLink->state = NotSupervised;					//last attempt did not succeed, give up
+		Statistics[linkToCheck].giveUps++;
+		return false;
+	}
+
+	pLink->attempts++;
+	Statistics[linkToCheck].attempts++;
+	pLink->nextAttemptTime = timeStamp + pLink->delay;
+	pLink->delay = (pLink->delay > maxDelay / 2) ? maxDelay : pLink->delay * 2;
+	return true;
+}
+
+/**
+  * @brief	Check if link is being recovered.
+  */
+bool OVC3860LinkSupervisor::isRecovering(link linkToCheck) const{
+	return Links[linkToCheck].state == Recovering;
+}
+
+/**
+  * @brief	Time left to the nearest reconnection attempt.
+  * @note	Used by OVC3860::getTimeToNextDeadline(void), so MCU
+  * 		 may sleep until isReconnectDue() can return true.
+  *
+  * @param	timeStamp - actual time in ms
+  * @param	pTimeLeft - ms, 0 if attempt is already due
+  * @retval	false - no attempt is scheduled, pTimeLeft is not changed
+  */
+bool OVC3860LinkSupervisor::getTimeToNextAttempt(uint32_t timeStamp, uint32_t* pTimeLeft) const{
+	bool isScheduled = false;
+
+	if (!enabled)
+		return false;
+	for (uint8_t i = 0; i < link_count; i++)
+	{
+		if (Links[i].state != Recovering)
+			continue;
+		if (i == A2DP && Links[HFP].state == Recovering)
+			continue;										//A2DP waits for HFP, HFP deadline is enough
+
+		int32_t timeLeft = (int32_t) (Links[i].nextAttemptTime - timeStamp);
+		uint32_t linkTimeLeft = (timeLeft < 0) ? 0 : (uint32_t) timeLeft;
+		if (!isScheduled || linkTimeLeft < *pTimeLeft)
+			*pTimeLeft = linkTimeLeft;
+		isScheduled = true;
+	}
+	return isScheduled;
+}
+
+/**
+  * @brief	Time to reconnect statistics of link.
+  */
+const OVC3860LinkSupervisor::reconnectStatistics& OVC3860LinkSupervisor::getStatistics(link linkToCheck) const{
+	return Statistics[linkToCheck];
+}
+
+/**
+  * @brief	Average time to reconnect of link.
+  * @retval	ms, 0 if link was never recovered
+  */
+uint32_t OVC3860LinkSupervisor::getAverageReconnectTime(link linkToCheck) const{
+	if (Statistics[linkToCheck].recoveries == 0)
+		return 0;
+	return Statistics[linkToCheck].totalTime / Statistics[linkToCheck].recoveries;
+}
+
+/**
+  * @brief	Clear time to reconnect statistics.
+  */
+void OVC3860LinkSupervisor::resetStatistics(void){
+	memset(Statistics, 0, sizeof(Statistics));
+}
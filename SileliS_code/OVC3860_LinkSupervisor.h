@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_LinkSupervisor.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 HFP / A2DP link supervision class.
+  *          This file provides code to recover lost Bluetooth links
+  *          with exponential backoff reconnection attempts.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_LINKSUPERVISOR_H_
+#define OVC3860_LINKSUPERVISOR_H_
+
+#include <stdint.h>
+
+#define	OVC3860_ReconnectFirstDelay		1000	//ms, delay between link loss and first reconnection attempt
+#define	OVC3860_ReconnectMaxDelay		30000	//ms, backoff delay is doubled after each attempt up to this value
+#define	OVC3860_ReconnectMaxAttempts	0		//0 - retry until link is restored or released
+
+
+/*
+ * OVC3860LinkSupervisor is class which decides when lost HFP / A2DP
+ *  link should be reconnected.
+ * It is fed by OVC3860::decodeReceivedString(void) with disconnect
+ *  (IA, MY, M0) and connect (IV, MU4, MU5) indications. Reconnection
+ *  commands are sent by OVC3860::periodicTask(void) when
+ *  isReconnectDue() returns true.
+ *
+ * Only links that had been connected are supervised. Links released
+ *  by application (disconnectHSHF(), disconnectA2DP(), ...) are not
+ *  recovered until they are connected again.
+ *
+ * AVRCP is not supervised. OVC3860 command set has no AVRCP connect
+ *  command, module opens AVRCP channel itself on top of A2DP (MI),
+ *  so lost AVRCP (ML1) is recovered by A2DP reconnection when A2DP
+ *  is lost too. AVRCP lost alone (A2DP still connected) can not be
+ *  restored without dropping A2DP on purpose, AVRCPState only reports
+ *  it to application.
+ */
+class OVC3860LinkSupervisor{
+public:
+	OVC3860LinkSupervisor(void);
+
+	enum link
+	{
+		HFP,
+		A2DP,
+		link_count
+	};
+
+	struct reconnectStatistics
+	{
+		uint32_t	linkLosses;			//number of supervised link losses
+		uint32_t	recoveries;			//number of links restored after loss
+		uint32_t	giveUps;			//number of recoveries stopped after OVC3860_ReconnectMaxAttempts
+		uint32_t	attempts;			//number of sent connect commands
+		uint32_t	lastTime;			//ms, time to reconnect of last recovery
+		uint32_t	minTime;			//ms
+		uint32_t	maxTime;			//ms
+		uint32_t	totalTime;			//ms, sum of all times to reconnect
+	};
+
+	void 		enable(void);
+	void 		disable(void);
+	bool 		isEnabled(void) const;
+	void 		setBackoff(uint32_t firstDelay, uint32_t maxDelay, uint8_t maxAttempts);
+
+	void 		linkLost(link lostLink, uint32_t timeStamp);
+	void 		linkRestored(link restoredLink, uint32_t timeStamp);
+	void 		linkReleased(link releasedLink);
+	bool 		isReconnectDue(link linkToCheck, uint32_t timeStamp);
+	bool 		isRecovering(link linkToCheck) const;
+	bool 		getTimeToNextAttempt(uint32_t timeStamp, uint32_t* pTimeLeft) const;	//false - no attempt is scheduled
+
+	const reconnectStatistics&	getStatistics(link linkToCheck) const;
+	uint32_t 	getAverageReconnectTime(link linkToCheck) const;
+	void 		resetStatistics(void);
+
+private:
+	enum linkState
+	{
+		NotSupervised,			//never connected or released by application
+		Linked,
+		Recovering
+	};
+
+	struct linkSupervision
+	{
+		linkState	state;
+		uint32_t	lostTime;			//time stamp of link loss
+		uint32_t	nextAttemptTime;	//time stamp of next connect command
+		uint32_t	delay;				//actual backoff delay
+		uint8_t		attempts;			//connect commands sent during this recovery
+	};
+
+	bool 		enabled = false;
+	uint32_t	firstDelay = OVC3860_ReconnectFirstDelay;
+	uint32_t	maxDelay = OVC3860_ReconnectMaxDelay;
+	uint8_t		maxAttempts = OVC3860_ReconnectMaxAttempts;
+
+	linkSupervision		Links[link_count];
+	reconnectStatistics	Statistics[link_count];
+};
+
+#endif /* OVC3860_LINKSUPERVISOR_H_ */
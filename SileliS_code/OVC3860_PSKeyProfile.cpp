@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PSKeyProfile.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 PSKey profile class.
+  *          This file provides code to check and apply binary PSKey
+  *          profile (built by tools/OVC3860_ProfileCompiler.cpp from
+  *          datasheets/OVC3860_memmap.txt and overrides).
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_PSKeyProfile.h"
+
+/**
+  * @brief	Object constructor
+  * @note	Nothing is applied until load().
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860PSKeyProfile::OVC3860PSKeyProfile(void){
+}
+
+uint16_t OVC3860PSKeyProfile::readLE16(const uint8_t* pData){
+	return (uint16_t) (pData[0] | (pData[1] << 8));
+}
+
+uint32_t OVC3860PSKeyProfile::readLE32(const uint8_t* pData){
+	return (uint32_t) pData[0] | ((uint32_t) pData[1] << 8) | ((uint32_t) pData[2] << 16) | ((uint32_t) pData[3] << 24);
+}
+
+void OVC3860PSKeyProfile::writeLE16(uint8_t* pData, uint16_t value){
+	pData[0] = (uint8_t) value;
+	pData[1] = (uint8_t) (value >> 8);
+}
+
+void OVC3860PSKeyProfile::writeLE32(uint8_t* pData, uint32_t value){
+	writeLE16(pData, (uint16_t) value);
+	writeLE16(pData + 2, (uint16_t) (value >> 16));
+}
+
+/**
+  * @brief	Build profile header for given payload.
+  * @note	Used by profile compiler (host), so the format
+  * 		 is defined in one place.
+  *
+  * @param	pHeader - destination, OVC3860_ProfileHeaderLength long
+  * @param	runs - number of runs in pPayload
+  * @param	pPayload - runs
+  * @param	payloadLength - size of pPayload
+  * @param	profileVersion - version given by author of profile
+  * @retval	n/a
+  */
+void OVC3860PSKeyProfile::buildHeader(uint8_t* pHeader, uint16_t runs, const uint8_t* pPayload, uint32_t payloadLength, uint32_t profileVersion){
+	writeLE32(pHeader, OVC3860_ProfileMagic);
+	writeLE16(pHeader + 4, OVC3860_ProfileLayout);
+	writeLE16(pHeader + 6, runs);
+	writeLE32(pHeader + 8, payloadLength);
+	writeLE32(pHeader + 12, profileVersion);
+	uint32_t crc = OVC3860ConfigCache::crc32(pHeader, OVC3860_ProfileHeaderLength - 4);
+	writeLE32(pHeader + 16, OVC3860ConfigCache::crc32(pPayload, payloadLength, crc));
+}
+
+/**
+  * @brief	Check profile and keep pointer to it.
+  * @note	Magic, layout, CRC and each run (order, address
+  * 		 range, length) are checked, so apply() never
+  * 		 writes damaged profile to module.
+  * 		Previously loaded profile is unloaded even if
+  * 		 new one is rejected.
+  *
+  * @param	pProfile - profile, it has to exist until apply()
+  * @param	size - size of pProfile
+  * @retval	true - profile is valid and loaded
+  */
+bool OVC3860PSKeyProfile::load(const void* pProfile, size_t size){
+	const uint8_t* pHeader = (const uint8_t*) pProfile;
+
+	pRuns = 0;													//previous profile is forgotten also when load fails
+	payloadLength = 0;
+	runCount = 0;
+	profileVersion = 0;
+	if (pHeader == 0 || size < OVC3860_ProfileHeaderLength)
+		return false;
+	if (readLE32(pHeader) != OVC3860_ProfileMagic || readLE16(pHeader + 4) != OVC3860_ProfileLayout)
+		return false;
+	uint16_t runs = readLE16(pHeader + 6);
+	uint32_t length = readLE32(pHeader + 8);
+	if (length != size - OVC3860_ProfileHeaderLength)
+		return false;
+	const uint8_t* pPayload = pHeader + OVC3860_ProfileHeaderLength;
+	uint32_t crc = OVC3860ConfigCache::crc32(pHeader, OVC3860_ProfileHeaderLength - 4);
+	if (readLE32(pHeader + 16) != OVC3860ConfigCache::crc32(pPayload, length, crc))
+		return false;
+
+	uint32_t position = 0;
+	uint32_t previousEnd = 0;
+	for (uint16_t i = 0; i < runs; i++)
+	{
+		if (length - position < OVC3860_ProfileRunHeaderLength)
+			return false;
+		uint16_t address = readLE16(pPayload + position);
+		uint16_t runLength = readLE16(pPayload + position + 2);
+		position += OVC3860_ProfileRunHeaderLength;
+		if (runLength == 0 || runLength > length - position
+				|| address < previousEnd || (uint32_t) address + runLength > OVC3860_ProfileMaxAddress)
+			return false;
+		previousEnd = (uint32_t) address + runLength;
+		position += runLength;
+	}
+	if (position != length)
+		return false;
+
+	pRuns = pPayload;
+	payloadLength = length;
+	runCount = runs;
+	profileVersion = readLE32(pHeader + 12);
+	return true;
+}
+
+/**
+  * @brief	Write loaded profile to module.
+  * @note	Blocking. Module is reset by enterConfigMode(),
+  * 		 all runs are written by OVC3860PSKey::writePSKey()
+  * 		 and quitConfigMode() is sent. Empty profile does
+  * 		 not reset module.
+  *
+  * @param	PSKey - PSKey mode object of module
+  * @retval	false - profile is not loaded or module did not answer
+  */
+bool OVC3860PSKeyProfile::apply(OVC3860PSKey& PSKey) const{
+	uint32_t position = 0;
+
+	if (pRuns == 0)
+		return false;
+	if (runCount == 0)
+		return true;
+	if (!PSKey.enterConfigMode())
+		return false;
+	for (uint16_t i = 0; i < runCount; i++)
+	{
+		uint16_t address = readLE16(pRuns + position);
+		uint16_t length = readLE16(pRuns + position + 2);
+		if (!PSKey.writePSKey(address, pRuns + position + OVC3860_ProfileRunHeaderLength, length))
+		{
+			PSKey.quitConfigMode();
+			return false;
+		}
+		position += OVC3860_ProfileRunHeaderLength + length;
+	}
+	return PSKey.quitConfigMode();
+}
+
+bool OVC3860PSKeyProfile::isLoaded(void) const{
+	return pRuns != 0;
+}
+
+uint16_t OVC3860PSKeyProfile::getRunCount(void) const{
+	return runCount;
+}
+
+/**
+  * @brief	Get run of loaded profile.
+  * @note	Runs are walked from the first one, profile
+  * 		 is small and it is not done in hot path.
+  *
+  * @param	index - 0..getRunCount()-1
+  * @param	pAddress - PSKey address of the first byte
+  * @param	pLength - number of bytes
+  * @param	ppData - pointer to data inside profile
+  * @retval	false - no such run
+  */
+bool OVC3860PSKeyProfile::getRun(uint16_t index, uint16_t* pAddress, uint16_t* pLength, const uint8_t** ppData) const{
+	uint32_t position = 0;
+
+	if (pRuns == 0 || index >= runCount)
+		return false;
+	for (uint16_t i = 0; i < index; i++)
+		position += OVC3860_ProfileRunHeaderLength + readLE16(pRuns + position + 2);
+	*pAddress = readLE16(pRuns + position);
+	*pLength = readLE16(pRuns + position + 2);
+	*ppData = pRuns + position + OVC3860_ProfileRunHeaderLength;
+	return true;
+}
+
+uint32_t OVC3860PSKeyProfile::getProfileVersion(void) const{
+	return profileVersion;
+}
+
+/**
+  * @brief	Number of write frames sent by apply().
+  */
+uint32_t OVC3860PSKeyProfile::getFrameCount(void) const{
+	uint32_t frames = 0;
+	uint32_t position = 0;
+
+	if (pRuns == 0)
+		return 0;
+	for (uint16_t i = 0; i < runCount; i++)
+	{
+		uint16_t length = readLE16(pRuns + position + 2);
+		frames += (length + OVC3860_PSKeyMaxPayload - 1) / OVC3860_PSKeyMaxPayload;
+		position += OVC3860_ProfileRunHeaderLength + length;
+	}
+	return frames;
+}
@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PSKeyProfile.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 PSKey profile class.
+  *          This file provides code to check and apply binary PSKey
+  *          profile (built by tools/OVC3860_ProfileCompiler.cpp from
+  *          datasheets/OVC3860_memmap.txt and overrides).
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_PSKEYPROFILE_H_
+#define OVC3860_PSKEYPROFILE_H_
+
+#include "OVC3860PSKey.h"
+
+#define	OVC3860_ProfileMagic			0x5053564F	//"OVSP", marks PSKey profile
+#define	OVC3860_ProfileLayout			1			//change it when profile format changes, old profiles are rejected
+#define	OVC3860_ProfileHeaderLength		20			//magic(4), layout(2), runs(2), payload length(4), profile version(4), CRC-32(4)
+#define	OVC3860_ProfileRunHeaderLength	4			//address(2), length(2)
+#define	OVC3860_ProfileMaxAddress		OVC3860_PSKeyMaxAddress
+
+
+/*
+ * OVC3860PSKeyProfile is class to apply PSKey profile (blob) to module.
+ *
+ * Profile format, all numbers are little endian:
+ *  header:	magic		uint32	OVC3860_ProfileMagic
+ *  		layout		uint16	OVC3860_ProfileLayout
+ *  		runs		uint16	number of runs
+ *  		payload		uint32	length of all runs in bytes
+ *  		version		uint32	profile version given by author of profile
+ *  		crc			uint32	CRC-32 (OVC3860ConfigCache::crc32) of header
+ *  					 bytes before crc and whole payload
+ *  run:	address		uint16	PSKey address of the first byte
+ *  		length		uint16	number of data bytes
+ *  		data		length bytes
+ *
+ * Runs are sorted by address and do not overlap. Adjacent PSKeys are
+ *  merged into one run by profile compiler, so apply() sends min.
+ *  number of OVC3860_PSKeyMaxPayload write frames.
+ *
+ * Profile is not copied, it may stay in flash (i.e. in section
+ *  written by production tool).
+ */
+class OVC3860PSKeyProfile{
+public:
+	OVC3860PSKeyProfile(void);
+
+	bool 		load(const void* pProfile, size_t size);		//false - profile is damaged or has different layout
+	bool 		apply(OVC3860PSKey& PSKey) const;				//one config mode session, false - module did not answer
+	bool 		isLoaded(void) const;
+	uint16_t 	getRunCount(void) const;
+	bool 		getRun(uint16_t index, uint16_t* pAddress, uint16_t* pLength, const uint8_t** ppData) const;
+	uint32_t 	getProfileVersion(void) const;
+	uint32_t 	getFrameCount(void) const;						//write frames sent by apply()
+
+	static void buildHeader(uint8_t* pHeader, uint16_t runs, const uint8_t* pPayload, uint32_t payloadLength, uint32_t profileVersion);	//used by profile compiler
+
+private:
+	static uint16_t	readLE16(const uint8_t* pData);
+	static uint32_t	readLE32(const uint8_t* pData);
+	static void		writeLE16(uint8_t* pData, uint16_t value);
+	static void		writeLE32(uint8_t* pData, uint32_t value);
+
+	const uint8_t*	pRuns = 0;					//payload of loaded profile, 0 - not loaded
+	uint32_t		payloadLength = 0;
+	uint16_t		runCount = 0;
+	uint32_t		profileVersion = 0;
+};
+
+#endif /* OVC3860_PSKEYPROFILE_H_ */
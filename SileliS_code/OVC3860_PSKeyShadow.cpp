@@ -0,0 +1,254 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PSKeyShadow.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 PSKey shadow class.
+  *          This file provides code to keep RAM copy of chosen PSKeys,
+  *          so they are read without config mode and all changes are
+  *          written back in one config mode session.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_PSKeyShadow.h"
+#include <string.h>
+
+/**
+  * @brief	Object constructor
+  * @note	Shadow is empty until addRange().
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860PSKeyShadow::OVC3860PSKeyShadow(void){
+	memset(ranges, 0, sizeof(ranges));
+	memset(data, 0, sizeof(data));
+	memset(dirtyMask, 0, sizeof(dirtyMask));
+}
+
+/**
+  * @brief	Register PSKey range kept in RAM.
+  * @note	Range is not loaded until synchronize().
+  *
+  * @param	address - PSKey address of the first byte, i.e. OVC3860_PSKEY_ADDR_NAME
+  * @param	length - number of bytes, i.e. OVC3860_PSKeyNameLength
+  * @retval	false - OVC3860_ShadowMaxRanges / OVC3860_ShadowSize is
+  * 		 exceeded or range overlaps already registered one
+  */
+bool OVC3860PSKeyShadow::addRange(uint16_t address, uint16_t length){
+	if (length == 0 || rangesCount >= OVC3860_ShadowMaxRanges || length > OVC3860_ShadowSize - dataUsed)
+		return false;
+	for (uint8_t i = 0; i < rangesCount; i++)
+		if (address < ranges[i].address + ranges[i].length && ranges[i].address < address + length)
+			return false;
+
+	shadowRange& range = ranges[rangesCount++];
+	range.address = address;
+	range.length = length;
+	range.offset = dataUsed;
+	range.isLoaded = false;
+	dataUsed += length;
+	return true;
+}
+
+/**
+  * @brief	Find registered range which contains whole
+  * 		 [address, address + length).
+  * @retval	0 - not found
+  */
+OVC3860PSKeyShadow::shadowRange* OVC3860PSKeyShadow::findRange(uint16_t address, uint16_t length){
+	for (uint8_t i = 0; i < rangesCount; i++)
+		if (address >= ranges[i].address && (uint32_t) address + length <= (uint32_t) ranges[i].address + ranges[i].length)
+			return &ranges[i];
+	return 0;
+}
+
+const OVC3860PSKeyShadow::shadowRange* OVC3860PSKeyShadow::findRange(uint16_t address, uint16_t length) const{
+	return const_cast<OVC3860PSKeyShadow*>(this)->findRange(address, length);
+}
+
+/**
+  * @brief	Dirty mask access, position is index of data[].
+  */
+bool OVC3860PSKeyShadow::isDirtyByte(uint16_t position) const{
+	return (dirtyMask[position / 8] & (1u << (position % 8))) != 0;
+}
+
+void OVC3860PSKeyShadow::setDirtyByte(uint16_t position, bool isDirty){
+	if (isDirty)
+		dirtyMask[position / 8] |= (uint8_t) (1u << (position % 8));
+	else
+		dirtyMask[position / 8] &= (uint8_t) ~(1u << (position % 8));
+}
+
+bool OVC3860PSKeyShadow::isRangeDirty(const shadowRange& range) const{
+	for (uint16_t i = 0; i < range.length; i++)
+		if (isDirtyByte(range.offset + i))
+			return true;
+	return false;
+}
+
+/**
+  * @brief	Read PSKeys from RAM.
+  * @note	Module is not contacted. Not written back
+  * 		 changes are returned.
+  *
+  * @param	address - PSKey address of the first byte
+  * @param	pData - destination, at least length long
+  * @param	length - number of bytes
+  * @retval	false - range is not registered or not loaded yet
+  */
+bool OVC3860PSKeyShadow::read(uint16_t address, void* pData, uint16_t length) const{
+	const shadowRange* pRange = findRange(address, length);
+
+	if (pRange == 0 || !pRange->isLoaded)
+		return false;
+	memcpy(pData, &data[pRange->offset + (address - pRange->address)], length);
+	return true;
+}
+
+/**
+  * @brief	Change PSKeys in RAM.
+  * @note	Only changed bytes are marked dirty, writing the
+  * 		 same value does not cause config mode session.
+  * 		Before range is loaded every written byte is dirty,
+  * 		 bytes which were not written are not sent to
+  * 		 module.
+  * 		Module is changed by synchronize().
+  *
+  * @param	address - PSKey address of the first byte
+  * @param	pData - new value
+  * @param	length - number of bytes
+  * @retval	false - data are not inside one registered range
+  */
+bool OVC3860PSKeyShadow::write(uint16_t address, const void* pData, uint16_t length){
+	shadowRange* pRange = findRange(address, length);
+	const uint8_t* pByte = (const uint8_t*) pData;
+
+	if (pRange == 0)
+		return false;
+	uint16_t position = pRange->offset + (address - pRange->address);
+	for (uint16_t i = 0; i < length; i++)
+	{
+		if (data[position + i] == pByte[i] && pRange->isLoaded)
+			continue;
+		data[position + i] = pByte[i];
+		setDirtyByte(position + i, true);
+	}
+	return true;
+}
+
+/**
+  * @brief	Write each contiguous run of dirty bytes of range.
+  * @retval	false - at least one run was not written, it stays dirty
+  */
+bool OVC3860PSKeyShadow::writeDirtyRuns(OVC3860PSKey& PSKey, const shadowRange& range){
+	bool retVal = true;
+	uint16_t from = 0;
+
+	while (from < range.length)
+	{
+		if (!isDirtyByte(range.offset + from))
+		{
+			from++;
+			continue;
+		}
+		uint16_t to = from;
+		while (to < range.length && isDirtyByte(range.offset + to))
+			to++;
+		if (PSKey.writePSKey(range.address + from, &data[range.offset + from], to - from))
+			for (uint16_t i = from; i < to; i++)
+				setDirtyByte(range.offset + i, false);
+		else
+			retVal = false;
+		from = to;
+	}
+	return retVal;
+}
+
+/**
+  * @brief	Write dirty bytes and read not loaded ranges
+  * 		 in one config mode session.
+  * @note	Blocking, module is reset by enterConfigMode()
+  * 		 and quitConfigMode() is sent at the end, so
+  * 		 Bluetooth link is lost. Nothing is done (no reset)
+  * 		 when shadow is clean and loaded.
+  * 		Dirty bytes are written (each contiguous run with
+  * 		 own writePSKey()) before range is read, so
+  * 		 written value is confirmed by read.
+  *
+  * @param	PSKey - PSKey mode object of module
+  * @retval	false - config mode was not entered or module did not
+  * 		 answer, not written ranges stay dirty
+  */
+bool OVC3860PSKeyShadow::synchronize(OVC3860PSKey& PSKey){
+	bool retVal = true;
+
+	if (!isDirty() && isLoaded())
+		return true;
+
+	sessionCount++;
+	if (!PSKey.enterConfigMode())
+		return false;
+	for (uint8_t i = 0; i < rangesCount; i++)
+	{
+		shadowRange& range = ranges[i];
+		if (!writeDirtyRuns(PSKey, range))
+		{
+			retVal = false;
+			continue;								//read would overwrite not written bytes
+		}
+		if (!range.isLoaded)
+		{
+			if (PSKey.readPSKey(range.address, &data[range.offset], range.length))
+				range.isLoaded = true;
+			else
+				retVal = false;
+		}
+	}
+	return PSKey.quitConfigMode() && retVal;
+}
+
+/**
+  * @brief	Forget loaded values, dirty bytes are kept
+  * 		 and written by next synchronize().
+  */
+void OVC3860PSKeyShadow::invalidate(void){
+	for (uint8_t i = 0; i < rangesCount; i++)
+		ranges[i].isLoaded = false;
+}
+
+/**
+  * @brief	Check if any byte waits for synchronize().
+  */
+bool OVC3860PSKeyShadow::isDirty(void) const{
+	for (uint8_t i = 0; i < rangesCount; i++)
+		if (isRangeDirty(ranges[i]))
+			return true;
+	return false;
+}
+
+bool OVC3860PSKeyShadow::isLoaded(void) const{
+	for (uint8_t i = 0; i < rangesCount; i++)
+		if (!ranges[i].isLoaded)
+			return false;
+	return true;
+}
+
+uint32_t OVC3860PSKeyShadow::getSessionCount(void) const{
+	return sessionCount;
+}
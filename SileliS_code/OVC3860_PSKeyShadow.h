@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PSKeyShadow.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 PSKey shadow class.
+  *          This file provides code to keep RAM copy of chosen PSKeys,
+  *          so they are read without config mode and all changes are
+  *          written back in one config mode session.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_PSKEYSHADOW_H_
+#define OVC3860_PSKEYSHADOW_H_
+
+#include "OVC3860PSKey.h"
+
+#define	OVC3860_ShadowMaxRanges		8		//max. number of PSKey ranges kept in RAM
+#define	OVC3860_ShadowSize			128		//bytes, sum of all ranges lengths
+
+
+/*
+ * OVC3860PSKeyShadow is RAM copy of PSKey ranges chosen by application
+ *  (i.e. localname, pincode, uart_baudrate).
+ *
+ * Every OVC3860PSKey::enterConfigMode() resets module, so Bluetooth
+ *  link is dropped for 500+ ms. With shadow:
+ *  - addRange() registers PSKeys once,
+ *  - read() / write() work on RAM only, write() marks changed bytes dirty
+ *    (byte by byte, so bytes which were never written are not sent),
+ *  - synchronize() is called when application chooses (i.e. no call,
+ *    no music), it writes all dirty bytes and reads not loaded ranges
+ *    in ONE config mode session. Without dirty / not loaded ranges
+ *    module is not reset at all.
+ *
+ * Example:
+ * 	Shadow.addRange(OVC3860_PSKEY_ADDR_NAME, OVC3860_PSKeyNameLength);
+ * 	Shadow.synchronize(PSKeyDevice);					//the first load
+ * 	Shadow.write(OVC3860_PSKEY_ADDR_NAME, "Car", 4);
+ * 	...
+ * 	if (Shadow.isDirty() && isModuleIdle)
+ * 		Shadow.synchronize(PSKeyDevice);
+ */
+class OVC3860PSKeyShadow{
+public:
+	OVC3860PSKeyShadow(void);
+
+	bool 		addRange(uint16_t address, uint16_t length);		//false - no space or overlaps other range
+	bool 		read(uint16_t address, void* pData, uint16_t length) const;		//false - not registered or not loaded yet
+	bool 		write(uint16_t address, const void* pData, uint16_t length);	//false - not registered in one range
+	bool 		synchronize(OVC3860PSKey& PSKey);					//one config mode session, false - module did not answer
+	void 		invalidate(void);									//ranges are read again by next synchronize()
+
+	bool 		isDirty(void) const;
+	bool 		isLoaded(void) const;								//all ranges were read
+	uint32_t 	getSessionCount(void) const;						//number of config mode sessions (module resets)
+
+private:
+	struct shadowRange{
+		uint16_t	address;
+		uint16_t	length;
+		uint16_t	offset;				//position in data[]
+		bool		isLoaded;
+	};
+	shadowRange*	findRange(uint16_t address, uint16_t length);
+	const shadowRange*	findRange(uint16_t address, uint16_t length) const;
+	bool 			isDirtyByte(uint16_t position) const;			//position in data[]
+	void 			setDirtyByte(uint16_t position, bool isDirty);
+	bool 			isRangeDirty(const shadowRange& range) const;
+	bool 			writeDirtyRuns(OVC3860PSKey& PSKey, const shadowRange& range);
+
+	shadowRange		ranges[OVC3860_ShadowMaxRanges];
+	uint8_t			rangesCount = 0;
+	uint8_t			data[OVC3860_ShadowSize];
+	uint8_t			dirtyMask[(OVC3860_ShadowSize + 7) / 8];		//bit per data[] byte waiting for synchronize()
+	uint16_t		dataUsed = 0;
+	uint32_t		sessionCount = 0;
+};
+
+#endif /* OVC3860_PSKEYSHADOW_H_ */
@@ -0,0 +1,187 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PollScheduler.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 status polling scheduler class.
+  *          This file provides code to merge HFP / A2DP / AVRCP status
+  *          query triggers, so module is not flooded with #CY, #MV, #MO.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_PollScheduler.h"
+#include <string.h>
+
+/**
+  * @brief	Object constructor
+  * @note	n/a
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860PollScheduler::OVC3860PollScheduler(void){
+	memset(Polls, 0, sizeof(Polls));
+}
+
+/**
+  * @brief	Set min. time between two queries of the same
+  * 		 status type.
+  *
+  * @param	newInterval - ms, 0 means that every trigger is
+  * 		 sent with next periodicTask(void) call
+  * @retval	n/a
+  */
+void OVC3860PollScheduler::setInterval(uint32_t newInterval){
+	interval = newInterval;
+}
+
+/**
+  * @brief	Min. time between two queries of the same status type.
+  */
+uint32_t OVC3860PollScheduler::getInterval(void) const{
+	return interval;
+}
+
+/**
+  * @brief	Status of given type should be queried.
+  * @note	If status is already dirty the trigger is merged
+  * 		 with waiting one.
+  *
+  * @param	status - status type
+  * @retval	n/a
+  */
+void OVC3860PollScheduler::markDirty(statusType status){
+	statusPoll* pPoll = &Polls[status];
+
+	pPoll->triggers++;
+	if (pPoll->dirty)
+		pPoll->savedQueries++;
+	pPoll->dirty = true;
+}
+
+/**
+  * @brief	Check if status is waiting for query.
+  */
+bool OVC3860PollScheduler::isDirty(statusType status) const{
+	return Polls[status].dirty;
+}
+
+/**
+  * @brief	Query had been sent (by application or by
+  * 		 periodicTask(void)).
+  * @note	Waiting trigger is satisfied by this query.
+  *
+  * @param	status - status type
+  * @param	timeStamp - actual time in ms
+  * @retval	n/a
+  */
+void OVC3860PollScheduler::querySent(statusType status, uint32_t timeStamp){
+	statusPoll* pPoll = &Polls[status];
+
+	if (pPoll->dirty)
+	{
+		pPoll->dirty = false;
+		pPoll->savedQueries++;
+	}
+	pPoll->everSent = true;
+	pPoll->lastSentTime = timeStamp;
+}
+
+/**
+  * @brief	Check if query should be sent now.
+  * @note	True result clears dirty flag and is counted as
+  * 		 sent query.
+  *
+  * @param	status - status type
+  * @param	timeStamp - actual time in ms
+  * @retval	true - send query now
+  */
+bool OVC3860PollScheduler::isQueryDue(statusType status, uint32_t timeStamp){
+	statusPoll* pPoll = &Polls[status];
+
+	if (!pPoll->dirty)
+		return false;
+	if (pPoll->everSent && (timeStamp - pPoll->lastSentTime) < interval)
+		return false;
+
+	pPoll->dirty = false;
+	pPoll->everSent = true;
+	pPoll->lastSentTime = timeStamp;
+	pPoll->queries++;
+	return true;
+}
+
+/**
+  * @brief	Time left to the nearest query of dirty status.
+  * @note	Used by OVC3860::getTimeToNextDeadline(void), so MCU
+  * 		 may sleep until isQueryDue() can return true.
+  *
+  * @param	timeStamp - actual time in ms
+  * @param	pTimeLeft - ms, 0 if query is already due
+  * @retval	false - no status is dirty, pTimeLeft is not changed
+  */
+bool OVC3860PollScheduler::getTimeToNextQuery(uint32_t timeStamp, uint32_t* pTimeLeft) const{
+	bool isScheduled = false;
+
+	for (uint8_t i = 0; i < statusType_count; i++)
+	{
+		const statusPoll* pPoll = &Polls[i];
+		uint32_t statusTimeLeft = 0;
+
+		if (!pPoll->dirty)
+			continue;
+		if (pPoll->everSent && (timeStamp - pPoll->lastSentTime) < interval)
+			statusTimeLeft = interval - (timeStamp - pPoll->lastSentTime);
+		if (!isScheduled || statusTimeLeft < *pTimeLeft)
+			*pTimeLeft = statusTimeLeft;
+		isScheduled = true;
+	}
+	return isScheduled;
+}
+
+/**
+  * @brief	Number of query triggers of given status type.
+  */
+uint32_t OVC3860PollScheduler::getTriggers(statusType status) const{
+	return Polls[status].triggers;
+}
+
+/**
+  * @brief	Number of queries sent by scheduler.
+  */
+uint32_t OVC3860PollScheduler::getQueries(statusType status) const{
+	return Polls[status].queries;
+}
+
+/**
+  * @brief	Number of triggers that did not cause own query.
+  */
+uint32_t OVC3860PollScheduler::getSavedQueries(statusType status) const{
+	return Polls[status].savedQueries;
+}
+
+/**
+  * @brief	Clear counters, dirty flags are not changed.
+  */
+void OVC3860PollScheduler::resetStatistics(void){
+	for (uint8_t i = 0; i < statusType_count; i++)
+	{
+		Polls[i].triggers = 0;
+		Polls[i].queries = 0;
+		Polls[i].savedQueries = 0;
+	}
+}
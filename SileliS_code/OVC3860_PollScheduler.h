@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PollScheduler.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 status polling scheduler class.
+  *          This file provides code to merge HFP / A2DP / AVRCP status
+  *          query triggers, so module is not flooded with #CY, #MV, #MO.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_POLLSCHEDULER_H_
+#define OVC3860_POLLSCHEDULER_H_
+
+#include <stdint.h>
+
+#define	OVC3860_StatusPollInterval		500		//ms, min. time between two queries of the same status type
+
+
+/*
+ * OVC3860PollScheduler is class which merges status query triggers.
+ * OVC3860::decodeReceivedString(void) only marks status as dirty,
+ *  OVC3860::periodicTask(void) sends query when isQueryDue() returns
+ *  true, so at most one query per status type is sent within
+ *  OVC3860_StatusPollInterval. Triggers that arrive before query
+ *  is sent are merged and counted as saved queries.
+ */
+class OVC3860PollScheduler{
+public:
+	OVC3860PollScheduler(void);
+
+	enum statusType
+	{
+		HFPStatus,				//#CY, queryHFPStatus() called by application
+		A2DPStatus,				//#MV, indications handled by decodeReceivedString(void) and queryA2DPStatus()
+		AVRCPStatus,			//#MO, queryAvrcpStatus() called by application
+		statusType_count
+	};
+
+	void 		setInterval(uint32_t newInterval);
+	uint32_t 	getInterval(void) const;
+
+	void 		markDirty(statusType status);
+	bool 		isDirty(statusType status) const;
+	void 		querySent(statusType status, uint32_t timeStamp);
+	bool 		isQueryDue(statusType status, uint32_t timeStamp);
+	bool 		getTimeToNextQuery(uint32_t timeStamp, uint32_t* pTimeLeft) const;	//false - no status is dirty
+
+	uint32_t 	getTriggers(statusType status) const;		//number of markDirty() calls
+	uint32_t 	getQueries(statusType status) const;		//number of queries sent
+	uint32_t 	getSavedQueries(statusType status) const;	//number of triggers merged into other query
+	void 		resetStatistics(void);
+
+private:
+	struct statusPoll
+	{
+		bool		dirty;
+		bool		everSent;
+		uint32_t	lastSentTime;
+		uint32_t	triggers;
+		uint32_t	queries;
+		uint32_t	savedQueries;
+	};
+
+	uint32_t 	interval = OVC3860_StatusPollInterval;
+	statusPoll	Polls[statusType_count];
+};
+
+#endif /* OVC3860_POLLSCHEDULER_H_ */
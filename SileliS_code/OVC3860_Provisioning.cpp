@@ -0,0 +1,441 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_Provisioning.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 provisioning station classes.
+  *          This file provides code to write PSKey profiles to many
+  *          modules at once (one UART per seat), with non-blocking
+  *          config mode sessions.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_Provisioning.h"
+#include <string.h>
+
+static const uint8_t welcomeMessage[7] 		= {0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00};
+static const uint8_t enterConfigMessage[9] 	= {0xC5, 0xC7, 0xC7, 0xC9, 0xD0, 0xD7, 0xC9, 0xD1, 0xCD};
+static const uint8_t enterConfigACK[7]		= {0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00};
+static const uint8_t quitConfigMessage[4]	= {0x50, 0x00, 0x00, 0x00};
+#define	OVC3860_SessionWriteType			0x3		//see OVC3860PSKey::CommandType
+#define	OVC3860_SessionWriteACKType			0x4
+#define	OVC3860_SessionQuitACKType			0x6
+
+
+/**
+  * @brief	Session constructor
+  *
+  * @param	Transport - transport object (handle) of seat, it is copied
+  * @retval	n/a
+  */
+OVC3860PSKeySession::OVC3860PSKeySession(const OVC3860Transport& Transport)
+					:OVC3860HardWare(Transport)
+{
+}
+
+#ifdef OVC3860_TRANSPORT_STM32HAL
+OVC3860PSKeySession::OVC3860PSKeySession(UART_HandleTypeDef* huart, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin)
+					:OVC3860HardWare(huart, ResetGPIOx, GPIO_Pin)
+{
+}
+#endif
+
+/**
+  * @brief	Start writing profile to module.
+  * @note	Module is reset at once (startReset()), the rest
+  * 		 is done by service().
+  *
+  * @param	pProfile - loaded profile, it has to exist until
+  * 		 session ends
+  * @retval	false - session is running or profile is not loaded
+  */
+bool OVC3860PSKeySession::start(const OVC3860PSKeyProfile* pProfile){
+	if (isRunning() || pProfile == 0 || !pProfile->isLoaded())
+		return false;
+
+	this->pProfile = pProfile;
+	runIndex = 0;
+	runOffset = 0;
+	framesDone = 0;
+	framesTotal = pProfile->getFrameCount();
+	error = ErrorNone;
+	received.resetCircularBuffer();				//old bytes of previous unit
+	sessionStart = getTick();
+	startReset();
+	state = SessionReset;
+	return true;
+}
+
+/**
+  * @brief	Get data from module.
+  * @note	Execute it in UART receive interrupt of seat.
+  */
+void OVC3860PSKeySession::getData(uint8_t RxBuff){
+	received.put(RxBuff);
+}
+
+bool OVC3860PSKeySession::isReplyTimeout(uint32_t timeStamp) const{
+	return (timeStamp - replyStart) > OVC3860_PSKeyReplyTimeout;
+}
+
+void OVC3860PSKeySession::finish(sessionState newState, sessionError newError){
+	state = newState;
+	error = newError;
+	duration = getTick() - sessionStart;
+}
+
+/**
+  * @brief	Leave config mode after failed write.
+  * @note	Module has part of profile and it is still in
+  * 		 config mode, so quit config mode is sent and
+  * 		 failure is reported when it is confirmed
+  * 		 (SessionAbort). If quit can not be sent, module
+  * 		 is held in reset at once.
+  *
+  * @param	newError - error reported by SessionFailed
+  * @retval	n/a
+  */
+void OVC3860PSKeySession::abort(sessionError newError){
+	abortError = newError;
+	state = SessionAbort;
+	replyStart = getTick();
+	if (!transport.transmit(quitConfigMessage, sizeof(quitConfigMessage)))
+	{
+		resetLow();
+		finish(SessionFailed, newError);
+	}
+}
+
+/**
+  * @brief	Build and start next write frame.
+  * @note	Frame is header + max. OVC3860_PSKeyMaxPayload
+  * 		 bytes of actual run, like OVC3860PSKey::writePSKey().
+  *
+  * @retval	false - transport did not start transmission
+  */
+bool OVC3860PSKeySession::sendFrame(void){
+	uint16_t address;
+	uint16_t length;
+	const uint8_t* pData;
+
+	pProfile->getRun(runIndex, &address, &length, &pData);
+	uint16_t frameLength = length - runOffset;
+	if (frameLength > OVC3860_PSKeyMaxPayload)
+		frameLength = OVC3860_PSKeyMaxPayload;
+	address += runOffset;
+
+	frame[0] = (uint8_t) (OVC3860_SessionWriteType << 4) | (uint8_t) (address >> 8);
+	frame[1] = (uint8_t) address;
+	frame[2] = (uint8_t) (frameLength >> 8);
+	frame[3] = (uint8_t) frameLength;
+	memcpy(&frame[OVC3860_PSKeyHeaderLength], pData + runOffset, frameLength);
+	runOffset += frameLength;
+	if (runOffset >= length)
+	{
+		runIndex++;
+		runOffset = 0;
+	}
+	replyStart = getTick();
+	return transport.transmit(frame, OVC3860_PSKeyHeaderLength + frameLength);
+}
+
+/**
+  * @brief	Send next write frame or quit config mode.
+  * @retval	false - transport did not start transmission
+  */
+bool OVC3860PSKeySession::sendNext(void){
+	if (runIndex < pProfile->getRunCount())
+	{
+		state = SessionWrite;
+		return sendFrame();
+	}
+	state = SessionQuit;
+	replyStart = getTick();
+	return transport.transmit(quitConfigMessage, sizeof(quitConfigMessage));
+}
+
+/**
+  * @brief	Move session forward.
+  * @note	Never blocks: it only checks received bytes,
+  * 		 time and starts non-blocking transmission.
+  * 		The next command is sent when module answer
+  * 		 to previous one is received, so transmitter
+  * 		 is always free here.
+  * 		Failure in config mode goes through SessionAbort
+  * 		 (quit config mode), module which does not quit
+  * 		 is held in reset.
+  *
+  * @param	n/a
+  * @retval	actual state of session
+  */
+OVC3860PSKeySession::sessionState OVC3860PSKeySession::service(void){
+	uint8_t answer[sizeof(welcomeMessage)];
+	uint8_t chunk[8];
+	uint16_t size;
+
+	while ((size = transport.receive(chunk, sizeof(chunk))) > 0)		//POSIX / loopback, STM32 uses getData()
+		received.putN(chunk, size);
+
+	uint32_t timeStamp = getTick();
+	switch (state)
+	{
+	case SessionReset:
+		if (serviceReset() == ResetTimeout)
+			finish(SessionFailed, ErrorNoWelcome);
+		else if (received.dataSize() >= sizeof(welcomeMessage))
+		{
+			received.getN(answer, sizeof(welcomeMessage));
+			if (memcmp(answer, welcomeMessage, sizeof(welcomeMessage)) != 0)
+				finish(SessionFailed, ErrorNoWelcome);
+			else
+			{
+				moduleReady();
+				state = SessionEnterConfig;
+				replyStart = timeStamp;
+				if (!transport.transmit(enterConfigMessage, sizeof(enterConfigMessage)))
+					finish(SessionFailed, ErrorTransmit);
+			}
+		}
+		break;
+	case SessionEnterConfig:
+		if (received.dataSize() >= sizeof(enterConfigACK))
+		{
+			received.getN(answer, sizeof(enterConfigACK));
+			if (memcmp(answer, enterConfigACK, sizeof(enterConfigACK)) != 0)
+				finish(SessionFailed, ErrorNoConfigMode);
+			else if (!sendNext())
+				abort(ErrorTransmit);
+		}
+		else if (isReplyTimeout(timeStamp))
+			finish(SessionFailed, ErrorNoConfigMode);
+		break;
+	case SessionWrite:
+		if (received.dataSize() >= OVC3860_PSKeyHeaderLength)
+		{
+			received.getN(answer, OVC3860_PSKeyHeaderLength);
+			if ((answer[0] >> 4) != OVC3860_SessionWriteACKType)
+				abort(ErrorWrite);
+			else
+			{
+				framesDone++;
+				if (!sendNext())
+					abort(ErrorTransmit);
+			}
+		}
+		else if (isReplyTimeout(timeStamp))
+			abort(ErrorWrite);
+		break;
+	case SessionQuit:
+		if (received.dataSize() >= OVC3860_PSKeyHeaderLength)
+		{
+			received.getN(answer, OVC3860_PSKeyHeaderLength);
+			if ((answer[0] >> 4) == OVC3860_SessionQuitACKType)
+				finish(SessionPassed, ErrorNone);
+			else
+			{
+				resetLow();
+				finish(SessionFailed, ErrorQuit);
+			}
+		}
+		else if (isReplyTimeout(timeStamp))
+		{
+			resetLow();
+			finish(SessionFailed, ErrorQuit);
+		}
+		break;
+	case SessionAbort:
+		while (received.dataSize() >= OVC3860_PSKeyHeaderLength)		//late write ACK may be before quit ACK
+		{
+			received.getN(answer, OVC3860_PSKeyHeaderLength);
+			if ((answer[0] >> 4) == OVC3860_SessionQuitACKType)
+			{
+				finish(SessionFailed, abortError);
+				break;
+			}
+		}
+		if (state == SessionAbort && isReplyTimeout(timeStamp))
+		{
+			resetLow();
+			finish(SessionFailed, abortError);
+		}
+		break;
+	default:
+		break;
+	}
+	return state;
+}
+
+bool OVC3860PSKeySession::isRunning(void) const{
+	return state != SessionIdle && state != SessionPassed && state != SessionFailed;
+}
+
+OVC3860PSKeySession::sessionState OVC3860PSKeySession::getState(void) const{
+	return state;
+}
+
+OVC3860PSKeySession::sessionError OVC3860PSKeySession::getError(void) const{
+	return error;
+}
+
+uint32_t OVC3860PSKeySession::getFramesDone(void) const{
+	return framesDone;
+}
+
+uint32_t OVC3860PSKeySession::getFramesTotal(void) const{
+	return framesTotal;
+}
+
+uint32_t OVC3860PSKeySession::getDuration(void) const{
+	return duration;
+}
+
+
+/**
+  * @brief	Station constructor
+  * @note	Seats are added by addSeat().
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860Provisioning::OVC3860Provisioning(void){
+	memset(seats, 0, sizeof(seats));
+	memset(isCounted, 0, sizeof(isCounted));
+}
+
+/**
+  * @brief	Add seat (module on its own UART).
+  * @retval	false - OVC3860_ProvisioningMaxSeats seats are already added
+  */
+bool OVC3860Provisioning::addSeat(OVC3860PSKeySession* pSession){
+	if (pSession == 0 || seatCount >= OVC3860_ProvisioningMaxSeats)
+		return false;
+	seats[seatCount] = pSession;
+	isCounted[seatCount] = true;				//nothing to count until start
+	seatCount++;
+	return true;
+}
+
+/**
+  * @brief	Start writing profile to unit in seat.
+  * @note	The first start begins throughput measurement.
+  *
+  * @param	seat - 0..getSeatCount()-1
+  * @param	pProfile - loaded profile
+  * @retval	false - no such seat, seat is busy or profile is not loaded
+  */
+bool OVC3860Provisioning::startSeat(uint8_t seat, const OVC3860PSKeyProfile* pProfile){
+	if (seat >= seatCount || !seats[seat]->start(pProfile))
+		return false;
+	isCounted[seat] = false;
+	if (!isStationStarted)
+	{
+		isStationStarted = true;
+		stationStart = seats[seat]->getTick();
+	}
+	return true;
+}
+
+/**
+  * @brief	Start all seats which are not busy.
+  * @retval	number of started seats
+  */
+uint8_t OVC3860Provisioning::startAll(const OVC3860PSKeyProfile* pProfile){
+	uint8_t started = 0;
+
+	for (uint8_t i = 0; i < seatCount; i++)
+		if (startSeat(i, pProfile))
+			started++;
+	return started;
+}
+
+/**
+  * @brief	Service all seats.
+  * @note	Each seat makes at most one step, so slow
+  * 		 module does not delay others. Finished sessions
+  * 		 are counted once.
+  */
+void OVC3860Provisioning::periodicTask(void){
+	for (uint8_t i = 0; i < seatCount; i++)
+	{
+		OVC3860PSKeySession::sessionState state = seats[i]->service();
+		if (isCounted[i])
+			continue;
+		if (state == OVC3860PSKeySession::SessionPassed)
+			passedUnits++;
+		else if (state == OVC3860PSKeySession::SessionFailed)
+			failedUnits++;
+		else
+			continue;
+		isCounted[i] = true;
+	}
+}
+
+/**
+  * @brief	Check if any seat is running.
+  */
+bool OVC3860Provisioning::isBusy(void) const{
+	for (uint8_t i = 0; i < seatCount; i++)
+		if (seats[i]->isRunning())
+			return true;
+	return false;
+}
+
+uint8_t OVC3860Provisioning::getSeatCount(void) const{
+	return seatCount;
+}
+
+/**
+  * @brief	Get seat session, i.e. for getState(), getError(),
+  * 		 getFramesDone() / getFramesTotal().
+  * @retval	0 - no such seat
+  */
+OVC3860PSKeySession* OVC3860Provisioning::getSeat(uint8_t seat) const{
+	return (seat < seatCount) ? seats[seat] : 0;
+}
+
+uint32_t OVC3860Provisioning::getPassedUnits(void) const{
+	return passedUnits;
+}
+
+uint32_t OVC3860Provisioning::getFailedUnits(void) const{
+	return failedUnits;
+}
+
+/**
+  * @brief	Station throughput.
+  * @note	Passed units per minute since the first start
+  * 		 after resetStatistics(), multiplied by 100
+  * 		 (i.e. 1250 is 12.5 units / minute).
+  */
+uint32_t OVC3860Provisioning::getUnitsPerMinuteX100(void) const{
+	if (!isStationStarted || seatCount == 0)
+		return 0;
+	uint32_t elapsed = seats[0]->getTick() - stationStart;
+	if (elapsed == 0)
+		return 0;
+	return (uint32_t) (((uint64_t) passedUnits * 60000 * 100) / elapsed);
+}
+
+/**
+  * @brief	Clear counters, throughput is measured again
+  * 		 from the next start.
+  */
+void OVC3860Provisioning::resetStatistics(void){
+	passedUnits = 0;
+	failedUnits = 0;
+	isStationStarted = false;
+}
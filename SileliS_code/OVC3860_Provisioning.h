@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_Provisioning.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 provisioning station classes.
+  *          This file provides code to write PSKey profiles to many
+  *          modules at once (one UART per seat), with non-blocking
+  *          config mode sessions.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_PROVISIONING_H_
+#define OVC3860_PROVISIONING_H_
+
+#include "OVC3860_PSKeyProfile.h"
+
+#define	OVC3860_SessionReceiveSize		32		//bytes received from module waiting for session state machine
+#define	OVC3860_ProvisioningMaxSeats	8		//max. number of seats (UARTs) of provisioning station
+
+
+/*
+ * OVC3860PSKeySession is non-blocking version of OVC3860PSKey
+ *  enterConfigMode() / writePSKey() / quitConfigMode() sequence,
+ *  used to write one OVC3860PSKeyProfile to one module.
+ *
+ * Each step only starts transmission or checks received bytes, so
+ *  many sessions run interleaved in one loop (OVC3860Provisioning).
+ *  Received bytes are delivered by getData() (STM32 HAL, from
+ *  HAL_UART_RxCpltCallback of seat UART) or read by service() with
+ *  transport receive() (POSIX, loopback).
+ *
+ * Config mode command has to be sent before module sends '\r\n'
+ *  after welcome message, so service() should be executed at least
+ *  every 1 ms while session is in SessionReset state.
+ *
+ * Failed session never leaves module in config mode: after failed write
+ *  quit config mode is sent (SessionAbort), module which does not
+ *  confirm it is held in reset until next start().
+ */
+class OVC3860PSKeySession: public OVC3860HardWare
+{
+public:
+	OVC3860PSKeySession(const OVC3860Transport& Transport);
+#ifdef OVC3860_TRANSPORT_STM32HAL
+	OVC3860PSKeySession(UART_HandleTypeDef* huart, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin);
+#endif
+
+	enum sessionState
+	{
+		SessionIdle,
+		SessionReset,				//reset pulse / waiting for welcome message
+		SessionEnterConfig,			//waiting for config mode ACK
+		SessionWrite,				//waiting for write frame ACK
+		SessionQuit,				//waiting for quit config mode ACK
+		SessionAbort,				//write failed, waiting for quit config mode ACK before SessionFailed
+		SessionPassed,
+		SessionFailed
+	};
+	enum sessionError
+	{
+		ErrorNone,
+		ErrorNoWelcome,				//no / wrong welcome message within OVC3860_ResetReadyTimeout
+		ErrorNoConfigMode,			//config mode was not confirmed
+		ErrorWrite,					//write frame was not confirmed
+		ErrorQuit,					//quit config mode was not confirmed
+		ErrorTransmit				//transport did not start transmission
+	};
+
+	bool 			start(const OVC3860PSKeyProfile* pProfile);	//false - session is running or profile is not loaded
+	sessionState	service(void);								//moves session forward, never blocks
+	void 			getData(uint8_t RxBuff);					//get data from module (UART interrupt)
+	bool 			isRunning(void) const;
+	sessionState	getState(void) const;
+	sessionError	getError(void) const;
+	uint32_t 		getFramesDone(void) const;					//progress: getFramesDone() of getFramesTotal()
+	uint32_t 		getFramesTotal(void) const;
+	uint32_t 		getDuration(void) const;					//ms of the latest finished session
+
+private:
+	bool 			sendNext(void);
+	bool 			sendFrame(void);
+	bool 			isReplyTimeout(uint32_t timeStamp) const;
+	void 			finish(sessionState state, sessionError error);
+	void 			abort(sessionError error);
+
+	CircularBuffer<uint8_t, OVC3860_SessionReceiveSize>	received;
+	uint8_t			frame[OVC3860_PSKeyHeaderLength + OVC3860_PSKeyMaxPayload];	//has to exist until transmission ends
+	const OVC3860PSKeyProfile*	pProfile = 0;
+	uint16_t		runIndex = 0;
+	uint16_t		runOffset = 0;				//bytes of actual run already written
+	uint32_t		framesDone = 0;
+	uint32_t		framesTotal = 0;
+	uint32_t		replyStart = 0;				//time stamp of the latest transmission
+	uint32_t		sessionStart = 0;
+	uint32_t		duration = 0;
+	sessionState	state = SessionIdle;
+	sessionError	error = ErrorNone;
+	sessionError	abortError = ErrorNone;		//reported when SessionAbort ends
+};
+
+
+/*
+ * OVC3860Provisioning is end-of-line station: one profile is written
+ *  to modules on all seats at the same time.
+ *
+ * Example:
+ * 	Station.addSeat(&Seat1);
+ * 	Station.addSeat(&Seat2);
+ * 	Station.startAll(&Profile);
+ * 	while (1)
+ * 	{
+ * 		Station.periodicTask();
+ * 		if (Seat1.getState() == OVC3860PSKeySession::SessionPassed && isNewUnitInSeat1)
+ * 			Station.startSeat(0, &Profile);
+ * 	}
+ */
+class OVC3860Provisioning{
+public:
+	OVC3860Provisioning(void);
+
+	bool 		addSeat(OVC3860PSKeySession* pSession);				//false - OVC3860_ProvisioningMaxSeats seats are already added
+	bool 		startSeat(uint8_t seat, const OVC3860PSKeyProfile* pProfile);
+	uint8_t 	startAll(const OVC3860PSKeyProfile* pProfile);		//returns number of started seats
+	void 		periodicTask(void);									//services all seats, execute it as frequent as possible
+	bool 		isBusy(void) const;
+	uint8_t 	getSeatCount(void) const;
+	OVC3860PSKeySession*	getSeat(uint8_t seat) const;			//per seat progress and result
+
+	uint32_t 	getPassedUnits(void) const;
+	uint32_t 	getFailedUnits(void) const;
+	uint32_t 	getUnitsPerMinuteX100(void) const;				//passed units per minute * 100 since the first start
+	void 		resetStatistics(void);
+
+private:
+	OVC3860PSKeySession*	seats[OVC3860_ProvisioningMaxSeats];
+	bool		isCounted[OVC3860_ProvisioningMaxSeats];			//result of finished session is already in statistics
+	uint8_t		seatCount = 0;
+	uint32_t	passedUnits = 0;
+	uint32_t	failedUnits = 0;
+	uint32_t	stationStart = 0;
+	bool		isStationStarted = false;
+};
+
+#endif /* OVC3860_PROVISIONING_H_ */
@@ -0,0 +1,69 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_Transport.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 transport selection.
+  *          This file selects at compile time which transport
+  *          (UART, reset line, time base) is used by OVC3860HardWare.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_TRANSPORT_H_
+#define OVC3860_TRANSPORT_H_
+
+/*
+ * Transport is a class with fixed set of non-virtual methods:
+ *
+ *	bool 		transmit(const uint8_t* pData, uint16_t size);				//start non-blocking transmission, data have to exist until isTransmitterFree()
+ *	bool 		isTransmitterFree(void) const;
+ *	void 		abortTransmit(void);										//stop non-blocking transmission, data may be reused
+ *	bool 		transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t timeout);
+ *	bool 		receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout);	//true - all "size" bytes received
+ *	uint16_t 	receive(uint8_t* pData, uint16_t maxSize);					//non-blocking, bytes which are not delivered by getData() from interrupt
+ *	void 		setResetLine(bool isRunning);								//true - module runs, false - module is held in reset
+ *	uint32_t 	getTick(void) const;										//ms
+ *	void 		delay(uint32_t ms);
+ *
+ * Transport object is only a handle (i.e. UART handle pointer, file
+ *  descriptor), it is copied into OVC3860HardWare, so there is no
+ *  virtual call and no pointer to transport.
+ *
+ * Uncomment one of the lines below (or define it in compiler options),
+ *  STM32 HAL is used if none is defined.
+ */
+//#define OVC3860_TRANSPORT_STM32HAL					//STM32 HAL UART in DMA mode, GPIO reset line
+//#define OVC3860_TRANSPORT_POSIX						//termios serial port i.e. /dev/ttyUSB0, DTR as reset line
+//#define OVC3860_TRANSPORT_LOOPBACK					//in-memory channel, module side is driven by application
+
+#if !defined(OVC3860_TRANSPORT_POSIX) && !defined(OVC3860_TRANSPORT_LOOPBACK)
+#define OVC3860_TRANSPORT_STM32HAL
+#endif
+
+#if defined(OVC3860_TRANSPORT_STM32HAL)
+#include "OVC3860_TransportSTM32.h"
+typedef OVC3860TransportSTM32		OVC3860Transport;
+#elif defined(OVC3860_TRANSPORT_POSIX)
+#include "OVC3860_TransportPOSIX.h"
+typedef OVC3860TransportPOSIX		OVC3860Transport;
+#elif defined(OVC3860_TRANSPORT_LOOPBACK)
+#include "OVC3860_TransportLoopback.h"
+typedef OVC3860TransportLoopback	OVC3860Transport;
+#endif
+
+#define	OVC3860_TransportMaxDelay	0xFFFFFFFF			//wait forever, equivalent of HAL_MAX_DELAY
+
+#endif /* OVC3860_TRANSPORT_H_ */
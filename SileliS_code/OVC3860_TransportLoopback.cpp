@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransportLoopback.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 in-memory loopback transport.
+  *          This file provides code to run OVC3860 classes without
+  *          module, application plays module role (simulation, host
+  *          debugging of parser).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_Transport.h"
+
+#ifdef OVC3860_TRANSPORT_LOOPBACK
+
+#include <string.h>
+
+/**
+  * @brief	Channel constructor
+  */
+OVC3860LoopbackChannel::OVC3860LoopbackChannel(void){
+}
+
+/**
+  * @brief	Module sends data to OVC3860 object.
+  * @note	Bytes which do not fit into channel are lost
+  * 		 as with real UART overrun.
+  */
+void OVC3860LoopbackChannel::moduleSend(const uint8_t* pData, size_t size){
+	for (size_t i = 0; i < size && !toHost.isFull(); i++)
+		toHost.put(pData[i]);
+}
+
+void OVC3860LoopbackChannel::moduleSend(const char* pString){
+	moduleSend((const uint8_t*) pString, strlen(pString));
+}
+
+/**
+  * @brief	Module reads data transmitted by OVC3860 object.
+  * @retval	number of bytes copied to pData
+  */
+size_t OVC3860LoopbackChannel::moduleReceive(uint8_t* pData, size_t maxSize){
+	size_t received = 0;
+	while (received < maxSize && !toModule.isEmpty())
+		pData[received++] = toModule.get();
+	return received;
+}
+
+/**
+  * @brief	Move virtual time forward.
+  */
+void OVC3860LoopbackChannel::advanceTime(uint32_t ms){
+	time += ms;
+}
+
+/**
+  * @brief	Let module simulation answer bytes waiting in toModule.
+  */
+void OVC3860LoopbackChannel::serviceModule(void){
+	if (handler)
+		handler(this, pHandlerContext);
+}
+
+/**
+  * @brief	Transport constructor
+  *
+  * @param	pChannel - channel shared with application
+  * @retval	n/a
+  */
+OVC3860TransportLoopback::OVC3860TransportLoopback(OVC3860LoopbackChannel* pChannel){
+	pLoopbackChannel = pChannel;
+}
+
+/**
+  * @brief	Data are copied to channel at once.
+  */
+bool OVC3860TransportLoopback::transmit(const uint8_t* pData, uint16_t size){
+	return transmitBlocking(pData, size, 0);
+}
+
+bool OVC3860TransportLoopback::isTransmitterFree(void) const{
+	return true;
+}
+
+/**
+  * @brief	Data are copied at once, nothing to abort.
+  */
+void OVC3860TransportLoopback::abortTransmit(void){
+}
+
+/**
+  * @brief	Copy data to channel.
+  * @retval	false - channel is full, data are not copied
+  */
+bool OVC3860TransportLoopback::transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t /*timeout*/){
+	if (OVC3860_LoopbackBufferSize - pLoopbackChannel->toModule.dataSize() < size)
+		return false;
+	for (uint16_t i = 0; i < size; i++)
+		pLoopbackChannel->toModule.put(pData[i]);
+	return true;
+}
+
+/**
+  * @brief	Read "size" bytes from channel.
+  * @note	Module answer has to be in channel before call
+  * 		 (or sent by channel handler), otherwise virtual
+  * 		 time moves by timeout and nothing is read.
+  *
+  * @retval	true - all data received
+  */
+bool OVC3860TransportLoopback::receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout){
+	pLoopbackChannel->serviceModule();
+	if (pLoopbackChannel->toHost.dataSize() < size)
+	{
+		if (timeout != OVC3860_TransportMaxDelay)
+			pLoopbackChannel->advanceTime(timeout);
+		return false;
+	}
+	return receive(pData, size) == size;
+}
+
+/**
+  * @brief	Non-blocking read of bytes sent by module.
+  * @retval	number of bytes copied to pData
+  */
+uint16_t OVC3860TransportLoopback::receive(uint8_t* pData, uint16_t maxSize){
+	uint16_t received = 0;
+	pLoopbackChannel->serviceModule();
+	while (received < maxSize && !pLoopbackChannel->toHost.isEmpty())
+		pData[received++] = pLoopbackChannel->toHost.get();
+	return received;
+}
+
+/**
+  * @brief	Reset line state is stored in channel.
+  */
+void OVC3860TransportLoopback::setResetLine(bool isRunning){
+	if (isRunning && !pLoopbackChannel->isModuleRunning)
+		pLoopbackChannel->resetCount++;
+	pLoopbackChannel->isModuleRunning = isRunning;
+}
+
+uint32_t OVC3860TransportLoopback::getTick(void) const{
+	return pLoopbackChannel->time;
+}
+
+/**
+  * @brief	Delay only moves virtual time.
+  */
+void OVC3860TransportLoopback::delay(uint32_t ms){
+	pLoopbackChannel->advanceTime(ms);
+}
+
+#endif /* OVC3860_TRANSPORT_LOOPBACK */
@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransportLoopback.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 in-memory loopback transport.
+  *          This file provides code to run OVC3860 classes without
+  *          module, application plays module role (simulation, host
+  *          debugging of parser).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_TRANSPORTLOOPBACK_H_
+#define OVC3860_TRANSPORTLOOPBACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "CircularBuffer.h"
+
+#define	OVC3860_LoopbackBufferSize	256					//defines how many bytes could wait in each direction
+
+
+/*
+ * OVC3860LoopbackChannel is in-memory "wire" between OVC3860 object
+ *  and application which plays module role:
+ *  - moduleSend() puts bytes that OVC3860 object will receive,
+ *  - moduleReceive() reads bytes transmitted by OVC3860 object,
+ *  - time is virtual, it moves only with advanceTime() and delay(),
+ *  - optional moduleHandler is called when OVC3860 object reads
+ *    channel, so module can answer commands of blocking calls.
+ */
+class OVC3860LoopbackChannel{
+public:
+	typedef void (*moduleHandler)(OVC3860LoopbackChannel* pChannel, void* pContext);
+
+	OVC3860LoopbackChannel(void);
+
+	void 		moduleSend(const uint8_t* pData, size_t size);
+	void 		moduleSend(const char* pString);					//i.e. moduleSend("IV\r\n");
+	size_t 		moduleReceive(uint8_t* pData, size_t maxSize);
+	void 		advanceTime(uint32_t ms);
+	void 		serviceModule(void);
+
+	CircularBuffer<uint8_t, OVC3860_LoopbackBufferSize>	toHost;		//module -> OVC3860 object
+	CircularBuffer<uint8_t, OVC3860_LoopbackBufferSize>	toModule;	//OVC3860 object -> module
+	uint32_t	time = 0;											//ms
+	bool		isModuleRunning = false;							//reset line state
+	uint32_t	resetCount = 0;										//number of reset line low -> high edges
+	moduleHandler	handler = 0;									//module simulation, 0 - application answers itself
+	void*		pHandlerContext = 0;
+};
+
+
+/*
+ * OVC3860TransportLoopback is transport working on
+ *  OVC3860LoopbackChannel. Object is only a handle to channel.
+ */
+class OVC3860TransportLoopback{
+public:
+	OVC3860TransportLoopback(OVC3860LoopbackChannel* pChannel);
+
+	bool 		transmit(const uint8_t* pData, uint16_t size);
+	bool 		isTransmitterFree(void) const;
+	void 		abortTransmit(void);
+	bool 		transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t timeout);
+	bool 		receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout);
+	uint16_t 	receive(uint8_t* pData, uint16_t maxSize);
+	void 		setResetLine(bool isRunning);
+	uint32_t 	getTick(void) const;
+	void 		delay(uint32_t ms);
+
+private:
+	OVC3860LoopbackChannel*	pLoopbackChannel;
+};
+
+#endif /* OVC3860_TRANSPORTLOOPBACK_H_ */
@@ -0,0 +1,262 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransportPOSIX.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 POSIX serial port transport.
+  *          This file provides code to contact with OVC3860 through
+  *          termios serial port (i.e. USB-UART converter /dev/ttyUSB0).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_Transport.h"
+
+#ifdef OVC3860_TRANSPORT_POSIX
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+
+/**
+  * @brief	Convert baudrate to termios speed.
+  * @retval	B0 if baudrate is not supported
+  */
+static speed_t baudrateToSpeed(uint32_t baudrate){
+	switch (baudrate)
+	{
+	case 1200:		return B1200;
+	case 2400:		return B2400;
+	case 4800:		return B4800;
+	case 9600:		return B9600;
+	case 19200:		return B19200;
+	case 38400:		return B38400;
+	case 57600:		return B57600;
+	case 115200:	return B115200;
+#ifdef B230400
+	case 230400:	return B230400;
+#endif
+#ifdef B460800
+	case 460800:	return B460800;
+#endif
+#ifdef B921600
+	case 921600:	return B921600;
+#endif
+	default:		return B0;
+	}
+}
+
+/**
+  * @brief	Transport constructor
+  * @note	Port is opened with open().
+  */
+OVC3860TransportPOSIX::OVC3860TransportPOSIX(void){
+}
+
+/**
+  * @brief	Open serial port in raw 8N1 non-blocking mode.
+  *
+  * @param	pDevice - path of serial device, i.e. "/dev/ttyUSB0"
+  * @param	baudrate - OVC3860 UART baudrate (PSKey uart_baudrate)
+  * @retval	true - port is opened and configured
+  */
+bool OVC3860TransportPOSIX::open(const char* pDevice, uint32_t baudrate){
+	struct termios options;
+	speed_t speed = baudrateToSpeed(baudrate);
+
+	if (speed == B0)
+		return false;
+	fd = ::open(pDevice, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (fd < 0)
+		return false;
+
+	if (tcgetattr(fd, &options) != 0)
+	{
+		close();
+		return false;
+	}
+	cfmakeraw(&options);
+	options.c_cflag |= CLOCAL | CREAD;
+	options.c_cflag &= ~(CSTOPB | CRTSCTS);
+	options.c_cc[VMIN] = 0;
+	options.c_cc[VTIME] = 0;
+	cfsetispeed(&options, speed);
+	cfsetospeed(&options, speed);
+	if (tcsetattr(fd, TCSANOW, &options) != 0)
+	{
+		close();
+		return false;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return true;
+}
+
+/**
+  * @brief	Close serial port.
+  */
+void OVC3860TransportPOSIX::close(void){
+	if (fd >= 0)
+		::close(fd);
+	fd = -1;
+}
+
+/**
+  * @brief	Check if port is opened.
+  */
+bool OVC3860TransportPOSIX::isOpen(void) const{
+	return fd >= 0;
+}
+
+/**
+  * @brief	Wait until data are ready to receive().
+  * @note	Use it in main loop with OVC3860::getTimeToNextDeadline(void)
+  * 		 as timeout, process sleeps instead of spinning.
+  *
+  * @param	timeout - ms, OVC3860_TransportMaxDelay - wait forever
+  * @retval	true - data are ready
+  */
+bool OVC3860TransportPOSIX::waitForData(uint32_t timeout){
+	struct pollfd descriptor = {fd, POLLIN, 0};
+	int pollTimeout = (timeout > 0x7FFFFFFF) ? -1 : (int) timeout;
+
+	return poll(&descriptor, 1, pollTimeout) > 0 && (descriptor.revents & POLLIN);
+}
+
+/**
+  * @brief	Transmit data.
+  * @note	Data are written to kernel buffer, so transmitter
+  * 		 is free right after return.
+  *
+  * @retval	true - all data written
+  */
+bool OVC3860TransportPOSIX::transmit(const uint8_t* pData, uint16_t size){
+	return transmitBlocking(pData, size, OVC3860_TransportMaxDelay);
+}
+
+/**
+  * @brief	Kernel buffers data, transmitter is always free.
+  */
+bool OVC3860TransportPOSIX::isTransmitterFree(void) const{
+	return true;
+}
+
+/**
+  * @brief	Data are already in kernel buffer, nothing to abort.
+  */
+void OVC3860TransportPOSIX::abortTransmit(void){
+}
+
+/**
+  * @brief	Write all data, waits with poll() if kernel buffer
+  * 		 is full.
+  *
+  * @param	timeout - ms for whole transfer
+  * @retval	true - all data written
+  */
+bool OVC3860TransportPOSIX::transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t timeout){
+	uint32_t start = getTick();
+	uint16_t written = 0;
+
+	while (written < size)
+	{
+		ssize_t result = write(fd, pData + written, size - written);
+		if (result > 0)
+		{
+			written += (uint16_t) result;
+			continue;
+		}
+		if (result < 0 && errno != EAGAIN && errno != EINTR)
+			return false;
+
+		uint32_t elapsed = getTick() - start;
+		if (timeout != OVC3860_TransportMaxDelay && elapsed >= timeout)
+			return false;
+		struct pollfd descriptor = {fd, POLLOUT, 0};
+		poll(&descriptor, 1, (timeout == OVC3860_TransportMaxDelay) ? -1 : (int) (timeout - elapsed));
+	}
+	return true;
+}
+
+/**
+  * @brief	Read exactly "size" bytes, waits with poll().
+  *
+  * @param	timeout - ms for whole transfer
+  * @retval	true - all data received
+  */
+bool OVC3860TransportPOSIX::receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout){
+	uint32_t start = getTick();
+	uint16_t received = 0;
+
+	while (received < size)
+	{
+		received += receive(pData + received, size - received);
+		if (received == size)
+			break;
+
+		uint32_t elapsed = getTick() - start;
+		if (timeout != OVC3860_TransportMaxDelay && elapsed >= timeout)
+			return false;
+		waitForData((timeout == OVC3860_TransportMaxDelay) ? OVC3860_TransportMaxDelay : timeout - elapsed);
+	}
+	return true;
+}
+
+/**
+  * @brief	Non-blocking read of already received bytes.
+  * @retval	number of bytes copied to pData
+  */
+uint16_t OVC3860TransportPOSIX::receive(uint8_t* pData, uint16_t maxSize){
+	ssize_t result = read(fd, pData, maxSize);
+	return (result > 0) ? (uint16_t) result : 0;
+}
+
+/**
+  * @brief	Drive reset line with DTR of USB-UART converter.
+  * @note	DTR active (low level) keeps module in reset, so
+  * 		 reset line should be inverted as on STM32 board
+  * 		 (OVC3860_resetLineHigh is GPIO_PIN_RESET there).
+  *
+  * @param  isRunning - false: DTR set, true: DTR cleared
+  * @retval n/a
+  */
+void OVC3860TransportPOSIX::setResetLine(bool isRunning){
+#if OVC3860_resetOnDTR
+	int line = TIOCM_DTR;
+	ioctl(fd, isRunning ? TIOCMBIC : TIOCMBIS, &line);
+#endif
+}
+
+/**
+  * @brief	Time base in ms (monotonic clock).
+  */
+uint32_t OVC3860TransportPOSIX::getTick(void) const{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t) (now.tv_sec * 1000u + now.tv_nsec / 1000000);
+}
+
+/**
+  * @brief	Blocking delay in ms.
+  */
+void OVC3860TransportPOSIX::delay(uint32_t ms){
+	struct timespec time = {(time_t) (ms / 1000), (long) (ms % 1000) * 1000000};
+	while (nanosleep(&time, &time) != 0 && errno == EINTR);
+}
+
+#endif /* OVC3860_TRANSPORT_POSIX */
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransportPOSIX.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 POSIX serial port transport.
+  *          This file provides code to contact with OVC3860 through
+  *          termios serial port (i.e. USB-UART converter /dev/ttyUSB0).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_TRANSPORTPOSIX_H_
+#define OVC3860_TRANSPORTPOSIX_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define	OVC3860_resetOnDTR			1					//1 - reset line is connected to DTR of converter, 0 - reset line is not used
+
+
+/*
+ * OVC3860TransportPOSIX is transport for Linux / POSIX hosts.
+ * Port is opened in non-blocking mode, all waits are done with
+ *  poll(), so OVC3860 object is driven from main loop:
+ *
+ *		while (1)
+ *		{
+ *			transport.waitForData(BT_audio.getTimeToNextDeadline());
+ *			BT_audio.decodeReceivedString();
+ *			BT_audio.periodicTask();
+ *		}
+ *
+ * Object is only a handle to file descriptor, it may be copied,
+ *  port is closed with close().
+ */
+class OVC3860TransportPOSIX{
+public:
+	OVC3860TransportPOSIX(void);
+
+	bool 		open(const char* pDevice, uint32_t baudrate = 115200);	//i.e. "/dev/ttyUSB0"
+	void 		close(void);
+	bool 		isOpen(void) const;
+	bool 		waitForData(uint32_t timeout);							//ms, true - data are ready to receive()
+
+	bool 		transmit(const uint8_t* pData, uint16_t size);
+	bool 		isTransmitterFree(void) const;
+	void 		abortTransmit(void);
+	bool 		transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t timeout);
+	bool 		receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout);
+	uint16_t 	receive(uint8_t* pData, uint16_t maxSize);
+	void 		setResetLine(bool isRunning);
+	uint32_t 	getTick(void) const;
+	void 		delay(uint32_t ms);
+
+private:
+	int 		fd = -1;
+};
+
+#endif /* OVC3860_TRANSPORTPOSIX_H_ */
@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransportSTM32.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 STM32 HAL transport.
+  *          This file provides code to contact with OVC3860 through
+  *          STM32 HAL UART (DMA mode) and GPIO reset line.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_Transport.h"
+
+#ifdef OVC3860_TRANSPORT_STM32HAL
+
+/**
+  * @brief	Transport constructor
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_resetLineHigh
+  * 		- OVC3860_resetLineLow
+  * 		in OVC3860_TransportSTM32.h file.
+  *
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
+  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
+  * @retval n/a
+  */
+OVC3860TransportSTM32::OVC3860TransportSTM32(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin){
+	OVC_huart = huart;
+	OVC_ResetGPIOx = ResetGPIOx;
+	OVC_Reset_Pin = GPIO_Pin;
+}
+
+/**
+  * @brief	Start non-blocking transmission.
+  * @note	pData have to exist until isTransmitterFree().
+  *
+  * @retval	true - transmission started
+  */
+bool OVC3860TransportSTM32::transmit(const uint8_t* pData, uint16_t size){
+	//TODO: po sposobie zainicjowania UART ma dojść do tego którą metodę najlepiej wykorzystać zwykłe wysyłanie, DMA czy IT
+	return HAL_UART_Transmit_DMA(OVC_huart, (uint8_t*) pData, size) == HAL_OK;
+	//return HAL_UART_Transmit_IT(OVC_huart, (uint8_t*) pData, size) == HAL_OK;	//choose manualy which methot You want to use
+}
+
+/**
+  * @brief	Check if previous transmission is finished.
+  */
+bool OVC3860TransportSTM32::isTransmitterFree(void) const{
+	return OVC_huart->gState == HAL_UART_STATE_READY;
+}
+
+/**
+  * @brief	Stop DMA transmission, UART is free after return.
+  */
+void OVC3860TransportSTM32::abortTransmit(void){
+	HAL_UART_AbortTransmit(OVC_huart);
+}
+
+/**
+  * @brief	Blocking transmission (PSKey mode).
+  * @retval	true is UART gives 'HAL_OK'.
+  */
+bool OVC3860TransportSTM32::transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t timeout){
+	return HAL_UART_Transmit(OVC_huart, (uint8_t*) pData, size, timeout) == HAL_OK;
+}
+
+/**
+  * @brief	Blocking reception (PSKey mode).
+  * @retval	true is UART gives 'HAL_OK'.
+  */
+bool OVC3860TransportSTM32::receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout){
+	return HAL_UART_Receive(OVC_huart, pData, size, timeout) == HAL_OK;
+}
+
+/**
+  * @brief	Set OVC3860 reset pin.
+  *
+  * @param  isRunning - true: OVC3860_resetLineHigh, false: OVC3860_resetLineLow
+  * @retval n/a
+  */
+void OVC3860TransportSTM32::setResetLine(bool isRunning){
+	HAL_GPIO_WritePin(OVC_ResetGPIOx, OVC_Reset_Pin, isRunning ? OVC3860_resetLineHigh : OVC3860_resetLineLow);
+}
+
+/**
+  * @brief	Time base in ms.
+  */
+uint32_t OVC3860TransportSTM32::getTick(void) const{
+	return HAL_GetTick();
+}
+
+/**
+  * @brief	Blocking delay in ms.
+  */
+void OVC3860TransportSTM32::delay(uint32_t ms){
+	HAL_Delay(ms);
+}
+
+#endif /* OVC3860_TRANSPORT_STM32HAL */
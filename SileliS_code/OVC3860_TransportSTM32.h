@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransportSTM32.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 STM32 HAL transport.
+  *          This file provides code to contact with OVC3860 through
+  *          STM32 HAL UART (DMA mode) and GPIO reset line.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_TRANSPORTSTM32_H_
+#define OVC3860_TRANSPORTSTM32_H_
+
+#include "stm32f4xx_hal.h"
+
+#define	OVC3860_resetLineHigh		GPIO_PIN_RESET		//dfines if OVC reser high is high/ low state of mcu pin. Depend on Your hardware design
+#define	OVC3860_resetLineLow		GPIO_PIN_SET		//dfines if OVC reser high is high/ low state of mcu pin. Depend on Your hardware design
+
+
+/*
+ * OVC3860TransportSTM32 is transport for STM32 HAL.
+ * Received bytes are delivered by HAL_UART_RxCpltCallback with
+ *  OVC3860::getData(), so receive() does not return anything.
+ */
+class OVC3860TransportSTM32{
+public:
+	OVC3860TransportSTM32(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin);
+
+	bool 		transmit(const uint8_t* pData, uint16_t size);
+	bool 		isTransmitterFree(void) const;
+	void 		abortTransmit(void);
+	bool 		transmitBlocking(const uint8_t* pData, uint16_t size, uint32_t timeout);
+	bool 		receiveBlocking(uint8_t* pData, uint16_t size, uint32_t timeout);
+	uint16_t 	receive(uint8_t* /*pData*/, uint16_t /*maxSize*/){ return 0; }		//bytes come from HAL_UART_RxCpltCallback
+	void 		setResetLine(bool isRunning);
+	uint32_t 	getTick(void) const;
+	void 		delay(uint32_t ms);
+
+	UART_HandleTypeDef* OVC_huart;
+	GPIO_TypeDef* 		OVC_ResetGPIOx;
+	uint16_t 			OVC_Reset_Pin;
+};
+
+#endif /* OVC3860_TRANSPORTSTM32_H_ */
@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_VolumeControl.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 absolute volume control class.
+  *          This file provides code to reach requested speaker volume
+  *          with #VU / #VD commands, tracking level reported by VOL<xx>.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#include "OVC3860_VolumeControl.h"
+
+/**
+  * @brief	Object constructor
+  * @note	Level is unknown until first VOL<xx>.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+OVC3860VolumeControl::OVC3860VolumeControl(void){
+	reset();
+}
+
+/**
+  * @brief	Forget level and commands waiting for VOL<xx>.
+  * @note	Target is kept, so it is reached again when module
+  * 		 reports its level after reset.
+  */
+void OVC3860VolumeControl::reset(void){
+	levelKnown = false;
+	level = 0;
+	pendingSteps = 0;
+}
+
+/**
+  * @brief	Set requested volume level.
+  * @note	May be called as often as slider moves, only the
+  * 		 latest target is reached.
+  *
+  * @param	newTarget - 0..OVC3860_VolumeMax
+  * @retval	n/a
+  */
+void OVC3860VolumeControl::setTarget(uint8_t newTarget){
+	if (newTarget > OVC3860_VolumeMax)
+		newTarget = OVC3860_VolumeMax;
+	target = newTarget;
+	targetSet = true;
+}
+
+uint8_t OVC3860VolumeControl::getTarget(void) const{
+	return target;
+}
+
+bool OVC3860VolumeControl::isLevelKnown(void) const{
+	return levelKnown;
+}
+
+uint8_t OVC3860VolumeControl::getLevel(void) const{
+	return level;
+}
+
+/**
+  * @brief	Check if module reported target level and no
+  * 		 command waits for VOL<xx>.
+  */
+bool OVC3860VolumeControl::isTargetReached(void) const{
+	return !targetSet || (levelKnown && pendingSteps == 0 && level == target);
+}
+
+/**
+  * @brief	Level reported by module (VOL<xx>).
+  * @note	Each #VU / #VD is confirmed by one VOL<xx>. Levels
+  * 		 caused by module buttons are accepted as well.
+  *
+  * @param	newLevel - reported level
+  * @param	timeStamp - actual time in ms
+  * @retval	n/a
+  */
+void OVC3860VolumeControl::volumeReported(uint8_t newLevel, uint32_t timeStamp){
+	level = (newLevel > OVC3860_VolumeMax) ? OVC3860_VolumeMax : newLevel;
+	levelKnown = true;
+	if (pendingSteps > 0)
+		pendingSteps--;
+	else if (pendingSteps < 0)
+		pendingSteps++;
+	lastActivity = timeStamp;
+}
+
+/**
+  * @brief	Next command to reach target.
+  * @note	Call it until 0 is returned, every non zero value
+  * 		 means that command has to be sent. Expected level
+  * 		 is reported level plus commands not confirmed yet.
+  * 		Commands which are not confirmed within
+  * 		 OVC3860_VolumeReplyTimeout are forgotten.
+  *
+  * @param	timeStamp - actual time in ms
+  * @retval	+1 - #VU, -1 - #VD, 0 - nothing to send now
+  */
+int8_t OVC3860VolumeControl::nextStep(uint32_t timeStamp){
+	if (!targetSet)
+		return 0;
+	if (pendingSteps != 0 && (timeStamp - lastActivity) > OVC3860_VolumeReplyTimeout)
+		pendingSteps = 0;										//VOL<xx> lost, start again from reported level
+
+	int8_t step;
+	if (!levelKnown)
+	{
+		if (pendingSteps != 0)
+			return 0;											//wait for the first VOL<xx>
+		step = (target > OVC3860_VolumeMax / 2) ? 1 : -1;		//learn level with step in target direction
+	}
+	else
+	{
+		int16_t expected = (int16_t) level + pendingSteps;
+		if (expected == target)
+			return 0;
+		step = (expected < target) ? 1 : -1;
+		if ((pendingSteps > 0 && step < 0) || (pendingSteps < 0 && step > 0))
+			return 0;											//target changed direction, wait for sent commands first
+		if (pendingSteps >= OVC3860_VolumeWindow || pendingSteps <= -OVC3860_VolumeWindow)
+			return 0;
+	}
+	pendingSteps += step;
+	previousActivity = lastActivity;
+	lastActivity = timeStamp;
+	sentCommands++;
+	return step;
+}
+
+/**
+  * @brief	Step returned by nextStep() was not sent.
+  * @note	Transmit queue was full, so command will never
+  * 		 be confirmed by VOL<xx>. It is removed from
+  * 		 commands waiting for VOL<xx> and returned again by
+  * 		 next nextStep() call.
+  * 		Call it only directly after nextStep().
+  *
+  * @param	step - value returned by nextStep()
+  * @retval	n/a
+  */
+void OVC3860VolumeControl::stepDropped(int8_t step){
+	if (step == 0)
+		return;
+	pendingSteps -= step;
+	lastActivity = previousActivity;
+	sentCommands--;
+}
+
+/**
+  * @brief	Time left to forget commands waiting for VOL<xx>.
+  * @note	Used by OVC3860::getTimeToNextDeadline(void).
+  *
+  * @param	timeStamp - actual time in ms
+  * @param	pTimeLeft - ms
+  * @retval	false - no command waits for VOL<xx>
+  */
+bool OVC3860VolumeControl::getTimeToTimeout(uint32_t timeStamp, uint32_t* pTimeLeft) const{
+	if (pendingSteps == 0)
+		return false;
+	uint32_t idleTime = timeStamp - lastActivity;
+	*pTimeLeft = (idleTime > OVC3860_VolumeReplyTimeout) ? 0 : OVC3860_VolumeReplyTimeout + 1 - idleTime;
+	return true;
+}
+
+/**
+  * @brief	Number of #VU / #VD sent by volume control.
+  */
+uint32_t OVC3860VolumeControl::getSentCommands(void) const{
+	return sentCommands;
+}
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_VolumeControl.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 absolute volume control class.
+  *          This file provides code to reach requested speaker volume
+  *          with #VU / #VD commands, tracking level reported by VOL<xx>.
+  *          It is platform independend.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_VOLUMECONTROL_H_
+#define OVC3860_VOLUMECONTROL_H_
+
+#include <stdint.h>
+
+#define	OVC3860_VolumeMax				15		//max. speaker volume level reported by VOL<xx> (16 levels)
+#define	OVC3860_VolumeWindow			3		//max. number of #VU / #VD sent and not confirmed by VOL<xx>
+#define	OVC3860_VolumeReplyTimeout		500		//ms, not confirmed commands are forgotten after this time
+
+
+/*
+ * OVC3860VolumeControl is class which turns absolute volume level
+ *  (i.e. from UI slider) into #VU / #VD commands.
+ *
+ * Module has no "set volume" command, it only steps the volume and
+ *  reports new level with VOL<xx>. Level reported by
+ *  OVC3860::decodeReceivedString(void) is given to volumeReported(),
+ *  OVC3860 sends commands returned by nextStep() back-to-back, step
+ *  which could not be queued is given back with stepDropped().
+ *  Max. OVC3860_VolumeWindow commands are waiting for VOL<xx>, so
+ *  when target is changed again (slider still moves) only that
+ *  few commands are already sent and superseded target costs
+ *  no more UART traffic.
+ *
+ * Until first VOL<xx> level is unknown, so only one command is sent
+ *  to learn it.
+ */
+class OVC3860VolumeControl{
+public:
+	OVC3860VolumeControl(void);
+
+	void 		setTarget(uint8_t level);						//level > OVC3860_VolumeMax is limited
+	uint8_t 	getTarget(void) const;
+	bool 		isLevelKnown(void) const;
+	uint8_t 	getLevel(void) const;							//the latest VOL<xx>, check isLevelKnown() first
+	bool 		isTargetReached(void) const;
+
+	void 		volumeReported(uint8_t level, uint32_t timeStamp);	//VOL<xx> received
+	int8_t 		nextStep(uint32_t timeStamp);					//+1 - send #VU, -1 - send #VD, 0 - nothing to send now
+	void 		stepDropped(int8_t step);						//step returned by the last nextStep() was not sent
+	bool 		getTimeToTimeout(uint32_t timeStamp, uint32_t* pTimeLeft) const;	//false - no command waits for VOL<xx>
+	void 		reset(void);									//module reset, level is unknown
+
+	uint32_t 	getSentCommands(void) const;					//number of #VU / #VD returned by nextStep() and not dropped
+
+private:
+	bool		levelKnown = false;
+	bool		targetSet = false;
+	uint8_t		level = 0;
+	uint8_t		target = 0;
+	int8_t		pendingSteps = 0;			//sum of sent and not confirmed steps (+ #VU, - #VD)
+	uint32_t	lastActivity = 0;			//time of the latest command or VOL<xx>
+	uint32_t	previousActivity = 0;		//lastActivity before the latest command, restored by stepDropped()
+	uint32_t	sentCommands = 0;
+};
+
+#endif /* OVC3860_VOLUMECONTROL_H_ */
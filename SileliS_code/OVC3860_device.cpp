@@ -1,2525 +1,3361 @@
-/**
-  ******************************************************************************
-  * @file    OVC3860_device.cpp
-  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
-  * @brief   OVC3860 hardware and audio/ phone classes.
-  *          This file provides code to manage OVC3860 audio/ phone.
-  *          It is written in C++ and SMT32 HAL.
-  *          To write this module author uses helpful informations from:
-  *          		- OVC3860 AT Command Application Notes Revision:1.1
-  *          		- BLK-MD-SPK-B AT 命令应用指导 pdf
-  *          		- https://github.com/tomaskovacik/OVC3860
-  *
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
-  * All rights reserved.</center></h2>
-  *
-  *For education and private projects:
-  * This software component is licensed by GNU Public Licence, * the "License" *;
-  * You to copy this scope of file to give informations about copyright to future
-  * commercial / open source projects.
-  *
-  *To use this library for commercial and open source projects please contact with
-  *To  author to agree the terms of use.
-  ******************************************************************************
-*/
-
-
-#include "OVC3860_CMDdefinition.h"
-#include <assert.h>
-#include "OVC3860_device.h"
-
-
-/**
-  * @brief
-  * @note
-  *
-  * @param
-  * @param
-  * @param
-  * @retval
-  */
-
-
-
-
-
-
-
-/* ---------------------------------------------------------
- *
- * 							OVC3860
- * 						HADRWARE depend methods
- *
- *
- ---------------------------------------------------------  */
-
-/**
-  * @brief	Hardware constructor
-  * @note  	You should also remember to set values of:
-  * 		- OVC3860_ReceiveBufferType
-  * 		- OVC3860_ReceiveBufferSize
-  * 		- OVC3860_resetLineHigh
-  * 		- OVC3860_resetLineLow
-  * 		in OVC3860_device.h file.
-  *
-  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
-  *               the configuration information for the specified UART module.
-  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
-  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
-  * @retval n/a
-  */
-OVC3860HardWare::OVC3860HardWare(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin){
-	OVC_huart = huart;
-	OVC_ResetGPIOx=ResetGPIOx;
-	OVC_Reset_Pin=GPIO_Pin;
-	resetLow();
-}
-
-/**
-  * @brief Object destructor.
-  * @note  n/a
-  *
-  * @param  n/a
-  * @retval n/a
-  */
-OVC3860HardWare::~OVC3860HardWare(){
-	resetLow();
-	OVC_huart = NULL;
-	OVC_Reset_Pin= NULL;
-}
-
-/**
-  * @brief	Set OVC3860 reset pin high.
-  * @note  	You should also remember to set values of:
-  * 		- OVC3860_resetLineHigh
-  * 		- OVC3860_resetLineLow
-  * 		in OVC3860_device.h file.
-  *
-  * @param  n/a
-  * @retval n/a
-  */
-void OVC3860HardWare::resetHigh(void){
-	HAL_GPIO_WritePin(OVC_ResetGPIOx, OVC_Reset_Pin, OVC3860_resetLineHigh);
-}
-
-/**
-  * @brief	Set OVC3860 reset pin low.
-  * @note  	You should also remember to set values of:
-  * 		- OVC3860_resetLineHigh
-  * 		- OVC3860_resetLineLow
-  * 		in OVC3860_device.h file.
-  *
-  * @param  n/a
-  * @retval n/a
-  */
-void OVC3860HardWare::resetLow(void){
-	HAL_GPIO_WritePin(OVC_ResetGPIOx, OVC_Reset_Pin, OVC3860_resetLineLow);
-}
-
-/**
-  * @brief	Do module reset procedure.
-  * @note  	You should also remember to set values of:
-  * 		- OVC3860_resetLineHigh
-  * 		- OVC3860_resetLineLow
-  * 		in OVC3860_device.h file.
-  *
-  * 		Remember that entering config mode (OVC3860PSKey
-  * 		 class) rquires to send appropriate command ASAP
-  * 		  after resetHigh();
-  *
-  * @param  n/a
-  * @retval n/a
-  */
-void OVC3860HardWare::resetModule(void){
-	resetLow();
-#ifdef INC_FREERTOS_H
-	#error  TODO: FreeRTOS OS_delay				//TODO: Delay zależny od tego czy jest HAL czy FreeRTOS
-#else
-	HAL_Delay(500);
-#endif
-	resetHigh();
-}
-
-/* ---------------------------------------------------------
- *
- * 							OVC3860
- * 						HADRWARE depend methods
- *
- *
- ---------------------------------------------------------  */
-
-
-
-/* ---------------------------------------------------------
- *
- * 							OVC3860
- * 						COMMINUCATION module methods
- *
- *
- ---------------------------------------------------------  */
-
-/**
-  * @brief	Object constructor
-  * @note  	You should also remember to set values of:
-  * 		- OVC3860_ReceiveBufferType
-  * 		- OVC3860_ReceiveBufferSize
-  * 		- OVC3860_resetLineHigh
-  * 		- OVC3860_resetLineLow
-  * 		in OVC3860_device.h file.
-  *
-  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
-  *               the configuration information for the specified UART module.
-  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
-  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
-  * @retval n/a
-  */
-OVC3860::OVC3860(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin)		//TODO: dodać obsługę pinu reset
-		: OVC3860HardWare(huart  /*in DMA mode*/, ResetGPIOx, GPIO_Pin)
-{
-
-}
-
-/**
-  * @brief Object destructor.
-  * @note  Also clean dynamicly created memory.
-  *
-  * @param  n/a
-  * @retval n/a
-  */
-OVC3860::~OVC3860(void)
-{
-	destroySendDataArray();
-}
-
-
-/**
-  * @brief	search '\r','\n' string in circular buffer.
-  * @note	Search for \r\n sequence do not change circular
-  * 		 buffer tail head values.
-  * 		This function could be also used to detect end
-  * 		 of OVC3860 communicate and set the flag to
-  * 		 start decodeReceivedString(void);
-  *
-  * @param
-  * @retval	circularBufferSearchResult struct with:
-  * 			- bool isFound;
-  * 			- size_t tail2virtualTail_;
-  * 		for more details take a look at CircularBuffer
-  * 		class.
-  */
-circularBufferSearchResult OVC3860::detectRN(void){
-		return SearchItem("\r\n", 2, false);
-}
-
-/**
-  * @brief	Get data from OVC3860.
-  * @note 	Get data from OVC3860 uart and store it in circular
-  * 		 buffer.
-  * 		 Because OVC3860 uses asynchronous communication, both:
-  * 		 - as a answer to command,
-  * 		 - and in some cases periodic,
-  * 		 this method should be executed ASAP after
-  * 		 uart reception i.e. in DMA / interrupt handling
-  * 		 function.
-  * 		To detect if there are any new data in buffer use
-  * 		 detectRN(void) method;
-  *
-  * @param	n/a
-  * @retval	n/a - data is storeg in circular buffer.
-  */
-void OVC3860::getData(uint8_t RxBuff){
-	  if (!isOverflowed())
-	  {
-		  put(RxBuff);
-	  }
-}
-
-/**
-  * @brief	Decode OVC uart communicates.
-  * @note	Beacause OVC3860 uses asynchronous communication, both:
-  * 		 - as a answer to command,
-  * 		 - and in some cases periodic,
-  * 		 this method should be executed as frequent as it is
-  * 		  required.
-  *
-  * 		After command parsing method sets tail positnion after
-  * 		 the oldest \r\n sequence.
-  *
-  * @param	n/a
-  * @retval	uint8_t retVal - to be honest I do not know what is
-  * 		 it fore but was in source code that I studied.
-  * 		 	Maybe it is better to rewrite it to return parsed
-  * 		 	 command type (enum STATES).
-  */
-uint8_t OVC3860::decodeReceivedString(void){
-
-	circularBufferSearchResult bufferState = detectRN();
-	OVC3860_reponse parsedCommand = NO_MESSAGE;
-	uint8_t retVal = 1;
-
-	if (bufferState.isFound== true)		//OVC3860 receive buf_ (receive buffer) contains "\r\n" sequence which means that OVC386 send compleet message
-	{
-
-		uint8_t i=0;
-
-		size_t searchRange = bufferState.tail2virtualTail_ + 2; /* +2 because "\r\n"*/
-		OVC3860_ReceiveBufferType	item2search_begginingAddres =0;
-		OVC3860_ReceiveBufferType	item2search_lenght;
-
-		const typeOVC3860DecodeStruct* pOVC3860DecodeStruct =&OVC3860DecodeStruct;
-
-		//received command parsing
-		do
-		{
-
-			item2search_lenght = OVC3860DecodeStruct.decodeStringsLenght[i];
-			if (SearchItemTail2Range(pOVC3860DecodeStruct->decodeStrings+item2search_begginingAddres, item2search_lenght,  searchRange , true).isFound)
-				{
-					parsedCommand = OVC3860DecodeStruct.decodedAnswer[i];
-					break;
-				};
-			i++;
-			item2search_begginingAddres =item2search_begginingAddres + item2search_lenght;
-		}
-		while(i< decodedAnswer_len); //ecodedAnswer item long
-		//received command parsing
-
-		switch (parsedCommand)
-		{
-		case AX_PA: //
-			break;
-		case AA1: 	//The audio sample rating is set 48000
-		    PowerState = On;
-		    Audio = ASR_44800;
-			break;
-		case AA2:	//The audio sample rating is set 44100
-			PowerState = On;
-			Audio = ASR_44100;
-			break;
-		case AA4:	//The audio sample rating is set 32000
-		    PowerState = On;
-		    Audio = ASR_32000;
-			break;
-		case AA8:	//The audio sample rating is set 16000
-		    PowerState = On;
-		    Audio = ASR_16000;
-			break;
-		case AE:	//Audio config error
-		    PowerState = On;
-		    Audio = ConfigError;
-			break;
-		case AF:	//Audio codec is closed
-		    PowerState = On;
-		    Audio = CodecClosed;
-			break;
-		case AS:	//Audio codec is in phone call mode
-		    PowerState = On;
-		    Audio = PhoneCall;
-			break;
-		case EPER:	//Error eeprom parameter
-		    PowerState = On;
-		    retVal = 0;
-			break;
-		case ERR:	//The command is error
-		    PowerState = On;
-		    retVal = 0;
-			break;
-		case II:	//HSHF enters pairing state indication
-		    //DBG(F("II\n"));
-		    PowerState = On;
-		    BTState = Discoverable;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case IJ2:	//HSHF exits pairing mode and enters listening
-		    PowerState = On;
-		    BTState = Listening;
-			break;
-		case IA:	//Disconnected,HSHF state is listening
-		    PowerState = On;
-		    HFPState = Disconnected;
-			break;
-		case IC:	//Call-setup status is outgoing
-		    PowerState = On;
-		    CallState = OngoingCall;
-			break;
-		case IF:	//Phone hand up,Call-setup status is idle
-		    PowerState = On;
-		    CallState = PhoneHangUp;
-			break;
-		case IG:
-			PowerState = On;
-			break;
-		case IL:	//Hold Active Call       Accept Other Call
-			PowerState = On;
-			CallState = OngoingCall;
-			break;
-		case IM:	//Make Conference Call
-		    PowerState = On;
-		    CallState = OngoingCall;
-			break;
-		case IN:	//Release Held Call       Reject Waiting Call
-		    PowerState = On;
-		    CallState = PhoneHangUp;
-			break;
-		case IP:	//IPX Outgoing call number length(X) indication
-		    PowerState = On;
-		    CallState = OngoingCall;
-		    //todo: parsowanie parametrów, bo pełna odpowidź to IP<len>
-			break;
-		case IR:	//Outgoing call number indication
-		    PowerState = On;
-		    CallState = OutgoingCall;
-		    //todo: parsowanie parametrów, bo pełna odpowidź to IR<phonenum>
-			break;
-		case IS:	//IS<version>        Power ON Init Complete
-		    PowerState = On;
-		    //todo: parsowanie parametrów, bo pełna odpowidź to IS<ver>
-			break;
-		case IT:	//Release Active Call       Accept Other Call
-		    PowerState = On;
-		    CallState = OngoingCall;
-			break;
-		case IV:	//Connected
-		    PowerState = On;
-		    HFPState = Connected;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case MA: //AV pause/stop Indication
-		    PowerState = On;
-		    MusicState = Idle;
-		    CallState = PhoneHangUp;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case MB:	//AV play Indication
-		    PowerState = On;
-		    MusicState = Playing;
-		    CallState = PhoneHangUp;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case MC:	//Indication the voice is on Bluetooth
-			PowerState = On;
-			break;
-		case MD:	//Indication the voice is on phone
-			PowerState = On;
-			break;
-		case ME:	//
-			PowerState = On;
-			break;
-		case MEM_:	//
-			PowerState = On;
-			//todo: parsowanie parametrów, bo pełna odpowidź to MEM:<val> trzeba to przekazać na zewnątrz w postaci jakiejśc zmiennej/ srtuktury/ etc
-			break;
-		case MF:	//MFXY: X and Y are auto answer and auto connect configuration
-			PowerState = On;
-			skipBufferItem(2);
-		    //DBG("MF");
-		    switch (OVC3860::get()) {
-		      case '0':
-		        AutoAnswer = Off;
-		        //  DBG("AA OFF");
-		        break;
-		      case '1':
-		        AutoAnswer = On;
-		        //DBG("AA ON");
-		        break;
-		    }
-		    switch (OVC3860::get()) {
-		      case '0':
-		        AutoConnect = Off;
-		        //DBG("AC OFF");
-		        break;
-		      case '1':
-		        AutoConnect = On;
-		        //DBG("AA ON");
-		        break;
-		    }
-			break;
-		case MG:	//MGX: The HSHF applications state is X indication       Report Current HFP Status
-		    /*
-		      HFP Status Value Description:(MG)
-		      1. Ready (to be connected)
-		      2. Connecting
-		      3. Connected
-		      4. Outgoing Call
-		      5. Incoming Call
-		      6. Ongoing Call
-		    */
-		    PowerState = On;
-
-			skipBufferItem(2);
-		    switch (OVC3860::get()) {
-		      case '1':
-		        HFPState = Ready;
-		        break;
-		      case '2':
-		        HFPState = Connecting;
-		        break;
-		      case '3':
-		        HFPState = Connected;
-		        break;
-		      case '4':
-		        HFPState = OutgoingCall;
-		        break;
-		      case '5':
-		        HFPState = IncomingCall;
-		        break;
-		      case '6':
-		        HFPState = OngoingCall;
-		        break;
-		    }
-			break;
-		case ML:	//Report Current AVRCP Status
-		    /*
-		      AVRCP Status Value Description:(ML)
-		      1. Ready (to be connected)
-		      2. Connecting
-		      3. Connected
-		    */
-		    PowerState = On;
-
-			skipBufferItem(2);
-		    switch (OVC3860::get()) {
-		      case '1':
-		        AVRCPState = Ready;
-		        break;
-		      case '2':
-		        AVRCPState = Connecting;
-		        break;
-		      case '3':
-		        AVRCPState = Connected;
-		        break;
-		    }
-			break;
-		case MM:	//name
-			PowerState = On;
-			//BT_NAME //todo: parsowanie parametrów, bo pełna odpowidź to MM<name>
-			break;
-		case MN:	//pin
-			PowerState = On;
-			//string BT_PIN;			//todo: parsowanie parametrów, bo pełna odpowidź to MN<pin>
-			break;
-		case MW:	//version
-			//todo: parsowanie parametrów, bo pełna odpowidź to MW<version>
-			break;
-		case MP:	//Music Pause
-		    //DBG(F("MP"));
-		    PowerState = On;
-		    MusicState = Idle;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case MR:	//Music Resume;
-		    PowerState = On;
-		    MusicState = Playing;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case MS:	//Backward song
-		    PowerState = On;
-		    MusicState = Rewinding;
-			break;
-		case MU:	//Report Current A2DP Status
-		    /*
-		      A2DP Status Value Description:(MU)
-		      1. Ready (to be connected)
-		      2. Initializing
-		      3. Signalling Active
-		      4. Connected
-		      5. Streaming
-		    */
-		    PowerState = On;
-
-			skipBufferItem(2);
-		    switch (OVC3860::get()) {
-		      case '1':
-		        A2DPState = Ready;
-		        break;
-		      case '2':
-		        A2DPState = Initializing;
-		        break;
-		      case '3':
-		        A2DPState = SignallingActive;
-		        break;
-		      case '4':
-		        A2DPState = Connected;
-		        break;
-		      case '5':
-		        A2DPState = Streaming;
-		        break;
-		    }
-			break;
-		case MX:	//Forward song
-		    PowerState = On;
-		    MusicState = FastForwarding;
-			break;
-		case MY:	//AV Disconnect Indication
-		    PowerState = On;
-		    OVC3860::queryA2DPStatus();
-			break;
-		case M0:	//
-		    PowerState = On;
-		    BTState = Disconnected;
-			break;
-		case M1:	//AV Disconnect Indication
-		    PowerState = On;
-		    BTState = Connected;
-			break;
-		case M2:	//AV Disconnect Indication
-		    PowerState = On;
-		    CallState = IncomingCall;
-			break;
-		case M3:	//AV Disconnect Indication
-		    PowerState = On;
-		    CallState = OutgoingCall;
-			break;
-		case M4:	//AV Disconnect Indication
-		    PowerState = On;
-		    CallState = OngoingCall;
-			break;
-		case NOEP:	//No eeprom	break;
-		    PowerState = On;
-		    retVal = 0;
-		case NUM:
-			CallState = IncomingCall;
-			PowerState = On;
-			//CallerID = receivedString.substring(4);		//todo:
-			break;
-		case OK:
-			PowerState = On;
-			break;
-		case PA:
-			PowerState = On;
-			//todo: parsowanie parametrów, bo pełna odpowidź to PA1/PA0
-			break;
-		case PB:
-			PowerState = On;
-			//TODO: code implementation of this feature in decodeReceivedString
-			break;
-		case PC:	//?
-			PowerState = On;
-			break;
-		case PE:	//The voice dial start indication
-			PowerState = On;
-			break;
-		case PF:	//The voice dial is not supported/stopped indication
-			PowerState = On;
-			break;
-		case SC:	//SPP opened
-		    PowerState = On;
-		    BTState = SPPopened;
-		   // DBG(F("SPP opened\n"));
-			break;
-		case SD:	//SPP closed
-		    PowerState = On;
-		    BTState = SPPclosed;
-		    //DBG(F("SPP closed\n"));
-			break;
-		case SW:  //Command Accepted
-			PowerState = On;
-			break;
-		case VOL: //Command Accepted
-		    PowerState = On;
-		    //volume = receivedString.substring(3).toInt();		//TODO: PARSOWANIE TEGO bo prawidłowa odpowiedź to VOLXX
-			break;
-		case WELCOME:	//Welcome message aka power on and reset high
-			PowerState = On;
-			break;
-//		case PSkeyEntry:	//Enter ConfigMode
-//			BTState = ConfigMode;
-//
-//			//todo: wyczyszczenie i kompletne zresetowanie bufora kolowego, dane mają być na samym początku???
-//			break;
-//		case PSkeyQuit:	//Quit ConfigMode
-//			BTState = Disconnected;
-//			break;
-		case NO_MESSAGE:
-		    //DBG(F("Received unknown string:"));		//TODO:
-		    //DBG(receivedString);					//TODO:
-			break;
-		};
-
-		//move tail_ to the end of the parsed command
-		 SearchItem("\r\n", 2);
-		 skipBufferItem(2);
-		 //move tail_ to the end of command
-	}
-	return retVal;
-}
-
-/**
-  * @brief	Move tail in circular buffer.
-  * @note	Additional method to move tail x position ahead.
-  *
-  * @param	howMany - number of items to move forward.
-  * @retval	n/a
-  */
-void OVC3860::skipBufferItem(uint8_t howMany){
-	for(uint8_t i=0; i< howMany; i++)
-	{
-		OVC3860::get();
-	}
-}
-
-/**
-  * @brief	Creates array to store data required to store
-  * 		 command that will be sent to OVC3860.
-  * @note	If new command is bigger that last one it destroys
-  * 		 array and create new larger.
-  *
-  * 		Do not forgot to destroy this array at destructor
-  * 		 method.
-  *
-  * @param	sizeOfArray	- amound of data to stror command
-  * @retval	n/s
-  */
-void OVC3860::createSendDataArray(size_t sizeOfArray) {
-
-	//if data array exists but it is shorter than required destroy if
-	if ((sizeOfArray > OVC3860SendDataArrayLenght)
-			&& (pOVC3860SendDataArray != 0)) {
-		destroySendDataArray();
-	}
-
-	//if data array do not exsists create it
-	if (pOVC3860SendDataArray == 0) {
-		assert(pOVC3860SendDataArray = new uint8_t[sizeOfArray]);
-		OVC3860SendDataArrayLenght = sizeOfArray;
-	}
-
-}
-
-/**
-  * @brief	Destroy array to store data required to store
-  * 		 command that will be sent to OVC3860.
-  * @note	Do not forgot to destroy this array at destructor
-  * 		 method.
-  *
-  * @param	n/a
-  * @retval	n/a
-  */
-void OVC3860::destroySendDataArray (void){
-	delete [] pOVC3860SendDataArray;
-	pOVC3860SendDataArray = NULL;
-	OVC3860SendDataArrayLenght = 0;
-}
-
-
-/**
-  * @brief	Send command to OVC3860
-  * @note	Command is stored in dynamic array located with
-  * 		 pointer pOVC3860SendDataArray.
-  * 		BECAUSE method send data in nonblocking mode (DMA)
-  * 		 pointer with data pOVC3860SendDataArray have to
-  * 		 exist as long as HAL_UART_TRANSMIT_DMA do not
-  * 		 finish its work. That is why this pointer is a part
-  * 		 of class / object not a part of this method.
-  *
-  * @param	pCMD - pointer to command that have to executed, take a look at:
-  *   *          		- OVC3860 AT Command Application Notes Revision:1.1
-  *          			- BLK-MD-SPK-B AT 命令应用指导 pdf
-  * @param	pExtraData - pointer to extra data if pCMD requires this, take a look at:
-  *   	        			- OVC3860 AT Command Application Notes Revision:1.1
-  *          				- BLK-MD-SPK-B AT 命令应用指导 pdf
-  *          			It is overloaded parameter "=0" and can be omitted if
-  *          			 pCMD do not reqiures extra data.
-  * @param	ExtraDataSize - size of pExtraData data. It is overloaded parameter "=0" and can be omitted if
-  *          			 pCMD do not reqiure extra data.
-  * @retval	n/a
-  */
-void OVC3860::sendData(const char* pCMD, const char* pExtraData, size_t ExtraDataSize){
-
-	//create dataArray
-	uint16_t arraySize = 3				/*AT#*/
-						 +2				/*COMMAND*/
-						 +ExtraDataSize	/*pExtraData*/
-						 +2;			/*\r\n*/
-	createSendDataArray (arraySize);
-
-	memcpy(pOVC3860SendDataArray, "AT#", 3);								//Cpoy "AT#"
-	memcpy(pOVC3860SendDataArray+3, pCMD, 2);							//Copy command 'XY'
-	if (pExtraData!=0)
-		memcpy(pOVC3860SendDataArray+3+2, pExtraData, ExtraDataSize);	//Copy ExtraData
-	memcpy(pOVC3860SendDataArray+3+2+ExtraDataSize, "\r\n", 2);			//Copy '\r\n'
-
-
-	//TODO: po sposobie zainicjowania UART ma dojść do tego którą metodę najlepiej wykorzystać zwykłe wysyłanie, DMA czy IT
-	//HAL_UART_Transmit(OVC_huart, pOVC3860SendDataArray, OVC3860SendDataArrayLenght, 200);
-	HAL_UART_Transmit_DMA(OVC_huart,pOVC3860SendDataArray, OVC3860SendDataArrayLenght);
-	//HAL_UART_Transmit_IT(OVC_huart, pOVC3860SendDataArray, OVC3860SendDataArrayLenght);	//choose manualy which methot You want to use
-}
-
-
-/*
-  Pairing
-  Set pairing, waiting for the remote device to connect, the command format is:
-  AT#CA // discoverable for 2 minutes  - DISCOVERY TIME CAN BE MODIFIED WITH PSKey: app_to_pairing
-  ovc3860 returns the indication:
-  II // state indication, HSHF enters pairing state indication
-  if 2 minutes' timeout is arrived(no peer connect to ovc3860 device), returns the indication:
-  IJ2 // state indication, HSHF exits pairing mode and enters listening
-  The device can't be found, if need to be search, repeat Pairing operation.
-
-  Enter Pairing Mode #CA
-
-  Command
-  #CA
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  II
-  Indication Description
-  Enter Pairing Mode Indication
-
-  Description
-  This command puts the module in the pairing mode. The information response and causes will
-  indicate the command success or failure. Enter pairing mode indication or failure indication
-  will be sent to the host.
-
-  Note:
-  1. This command will cause a disconnection if module has already connected with some device.
-  2. Module will exit pairing mode if connection not happen in 2 minutes.
-
-  Syntax: AT#CA
-
-  FOR MORE DETAILS:
-  Take a look at OVC3860 AT Command Application Notes.pdf
-  chapter 4 Command Explanations
-*/
-
-void OVC3860::enterPairingMode(void){
-	sendData(OVC3860_PAIRING_INIT);
-}
-
-
-/*
-  Exit pairing
-  Exit pairing, can not be found by peers, the command format is:
-  AT#CB // exit pairing mode, non-discoverable
-  return:
-  IJ2 // state indication, HSHF exits pairing mode and enters listening
-
-  Cancel Pairing Mode #CB
-
-  Command
-  #CB
-  Current Status(s)
-  Pairing
-  Possible   Indication(s)
-  IJ2
-  Indication Description
-  Exit Pairing Mode Indication
-
-  Description
-  If the module is in pairing mode, this command causes the module to exit the pairing mode and
-  enter the idle mode. The information response and causes will indicate the command success or
-  failure.
-
-  Syntax: AT#CB
-
-    FOR MORE DETAILS:
-  Take a look at OVC3860 AT Command Application Notes.pdf
-  chapter 4 Command Explanations
-*/
-void OVC3860::CancelPairingMode(void){
-	sendData(OVC3860_PAIRING_EXIT);
-}
-
-
-/*
-  Active connection
-  Actively connect to the last successful connected device
-  AT#CC // Connect to remote Device
-  then input the local PIN code, and ovc3860 returns HSHF's state indication:
-  IV
-  HSHF state is connected indication
-  if Bluetooth mobile phone is turned off or not in Bluetooth signal range, will return a stat
-  us indication:
-  IJ2 // HSHF exits pairing mode and enters listening state indication
-
-  Connect HFP to Handset #CC
-  Command
-  #CC
-  Current Status(s)
-  HFP Status = 1
-  Possible Indication(s)
-  IV
-  Description Indication
-  Connecting Indication
-
-  Note: You can get current HFP status by #CY.
-
-  Description
-  This command causes the module to connect to a paired handset. The information response and
-  causes will indicate the command success or failure. Connect Indication will be sent to the host
-  after the connection is established. Otherwise Disconnect Indication will be sent to the host.
-
-  Syntax: AT#CC
-*/
-void OVC3860::connectHSHF(void){
-	sendData(OVC3860_CONNECT_HSHF);
-}
-
-
-/*
-  taken from BLK module datasheet
-  BLK-MD-SPK-B_AT_Command_set_original( BLK-MD-SPK-B AT Command Application Guide)
-
-  no mention of this command in OVC3860_AT_Command_Application_Notes.pdf
-
-  module responce:
-
-  sending AT#CV
-  ERR2
-  ERR2
-  OK
-  OK
-*/
-void OVC3860::pairingDeleteThenInit() {
-  OVC3860::sendData(OVC3860_PAIRING_DELETE_THEN_INIT);
-}
-
-/*
-  Exit connecting
-  Send the command:
-  AT#CD // ACL disconnect from remote
-  ovc3860 returns the indication:
-  IA // HSHF state is listening
-  if the remote device disconnects connection actively, ovc3860 also returns the same indication
-
-  Disconnect HFP from Handset #CD
-  Command
-  #CD
-  Current Status(s)
-  HFP Status ≥ 3
-  Possible Indication(s)
-  IA
-  Description Indication
-  Disconnected Indication
-
-  Description
-  This command causes the module to disconnect from the connected handset. The information
-  response and causes will indicate the command success or failure. Disconnect Indication will be
-  sent to the host after the connection is dropped.
-
-  Syntax: AT#CD
-*/
-void OVC3860::disconnectHSHF() {
-	sendData(OVC3860_DISCONNECT_HSHF);;
-}
-
-
-
-
-
-/*
-  user may answer the phone:
-  AT#CE
-  return the indication:
-  IF // hang-up indication
-  if the other party hangs up the phone, also return:
-  IF // hang-up indication
-
-  Answer Call #CE
-  Command
-  #CE
-  Current Status(s)
-  HFP Status = 4
-  Possible
-  Indication(s)
-  IG
-  Indication Description
-  Pick up Indication
-
-  Description
-  This command causes the module to answer an incoming call. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#CE
-*/
-void OVC3860::callAnswer(void) {
-	sendData(OVC3860_CALL_ANSWARE);
-}
-
-/*
-  Answering the phone
-  The phone receives a call, ovc3860 returns the indication, such as:   02167850001
-  Receive a incoming call 02167850001
-  at this time, user may refuse to answer the phone:
-  AT#CF // Refuse to answer the phone
-  ovc3860 returns:
-  IF // Call-setup status is idle
-
-  Reject Call #CF
-
-  Command
-  #CF
-  Current Status(s)
-  HFP status = 4
-  Possible Indication(s)
-  IF
-  Indication Description
-  Hang up Indication
-
-  Description
-  This command causes the module to reject an incoming call. The information response and causes
-  will indicate the command success or failure.
-
-  Syntax: AT#CF
-*/
-void OVC3860::callReject() {
-	sendData(OVC3860_CALL_REJECT);
-}
-
-/*
-  End Call
-  Command
-  #CG
-  Current Status(s)
-  HFP Status = 5 | 6
-  Posible Indication(s)
-  IF
-  Indication Description
-  Hang up Indication
-
-  Description
-  This command causes the module to end an active call. The information response and causes will
-  indicate the command success or failure.
-  Syntax: AT#CG
-*/
-void OVC3860::callEnd() {
-  sendData(OVC3860_CALL_HANGUP);
-}
-
-
-/*
-  Redialing
-  Redial the last outgoing call:
-  AT#CH
-  return:
-  ICv//Call-setup status is outgoing
-
-  Redial #CH
-  Command
-  #CH
-  Current Status(s)
-  HFP Status = 3 | 6
-  Possible Indication(s)
-  IC
-  Indication Description
-  Outgoing Call Indication
-
-  Description
-  This command causes the module to redial the last number called in the phone. The information
-  response and causes will indicate the command success or failure.
-
-  Syntax: AT#CH
-*/
-void OVC3860::callRedial() {
-  sendData(OVC3860_CALL_REDIAL);
-}
-
-
-/*
-  Voice dialing
-  The command format is:
-  AT#CI
-  return:
-  PE // The voice dial start indication
-  or,
-  PF // The voice dial is not supported indication
-
-  Voice Dial #CI
-  Command
-  #CI
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PE
-  PF
-  Indication Description
-  Voice Dial Start Indication
-  Handset Not Support Void Dial
-
-  Description
-  This command causes the module to active voice dial functionary in the phone. The information
-  response and causes will indicate the command success or failure.
-  Note: Voice dialing not works in some handset while .
-
-  Syntax: AT#CI
-*/
-void OVC3860::voiceDialStart() {
-	sendData(OVC3860_VOICE_CALL_START);
-}
-
-
-/*
-  cancel the voice dialing:
-  AT#CJ
-  return:
-  PF //The voice dial is stopped indication
-
-  Cancel Voice Dial #CJ
-  Command
-  #CJ
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PF
-  Indication Description
-  Voice Dial Stop Indication
-
-  Description
-  This command causes the module to cancel on going voice dial in the phone. The information
-  response and causes will indicate the command success or failure.
-
-  Syntax: AT#CJ
-*/
-void OVC3860::voiceDialEnd() {
-	sendData(OVC3860_VOICE_CALL_CANCEL);
-}
-
-/*
-  Mute/Unmute MIC #CM
-
-  Command
-  #CM
-  Current Status(s)
-  HFP Status = 6
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted by Module
-
-  Description
-  This command causes the module to mute or unmute the MIC. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#CM
-*/
-void OVC3860::micToggle() {
-  sendData(OVC3860_MIC_TOGGLE);
-}
-
-
-/*
-  Audio transfer
-  Transfer audio between HSHF and phone speaker:
-  AT#CO
-  when transfered to HSHF, ovc3860 returns:
-  MC //The voice is on Bluetooth indication
-  when transfered to HSHF:
-  MD //The voice is on phone indication
-
-  Transfer Call to/from Handset #CO
-
-  Command
-  #CO
-  Current Status(s)
-  HFP Status = 6(without audio)
-  HFP Status = 6(without audio)
-  Possible Indication(s)
-  MC
-  MD
-  Indication Description
-  HFP Audio Connected
-  MD HFP Audio Disconnect
-
-  Description
-  This command causes the module to transfer the active call from the module to the handset ( MD
-  will received ) or from the handset to the module ( MC will received ). The information response
-  and causes will indicate the command success or failure.
-
-  Syntax: AT#CO
-*/
-void OVC3860::transferAudio() {
-  sendData(OVC3860_TRANSFER_AUDIO_TO_SPEAKER);
-}
-
-
-
-/*
-  Release&Reject Call #CQ
-  Command
-  #CQ
-  Current Status(s)
-  HFP Status = 6
-  Possible Indication(s)
-  IN
-  Indication Description
-  Release Held Call, Reject Waiting Call
-  by
-  Description
-  This command causes the module to release held call, and reject waiting call. The information
-  response and causes will indicate the command success or failure.
-
-  Syntax: AT#CQ
-*/
-void OVC3860::callReleaseReject() {
-  sendData(OVC3860_RELEASE_REJECT_CALL);
-}
-
-
-/*
-  Release&Accept Call #CR
-
-  Command
-  #CR
-  Current Status(s)
-  HFP Status = 6
-  Possible Indication(s)
-  IT
-  Indication Description
-  Release Active Call, Accept Other Call
-
-  Description
-  This command causes the module to release active call, accept other call.
-  The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#CR
-*/
-void OVC3860::callReleaseAccept() {
-  sendData(OVC3860_RELEASE_ACCEPT_CALL);
-}
-
-
-/*
-  Hold&Accept Call #CS
-
-  Command
-  #CS
-  Current Status(s)
-  HFP Status = 6
-  Possible Indication(s)
-  IM
-  Indication Description
-  Release Active Call, Accept Other Call
-
-  Description
-  This command causes the module to hold active call, accept other call. The information response
-  and causes will indicate the command success or failure.
-
-  Syntax: AT#CS
-*/
-void OVC3860::callHoldAccept() {
-  sendData(OVC3860_HOLD_ACCEPT_CALL);
-}
-
-
-/*
-  Conference Call #CT
-
-  Command
-  #CT
-  Current Status(s)
-  HFP Status = 6
-  Possible Indication(s)
-  IM
-  Indication Description
-  Make Conference Call
-
-  Description
-  This command causes the module to make a conference call. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#CT
-*/
-void OVC3860::callConference() {
-  sendData(OVC3860_CONFERENCE_CALL);
-}
-
-/*
-  Dialing
-  For example, dialing 10086, the command format is:
-  AT#CW10086
-  return
-  IC // Call-setup status is outgoing
-  IP5 // Outgoing call number length indication
-  IR10086 // Outgoing call number indication
-
-  Dial One Call #CW
-
-  Command
-  #CW
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  IC
-  IP<lehgth>
-  IR<phone number>
-  Outgoing Call Indication
-  Length of Phone Number
-  Current Call Indication
-
-  Description
-  This command causes the module to dial one call. The information response and causes will
-  indicate the command success or failure.
-  Note: IP, IR indications only supported by HFP1.5 version.
-
-
-  Syntax: AT#CW13800138000
-*/
-void OVC3860::callDialNumber(const char* pExtraData, size_t ExtraDataSize) {
-
-  sendData(OVC3860_CALL_DIAL_NUMBER,  pExtraData, ExtraDataSize);
-}
-
-
-/*
-  Sending DTMF
-  For example, sending number “1”
-  AT#CX1
-  return:
-  OK // send DTMF successfully indication
-  NOTE: sopported sending characters (0-9, #, *, A-D).
-
-  Send DTMF #CX
-
-  Command
-  #CX
-  Current Status(s)
-  HFP Status = 6
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to send one DTMF. The information response and causes will
-  indicate the command success or failure.
-  Syntax:
-  AT#CX1
-  AT#CX5
-
-*/
-void OVC3860::sendDTMF(const char* pExtraData, size_t ExtraDataSize) {
-  OVC3860::sendData(OVC3860_SEND_DTMF,  pExtraData, ExtraDataSize);
-}
-
-
-/*
-  Query the HSHF applications state, the command is:
-  AT#CY
-  ovc3860 returns:
-  MGX // The HSHF applications state is X indication
-  NOTE: X is the return parameter:
-          1 – “Ready”
-          2 – “Connecting”
-          3 – “Connected”
-          4 –“Outgoing call”
-          5 –“Incoming call”
-          6 – “Ongoing call”.
-
-  Query HFP Status #CY
-
-  Command
-  #CY
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  MG<code>
-  Report Current HFP Status
-
-  Description
-  This command queries the module’s HFP current status. The information response and causes will
-  indicate the command success or failure.
-
-  Syntax: AT#CY
-*/
-void OVC3860::queryHFPStatus() {
-  sendData(OVC3860_QUERY_HFP_STATUS);
-}
-
-
-/*
-  Reset #CZ
-
-  Command
-  #CZ
-  Current Status(s)
-  Any
-  Possible
-  IS<version>
-  MF<a><b>
-  Indication Description
-  Power ON Init Complete
-  Report Auto Answer and PowerOn Auto
-  Connection Configuration
-
-  Description
-  This command causes the module to reset. The information response and causes will indicate the
-  command success or failure.
-
-  Syntax: AT#CZ
-*/
-void OVC3860::resetSoftware() {
-  sendData(OVC3860_RESET);
-}
-
-
-/*
-  Play/Pause Music #MA
-
-  Command
-  #MA
-  Current Status(s)
-  A2DP State = 5
-  Possible Indication(s)
-  MA
-  MB
-  Indication Description
-  AV pause/stop Indication
-  AV play Indication
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV source to play/pause
-  music. If module isn’t connected AV source, this command will cause module try to connected
-  current connected mobile’s AV source. The information response and causes will indicate the
-  command success or failure.
-
-  Syntax: AT#MA
-*/
-void OVC3860::musicTogglePlayPause() {
-  sendData(OVC3860_MUSIC_TOGGLE_PLAY_PAUSE);
-}
-
-
-/*
-  Stop Music #MC
-
-  Command
-  #MC
-  Current Status(s)
-  A2DP State = 5
-  Possible Indication(s)
-  MA
-  Indication Description
-  AV pause/stop Indication
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV Source to Stop Music.
-  The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MC
-*/
-void OVC3860::musicStop() {
-  sendData(OVC3860_MUSIC_STOP);
-}
-
-
-/*
-  Forward Music #MD
-
-  Command
-  #MD
-  Current Status(s)
-  A2DP State = 5
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted by Module
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV Source to Play next
-  song. The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MD
-*/
-void OVC3860::musicNextTrack() {
-  sendData(OVC3860_MUSIC_NEXT_TRACK);
-}
-
-
-
-/*
-  Backward Music #ME
-
-  Command
-  #ME
-  Current Status(s)
-  A2DP State = 5
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted by Module
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV Source to play last
-  song. The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#ME
-*/
-void OVC3860::musicPreviousTrack() {
-  sendData(OVC3860_MUSIC_PREVIOUS_TRACK);
-}
-
-
-/*
-  Query Auto Answer and PowerOn Auto Connection Configuration #MF
-
-  Command Current Status(s)
-  #MF
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  MF<a><b>
-  Indication Description
-  Report Auto Answer and PowerOn Auto
-  Connection Configuration
-
-  Description
-  This command queries the module’s auto answer configuration and poweron auto connect
-  configuration. The information response and causes will indicate the command success or failure
-
-  Syntax: MF<a><b>
-  Value:
-  < a >: auto answer configuration, where 0: disable, 1: enabled
-  < b >: poweron auto configuration, where 0: disable, 1: enabled
-*/
-void OVC3860::queryConfiguration() {
- sendData(OVC3860_QUERY_CONFIGURATION);
-}
-
-
-/*`
-  Enable PowerOn Auto Connection #MG
-
-  Command
-  #MG
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command enables the module to connect to the last used AG after PowerOn. The information
-  response and causes will indicate the command success or failure.
-
-  Syntax: AT#MG
-*/
-void OVC3860::autoconnEnable() {
-  sendData(OVC3860_AUTOCONN_ENABLE);
-}
-
-
-
-/*
-  Disable PowerOn Auto Connection #MH
-
-  Command
-  #MH
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command disables the module to connect to the Last used AG after PowerOn. The
-  information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MH
-*/
-void OVC3860::autoconnDisable() {
-  sendData(OVC3860_AUTOCONN_DISABLE);
-}
-
-
-/*
-  Connect to AV Source #MI
-
-  Command
-  #MI
-  Current Status(s)
-  A2DP State = 1
-  Possible Indication(s)
-  MA
-  MB
-  Indication Description
-  AV pause/stop Indication
-  AV play Indication
-
-  Description
-  If the module is connected with a HFP phone, this command causes the module try to connect to
-  the phone’s AV Source. The information response and causes will indicate the command success
-  or failure.
-  Note: Music will be played automatic after A2DP connected in some handset.
-
-  Syntax: AT#MI
-*/
-void OVC3860::connectA2DP() {
-  sendData(OVC3860_AV_SOURCE_CONNECT);
-}
-
-
-/*
-  Disconnect from AV Source #MJ
-
-  Command
-  #MJ
-  Current Status(s)
-  A2DP Status ≥ 3
-  Possible Indication(s)
-  MY
-  Indication Description
-  AV Disconnect Indication
-
-  Description
-  This module causes the module to disconnect from the connected phone’s AV source. The
-  information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MJ
-*/
-void OVC3860::disconnectA2DP() {
-  OVC3860::sendData(OVC3860_AV_SOURCE_DISCONNECT);
-}
-
-
-
-/*
-  Query AVRCP Status #MO
-
-  Command
-  #MO
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  ML<code>
-  <code> Status
-  1 Ready (to be connected)
-  2 Connecting
-  3 Connected
-  Indication Description
-  Report Current AVRCP Status
-
-  Description
-  This command queries the module’s AVRCP current status. The information response and causes
-  will indicate the command success or failure.
-
-  Syntax: AT#MO
-
-  Responce ML<code>:
-  <code>
-  1 Ready (to be connected)
-  2 Connecting
-  3 Connected
-
-*/
-void OVC3860::queryAvrcpStatus() {
-  OVC3860::sendData(OVC3860_QUERY_AVRCP_STATUS);
-}
-
-
-
-/*
-  Enable Auto Answer #MP
-
-  Command
-  #MP
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command enables the module auto answer an incoming call. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#MP
-*/
-void OVC3860::autoAnswerEnable() {
-  OVC3860::sendData(OVC3860_AUTO_ANSWER_ENABLE);
-}
-
-
-
-/*
-  Disable Auto Answer #MQ
-
-  Command
-  #MQ
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command disables the module auto answer an incoming call. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#MQ
-*/
-void OVC3860::autoAnswerDisable() {
-  OVC3860::sendData(OVC3860_AUTO_ANSWER_DISABLE);
-}
-
-
-/*
-  Start Fast Forward #MR
-
-  Command
-  #MR
-  Current Status(s)
-  A2DP Status = 5 OK
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted by Module
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV Source to start fast
-  forward. The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MR
-*/
-void OVC3860::musicStartFastForward() {
-  OVC3860::sendData(OVC3860_MUSIC_START_FF);
-}
-
-
-
-/*
-  Start Rewind #MS
-
-  Command
-  #MS
-  Current Status(s)
-  A2DP Status = 5
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted by Module
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV Source to start rewind.
-  The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MS
-*/
-void OVC3860::musicStartRewind() {
-  OVC3860::sendData(OVC3860_MUSIC_START_RWD);
-}
-
-
-/*
-  Stop Fast Forward / Rewind #MT
-
-  Command
-  #MT
-  Current Status(s)
-  A2DP Status = 5 (after started Fast Forward or Rewind)
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted by Module
-
-  Description
-  If the module is connected with a AV Source, this command causes the AV Source to stop fast
-  forward or rewind. The information response and causes will indicate the command success or failure.
-
-  Syntax: AT#MT
-*/
-void OVC3860::musicStopFFRWD() {
-  OVC3860::sendData(OVC3860_MUSIC_STOP_FF_RWD);
-}
-
-
-/*
-  Query A2DP Status #MV
-
-  Command
-  #MV
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  MU<code>
-  Indication Description
-  Report Current A2DP Status
-
-  Description
-  This command queries the module’s A2DP current status. The information response and causes
-  will indicate the command success or failure.
-
-  Syntax: AT#MV
-
-  Responce:
-  MU<code>:1-5, status of A2DP
-  1 Ready
-  2 Initiating
-  3 SignallingActive
-  4 Connected
-  5 Streaming
-*/
-void OVC3860::queryA2DPStatus(void){
-	sendData(OVC3860_QUERY_A2DP_STATUS);
-}
-
-
-
-/*
-  Write to Memory #MW
-
-  Command
-  #MW
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to write a byte into a given memory address. The information
-  response and causes will indicate the command success or failure.
-
-  Syntax: AT#MWADDR_VAL
-  ADDR: a given 32-bit, hexadecimal address
-  VAL: a written hexadecimal byte value
-*/
-void OVC3860::writeToMemory(const char* pExtraData, size_t ExtraDataSize) {
-  OVC3860::sendData(OVC3860_WRITE_TO_MEMORY, pExtraData, ExtraDataSize);
-}
-
-
-/*
-  Read from Memory #MX
-
-  Command
-  #MX
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  MEM:<val>
-  Indication Description
-  The Returned Value
-
-
-  Description
-  This command causes the module to read a byte from a given memory address. The information
-  response and causes will indicate the returned value from module reading.
-
-  Syntax: AT#MXADDR
-  ADDR: a given 32-bit, hexadecimal address
-  <val>: a read hexadecimal byte value
-*/
-void OVC3860::readFromMemory(const char* pExtraData, size_t ExtraDataSize) {
-  OVC3860::sendData(OVC3860_READ_FROM_MEMORY, pExtraData, ExtraDataSize);
-}
-
-
-/*
-  Switch Two Remote Devices #MZ
-
-  Command
-  #MZ
-  Current Status(s)
-  Any
-  Possible
-  Indication(s)
-  SW
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to switch two remote devices. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#MZ
-*/
-void OVC3860::switchDevices() {
-  sendData(OVC3860_SWITCH_DEVICES);
-}
-
-
-
-/*
-  SPP data transmit #ST
-
-  Command
-  #ST
-  Current Status(s)
-  When SPP is connected
-  Possible Indication(s)
-  OK
-  IndicationDescription
-  Command Accepted
-
-
-  Description
-  This command will send SPP data to the remote device.
-
-  Syntax: AT#STdata
-  data: the string you need to send. The max len is 20.
-*/
-void OVC3860::sppDataTransmit(const char* pExtraData, size_t ExtraDataSize) {
-  OVC3860::sendData(OVC3860_SPP_DATA_TRANSMIT, pExtraData, ExtraDataSize);
-}
-
-
-/*
-  Set Clock Debug Mode #VC
-  Command
-  #VC
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  IndicationDescription
-  Command Accepted
-
-  Description
-  This command causes the module to enter clock debug mode. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#VC
-*/
-void OVC3860::setClockdebugMode() {
-  sendData(OVC3860_SET_CLOCKDEBUG_MODE);
-}
-
-
-/*
-  Speaker Volume Down #VD
-
-  Command
-  #VD
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  IndicationDescription
-  Command Accepted
-
-  Description
-  This command causes the module to decrease the speaker volume. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#VD
-*/
-void OVC3860::volumeDown() {
-  OVC3860::sendData(OVC3860_VOLUME_DOWN);
-}
-
-
-/*
-  Enter BQB Test Mode #VE
-
-  Command
-  #VE
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  IndicationDescription
-  Command Accepted
-
-  Description
-  This command causes the module to enter test mode. The information response and causes will
-  indicate the command success or failure.
-
-  Syntax: AT#VE
-*/
-void OVC3860::enterBQBTestMode() {
-  sendData(OVC3860_ENTER_TEST_MODE);
-}
-
-
-/*
-  Set to Fixed Frequency #VF
-
-  Command
-  #VF
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to work at 2404MHz. The information response and causes will
-  indicate the command success or failure.
-
-  Syntax: AT#VF
-*/
-void OVC3860::setFixedFrequency() {
-  OVC3860::sendData(OVC3860_SET_FIXED_FREQUENCY);
-}
-
-
-/*
-  Enter EMC Test Mode #VG
-
-  Command
-  #VG
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to work at 2404MHz. The information response and causes will
-  indicate the command success or failure.
-
-  Syntax: AT#VGxx_yy
-
-  xx: if set to be 0~78, the frequency is fixed at (2402+xx)MHz, If set to 88, the frequency is in
-  hopping mode.
-
-  yy: set the tx packet type according to the following table.
-
-  Packet Type Value
-  DH1          '04
-  DH3          '08
-  DH5           10
-  2DH1         '05
-  2DH3          11
-  2DH5          13
-  3DH1         '06
-  3DH3          12
-  3DH5          14
-*/
-void OVC3860::enterEMCTestMode(const char* pExtraData, size_t ExtraDataSize){
-  OVC3860::sendData(OVC3860_EMC_TEST_MODE, pExtraData, ExtraDataSize);
-}
-
-
-/*
-  Set RF Register #VH
-
-  Command
-  #VH
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to set a RF register with a given value. The information
-  response and causes will indicate the command success or failure.
-
-  Syntax: AT#VHxx_yy
-  xx: a register address
-  yy: a byte value
-  Example: AT#VH54_88(set RF reg 0x54 to be 0x88)
-*/
-void OVC3860::setRFRegister(const char* pExtraData, size_t ExtraDataSize){
-  OVC3860::sendData(OVC3860_SET_RF_REGISTER, pExtraData, ExtraDataSize);
-}
-
-
-
-/*
-  Start Inquiry #VI
-
-  Command
-  #VI
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to inquiry Bluetooth devices. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#VI
-*/
-void OVC3860::inquiryStart() {
-  OVC3860::sendData(OVC3860_INQUIRY_START);
-}
-
-
-/*
-  Cancel Inquiry #VJ
-
-  Command
-  #VJ
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to cancel inquiry Bluetooth devices. The information response
-  and causes will indicate the command success or failure.
-
-  Syntax: AT#VJ
-*/
-void OVC3860::inquiryStop() {
-  OVC3860::sendData(OVC3860_INQUIRY_STOP);
-}
-
-
-/*
-  Speaker Volume Up #VU
-
-  Command
-  #VU
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to increase the speaker volume. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#VU
-*/
-void OVC3860::volumeUp() {
-  OVC3860::sendData(OVC3860_VOLUME_UP);
-}
-
-
-/*
-  Power Off OOL #VX
-
-  Command
-  #VX
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  OK
-  Indication Description
-  Command Accepted
-
-  Description
-  This command causes the module to power off OOL. The information response and causes will
-  indicate the command success or failure.
-
-  Syntax: AT#VX
-*/
-void OVC3860::shutdown() {
-  OVC3860::sendData(OVC3860_SHUTDOWN_MODULE);
-}
-
-
-
-/*
-  Change Local Device Name Casually #MM
-
-  Command
-  #MM
-  Current Status(s)
-  Any
-  Parameters
-  [new name]
-  Possible Indication(s)
-  [MM<current name>]
-  Indication Description
-  Report Current Local Device Name
-
-  Description
-  This command causes the module to change the device name. The information response and causes will indicate the command
-  success or failure.
-
-  Syntax: AT#MM<new name>
-
-  Value:< new name >: local device name
-
-  ※ If new name is empty, the module will report current local device name.
-
-  example:
-  AT#MMMy Car Kit\r\n :the new name is “My Car Kit”
-  AT#MM\r\n :indication will be MM<current name>
-*/
-void OVC3860::changeLocalName(const char* pExtraData, size_t ExtraDataSize) {
-  OVC3860::sendData(OVC3860_CHANGE_LOCAL_NAME, pExtraData, ExtraDataSize);
-}
-
-/*
-  Change Local Device Pin Code #MN
-
-  Command
-  #MN
-  Current Status(s)
-  Any
-  Parameters
-  [new pin]
-  Possible Indication(s)
-  [MN<current pin>]
-  Indication Description
-  Report current local device Pin code
-
-  Description
-  This command causes the module to change the device pin code. The information response and causes will indicate the
-  command success or failure.
-
-  Syntax: AT#MN<new pin>\r\n
-
-  Value:<new pin >: local device pin (4 digital),
-
-  ※ If new pin is empty, the module will report current local pin code.
-
-  example:
-  AT#MN1234 :the new pin is :1234
-  AT#MN :indication will be MP<current pin>
-*/
-void OVC3860::changePin(const char* pExtraData, size_t ExtraDataSize) {
-  OVC3860::sendData(OVC3860_CHANGE_PIN, pExtraData, ExtraDataSize);;
-}
-
-
-/* taken from BLK-MD-SPK-B AT Command Application Guide, did not work on module for me (kovo)
-    pdf: https://github.com/tomaskovacik/kicad-library/blob/master/library/datasheet/OVC3860_based_modules/BLK-MD-SPK-B_AT_Command_set_original.pdf
-  Query Module Software Version #MY
-
-  Command
-  #MY
-  Current Status(s)
-  Any
-  Parameters
-  MW<version>
-  Indication Description
-  Report Module Software Version
-
-  Description
-  This command queries the module’s software version. The information response and causes will indicate the command
-  success or failure.
-
-  Syntax: AT#MY
-*/
-void OVC3860::queryVersion() {
-  OVC3860::sendData(OVC3860_QUERY_VERSION);
-}
-
-
-/*
-  Synchronize Phonebook Stored by SIM(via AT Command) #PA
-
-  Command
-  #PA
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PA1
-  PA0
-  Indication Description
-  Phonebook Synchronize Indication
-  Command Not Supported
-
-  Description
-  This command causes the module to synchronize the phonebook which is stored by SIM. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#PA
-*/
-void OVC3860::pbSyncBySim() {
-  OVC3860::sendData(OVC3860_PB_SYNC_BY_SIM);
-}
-
-
-/*
-  Read Next One Phonebook Item #PC
-
-  Command
-  #PC
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  IP<lehgth>
-  PB<phonebook>
-  PC
-  Indication Description
-  Length of Phone Number
-  One Phonebook Indication
-  End of Phonebook/Call History
-
-  Description
-  This command causes the module to read next one phonebook item from phone or local. The information response and causes
-  will indicate the command success or failure.
-
-  Syntax: AT#PC
-*/
-void OVC3860::pbReadNextItem() {
-  OVC3860::sendData(OVC3860_PB_READ_NEXT_ITEM);
-}
-
-
-
-/*
-  Read Previous One Phonebook Item #PD
-
-  Command
-  #PD
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  IP<lehgth>
-  PB<phonebook>
-  PC
-  Indication Description
-  Length of Phone Number
-  One Phonebook Indication
-  End of Phonebook/Call History
-
-  Description
-  This command causes the module to read previous one phonebook item from phone or local. The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#PD
-*/
-void OVC3860::pbReadPreviousItem() {
-  OVC3860::sendData(OVC3860_PB_READ_PREVIOUS_ITEM);
-}
-
-
-/*
-  Synchronize Dialed Calls List (via AT Command) #PH
-
-  Command
-  #PH
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PA1
-  PA0
-  Indication Description
-  Phonebook Synchronize Indication
-  Command Not Supported
-
-  Description
-  This command causes the module to synchronize the dialed calls list. The information response and causes will indicate the
-  command success or failure.
-
-  Syntax: AT#PH
-  */
-void OVC3860::pbSyncByDialer() {
-  OVC3860::sendData(OVC3860_PB_SYNC_BY_DIALED);
-}
-
-
-/*
-  Synchronize Received Calls List (via AT Command) #PI
-
-  Command
-  #PI
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PA1
-  PA0
-  Indication Description
-  Phonebook Synchronize Indication
-  Command Not Supported
-
-  Description
-  This command causes the module to synchronize the received calls list. The information response and causes will indicate the
-  command success or failure.
-
-  Syntax: AT#PI
-*/
-void OVC3860::pbSyncByReceiver() {
-  OVC3860::sendData(OVC3860_PB_SYNC_BY_RECEIVED);
-}
-
-
-
-/*
-  Synchronize Missed Calls List (via AT Command) #PJ
-
-  Command
-  #PJ
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PA1
-  PA0
-  Indication Description
-  Phonebook Synchronize Indication
-  Command Not Supported
-
-  Description
-  This command causes the module to synchronize the missed calls list. The information response and causes
-  will indicate the command success or failure.
-
-  Syntax: AT#PJ
-*/
-void OVC3860::pbSyncByMissed() {
-  OVC3860::sendData(OVC3860_PB_SYNC_BY_MISSED);
-}
-
-/*
-  Synchronize Last Call List (via AT Command) #PK
-
-  Command
-  #PK
-  Current Status(s)
-  HFP Status = 3
-  Possible Indication(s)
-  PA1
-  PA0
-  Indication Description
-  Phonebook Synchronize Indication
-  Command Not Supported
-
-  Description
-  This command causes the module to synchronize the last call list. The information response and causes will indicate the
-  command success or failure.
-
-  Syntax: AT#PK
-*/
-void OVC3860::pbSyncByLastCall() {
-	OVC3860::sendData(OVC3860_PB_SYNC_BY_LAST_CALL);
-}
-
-/*
-  Get Recent Dialed Call History (record by module) #PL
-
-  Command
-  #PL
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  IP<length>
-  MN<phone number>
-  PC
-  Indication Description
-  Length of Phone Number Indication
-  One Phonebook Indication
-  End of Phonbook/Call History Download Ind
-
-  Description
-  This command causes the module to read one of recently dialed call number(record by module). The information response and
-  causes will indicate the command success or failure.
-
-  Syntax: AT#PL
-*/
-void OVC3860::getLocalLastDialedList() {
-  OVC3860::sendData(OVC3860_GET_LOCAL_LAST_DIALED_LIST);
-}
-
-
-
-/*
-  Get Recent Received Call History (record by module) #PM
-
-  Command
-  #PM
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  IP<length>
-  MN<phone number>
-  PC
-  Indication Description
-  Length of Phone Number Indication
-  One Phonebook Indication
-  End of Phonbook/Call History Download Ind
-
-  Description
-  This command causes the module to read one of recently received call number(record by module). The information response
-  and causes will indicate the command success or failure.
-
-  Syntax: AT#PM
-*/
-void OVC3860::getLocalLastReceivedList() {
-  OVC3860::sendData(OVC3860_GET_LOCAL_LAST_RECEIVED_LIST);
-}
-
-
-/*
-  Get Recent Missed Call History (record by module) #PN
-
-  Command
-  #PN
-  Current Status(s)
-  Any
-  Possible Indication(s)
-  IP<length>
-  MN<phone number>
-  PC
-  Indication Description
-  Length of Phone Numbervoid print Indication
-  One Phonebook Indication
-  End of Phonbook/Call History Download Ind
-
-  Description
-  This command causes the module to read one of recently missed call number(record by module). The information response
-  and causes will indicate the command success or failure.
-
-  Syntax: AT#PN
-*/
-void OVC3860::getLocalLastMissedList() {
-  OVC3860::sendData(OVC3860_GET_LOCAL_LAST_MISSED_LIST);
-}
-
-
-
-/*
-  Dial Last Received Phone Number #PO
-
-  Command
-  #PO
-  Current Status(s)
-  HFP Status = 3 | 6
-  Possible Indication(s)
-  IC
-  IP<length>
-  IR<phone number>
-  Indication Description
-  Outgoing Call Indication
-  Length of Phone Number Indication
-  Current Call Indication
-
-  Description
-  This command causes the module to dial last received phone number. The information response and causes will indicate the
-  command success or failure.
-
-  Note: IP,IR indication only supported by HFP1.5 version.
-
-  Syntax: AT#PO
-*/
-void OVC3860::dialLastReceivedCall() {
-  OVC3860::sendData(OVC3860_DIAL_LAST_RECEIVED_CALL);
-}
-
-
-
-/*
-  Clear Call History (record by module) #PR
-
-  Command
-  Current Status(s)
-  Possible Indication(s) Indication Description
-  #PO
-  Any
-  OK
-  Command Accepted by Module
-
-  Description
-  This command causes the module to clear call history(record by module). The information response and causes will indicate
-  the command success or failure.
-
-  Syntax: AT#PR
-*/
-void OVC3860::clearLocalCallHistory() {
-  OVC3860::sendData(OVC3860_CLEAR_LOCAL_CALL_HISTORY);
-}
-
-
-/* ---------------------------------------------------------
- *
- * 							OVC3860
- * 						COMMINUCATION module methods
- *
- *
- ---------------------------------------------------------  */
+/**
+  ******************************************************************************
+  * @file    OVC3860_device.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 hardware and audio/ phone classes.
+  *          This file provides code to manage OVC3860 audio/ phone.
+  *          It is written in C++ and SMT32 HAL.
+  *          To write this module author uses helpful informations from:
+  *          		- OVC3860 AT Command Application Notes Revision:1.1
+  *          		- BLK-MD-SPK-B AT 命令应用指导 pdf
+  *          		- https://github.com/tomaskovacik/OVC3860
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+
+#include "OVC3860_CMDdefinition.h"
+#include <assert.h>
+#include "OVC3860_device.h"
+
+constexpr OVC3860ResponsePattern OVC3860::responseRegistry[];		//definition of constexpr table (flash), see OVC3860_device.h
+constexpr OVC3860ResponseTransition OVC3860::responseTransitions[];	//definition of constexpr table (flash), see OVC3860_device.h
+
+
+#if OVC3860_FEATURE_MEMORY
+/**
+  * @brief	Format value as upper case hex digits.
+  * @note	Used instead of sprintf() to build #MX / #MW
+  * 		 parameters. No '\0' is added.
+  *
+  * @param	value - value to format
+  * @param	digits - number of digits, leading zeros are added
+  * @param	pHex - destination, at least "digits" long
+  * @retval	n/a
+  */
+static void valueToHex(uint32_t value, uint8_t digits, char* pHex){
+	static const char hexDigits[] = "0123456789ABCDEF";
+	while (digits > 0)
+	{
+		digits--;
+		pHex[digits] = hexDigits[value & 0xF];
+		value >>= 4;
+	}
+}
+
+/**
+  * @brief	Parse hex digits (upper / lower case).
+  *
+  * @param	pHex - digits, do not have to be ended with '\0'
+  * @param	length - number of digits
+  * @param	pValue - parsed value
+  * @retval	false - no digits or not hex character found
+  */
+static bool hexToValue(const char* pHex, size_t length, uint32_t* pValue){
+	uint32_t value = 0;
+	if (length == 0 || length > 8)
+		return false;
+	for (size_t i = 0; i < length; i++)
+	{
+		char c = pHex[i];
+		uint8_t nibble;
+		if (c >= '0' && c <= '9')
+			nibble = c - '0';
+		else if (c >= 'A' && c <= 'F')
+			nibble = c - 'A' + 10;
+		else if (c >= 'a' && c <= 'f')
+			nibble = c - 'a' + 10;
+		else
+			return false;
+		value = (value << 4) | nibble;
+	}
+	*pValue = value;
+	return true;
+}
+#endif /* OVC3860_FEATURE_MEMORY */
+
+
+/**
+  * @brief
+  * @note
+  *
+  * @param
+  * @param
+  * @param
+  * @retval
+  */
+
+
+
+
+
+
+
+/* ---------------------------------------------------------
+ *
+ * 							OVC3860
+ * 						HADRWARE depend methods
+ *
+ *
+ ---------------------------------------------------------  */
+
+/**
+  * @brief	Hardware constructor
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_ReceiveBufferType
+  * 		- OVC3860_ReceiveBufferSize
+  * 		in OVC3860_device.h file and choose transport
+  * 		in OVC3860_Transport.h file.
+  *
+  * @param  Transport - transport object (handle), it is copied
+  * @retval n/a
+  */
+OVC3860HardWare::OVC3860HardWare(const OVC3860Transport& Transport)
+		: transport(Transport)
+{
+	resetLow();
+}
+
+#ifdef OVC3860_TRANSPORT_STM32HAL
+/**
+  * @brief	Hardware constructor
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_ReceiveBufferType
+  * 		- OVC3860_ReceiveBufferSize
+  * 		in OVC3860_device.h file and:
+  * 		- OVC3860_resetLineHigh
+  * 		- OVC3860_resetLineLow
+  * 		in OVC3860_TransportSTM32.h file.
+  *
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
+  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
+  * @retval n/a
+  */
+OVC3860HardWare::OVC3860HardWare(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin)
+		: transport(huart, ResetGPIOx, GPIO_Pin)
+{
+	resetLow();
+}
+#endif
+
+/**
+  * @brief Object destructor.
+  * @note  n/a
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+OVC3860HardWare::~OVC3860HardWare(){
+	resetLow();
+}
+
+/**
+  * @brief	Set OVC3860 reset pin high.
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_resetLineHigh
+  * 		- OVC3860_resetLineLow
+  * 		in OVC3860_TransportSTM32.h file.
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+void OVC3860HardWare::resetHigh(void){
+	transport.setResetLine(true);
+}
+
+/**
+  * @brief	Set OVC3860 reset pin low.
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_resetLineHigh
+  * 		- OVC3860_resetLineLow
+  * 		in OVC3860_TransportSTM32.h file.
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+void OVC3860HardWare::resetLow(void){
+	transport.setResetLine(false);
+}
+
+/**
+  * @brief	Do module reset procedure.
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_resetLineHigh
+  * 		- OVC3860_resetLineLow
+  * 		in OVC3860_TransportSTM32.h file.
+  *
+  * 		Blocks only for reset pulse width, readiness of
+  * 		 module is reported later by getResetPhase().
+  *
+  * 		Remember that entering config mode (OVC3860PSKey
+  * 		 class) rquires to send appropriate command ASAP
+  * 		  after resetHigh();
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+void OVC3860HardWare::resetModule(void){
+	startReset();
+	delay(resetPulseWidth);
+	serviceReset();
+}
+
+/**
+  * @brief	Start non-blocking module reset.
+  * @note	Reset line goes low at once, it goes high in
+  * 		 serviceReset() (OVC3860::periodicTask(void)) when
+  * 		 reset pulse width elapses. Host may do other work
+  * 		 meanwhile.
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+void OVC3860HardWare::startReset(void){
+	resetLow();
+	ResetPhase = ResetPulse;
+	resetPhaseStart = getTick();
+}
+
+/**
+  * @brief	Move reset sequence forward.
+  * @note	Execute it periodically (OVC3860::periodicTask(void)
+  * 		 does it). Readiness is set by WELCOME / IS
+  * 		 indication, not by fixed delay.
+  *
+  * @param  n/a
+  * @retval actual phase of reset sequence
+  */
+OVC3860HardWare::resetPhase OVC3860HardWare::serviceReset(void){
+	uint32_t timeStamp = getTick();
+
+	if (ResetPhase == ResetPulse && (timeStamp - resetPhaseStart) >= resetPulseWidth)
+	{
+		resetHigh();
+		ResetPhase = ResetBooting;
+		resetPhaseStart = timeStamp;
+	}
+	else if (ResetPhase == ResetBooting && (timeStamp - resetPhaseStart) >= OVC3860_ResetReadyTimeout)
+	{
+		ResetPhase = ResetTimeout;
+	}
+	return ResetPhase;
+}
+
+/**
+  * @brief	Module reported readiness (WELCOME / IS).
+  * @note	Indications received when no reset is in progress
+  * 		 (i.e. power on, AT#CZ) also set ResetReady.
+  */
+void OVC3860HardWare::moduleReady(void){
+	if (ResetPhase == ResetBooting)
+		bootTime = getTick() - resetPhaseStart;
+	if (ResetPhase != ResetPulse)
+		ResetPhase = ResetReady;
+}
+
+/**
+  * @brief	Actual phase of reset sequence.
+  */
+OVC3860HardWare::resetPhase OVC3860HardWare::getResetPhase(void) const{
+	return ResetPhase;
+}
+
+/**
+  * @brief	Check if module reported readiness after reset.
+  */
+bool OVC3860HardWare::isModuleReady(void) const{
+	return ResetPhase == ResetReady;
+}
+
+/**
+  * @brief	Set min. time of reset line low state.
+  * @note	Takes effect with next reset.
+  *
+  * @param  ms - pulse width in ms
+  * @retval n/a
+  */
+void OVC3860HardWare::setResetPulseWidth(uint32_t ms){
+	resetPulseWidth = ms;
+}
+
+uint32_t OVC3860HardWare::getResetPulseWidth(void) const{
+	return resetPulseWidth;
+}
+
+/**
+  * @brief	Time between reset line high and WELCOME / IS
+  * 		 of the last reset.
+  * @retval	ms, 0 if module was never reset by startReset()
+  */
+uint32_t OVC3860HardWare::getBootTime(void) const{
+	return bootTime;
+}
+
+/**
+  * @brief	Time left to the next step of reset sequence.
+  * @note	Used by OVC3860::getTimeToNextDeadline(void).
+  *
+  * @param	pTimeLeft - ms, 0 if step is already due
+  * @retval	false - no reset in progress, pTimeLeft is not changed
+  */
+bool OVC3860HardWare::getTimeToResetDeadline(uint32_t* pTimeLeft) const{
+	uint32_t phaseTime;
+	uint32_t elapsed = getTick() - resetPhaseStart;
+
+	if (ResetPhase == ResetPulse)
+		phaseTime = resetPulseWidth;
+	else if (ResetPhase == ResetBooting)
+		phaseTime = OVC3860_ResetReadyTimeout;
+	else
+		return false;
+
+	*pTimeLeft = (elapsed >= phaseTime) ? 0 : phaseTime - elapsed;
+	return true;
+}
+
+/**
+  * @brief	Blocking delay.
+  * @note  	With FreeRTOS (OVC3860_USE_FREERTOS) calling task
+  * 		 sleeps with vTaskDelay, otherwise transport delay
+  * 		 is used.
+  *
+  * @param  ms - delay time in ms
+  * @retval n/a
+  */
+void OVC3860HardWare::delay(uint32_t ms){
+#ifdef OVC3860_USE_FREERTOS
+	vTaskDelay(pdMS_TO_TICKS(ms));
+#else
+	transport.delay(ms);
+#endif
+}
+
+/**
+  * @brief	Time base of the library.
+  * @note  	Used to time stamp events (i.e. codec telemetry)
+  * 		 and to count timeouts.
+  *
+  * @param  n/a
+  * @retval time in ms
+  */
+uint32_t OVC3860HardWare::getTick(void) const{
+	return transport.getTick();
+}
+
+/* ---------------------------------------------------------
+ *
+ * 							OVC3860
+ * 						HADRWARE depend methods
+ *
+ *
+ ---------------------------------------------------------  */
+
+
+
+/* ---------------------------------------------------------
+ *
+ * 							OVC3860
+ * 						COMMINUCATION module methods
+ *
+ *
+ ---------------------------------------------------------  */
+
+#ifdef OVC3860_TRANSPORT_STM32HAL
+/**
+  * @brief	Object constructor
+  * @note  	You should also remember to set values of:
+  * 		- OVC3860_ReceiveBufferType
+  * 		- OVC3860_ReceiveBufferSize
+  * 		in OVC3860_device.h file and:
+  * 		- OVC3860_resetLineHigh
+  * 		- OVC3860_resetLineLow
+  * 		in OVC3860_TransportSTM32.h file.
+  *
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  ResetGPIOx	Pointer to a port where reset pin is soldered
+  * @param  GPIO_Pin	pin number of a port where reset pin is soldered
+  * @retval n/a
+  */
+OVC3860::OVC3860(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin)		//TODO: dodać obsługę pinu reset
+		: OVC3860HardWare(huart  /*in DMA mode*/, ResetGPIOx, GPIO_Pin)
+{
+	publishStateSnapshot();
+}
+#endif
+
+/**
+  * @brief	Object constructor
+  * @note	Transport independent version, i.e. for POSIX
+  * 		 serial port or loopback.
+  *
+  * @param	Transport - transport object (handle), it is copied
+  * @retval	n/a
+  */
+OVC3860::OVC3860(const OVC3860Transport& Transport)
+		: OVC3860HardWare(Transport)
+{
+	publishStateSnapshot();
+}
+
+/**
+  * @brief Object destructor.
+  * @note  n/a
+  *
+  * @param  n/a
+  * @retval n/a
+  */
+OVC3860::~OVC3860(void)
+{
+
+}
+
+
+/**
+  * @brief	search '\r','\n' string in circular buffer.
+  * @note	Search for \r\n sequence do not change circular
+  * 		 buffer tail head values.
+  * 		This function could be also used to detect end
+  * 		 of OVC3860 communicate and set the flag to
+  * 		 start decodeReceivedString(void);
+  *
+  * @param
+  * @retval	circularBufferSearchResult struct with:
+  * 			- bool isFound;
+  * 			- size_t tail2virtualTail_;
+  * 		for more details take a look at CircularBuffer
+  * 		class.
+  */
+circularBufferSearchResult OVC3860::detectRN(void){
+		return SearchItem("\r\n", 2, false);
+}
+
+/**
+  * @brief	Get data from OVC3860.
+  * @note 	Get data from OVC3860 uart and store it in circular
+  * 		 buffer.
+  * 		 Because OVC3860 uses asynchronous communication, both:
+  * 		 - as a answer to command,
+  * 		 - and in some cases periodic,
+  * 		 this method should be executed ASAP after
+  * 		 uart reception i.e. in DMA / interrupt handling
+  * 		 function.
+  * 		To detect if there are any new data in buffer use
+  * 		 detectRN(void) method;
+  *
+  * @param	n/a
+  * @retval	n/a - data is storeg in circular buffer.
+  */
+void OVC3860::getData(uint8_t RxBuff){
+	  if (!isOverflowed())
+	  {
+		  put(RxBuff);
+	  }
+}
+
+/**
+  * @brief	Get block of data from OVC3860.
+  * @note	Same as getData(uint8_t) for each byte, but data
+  * 		 is copied with CircularBuffer::putN(). Bytes which
+  * 		 do not fit overwrite the oldest ones and set
+  * 		 overflow, as put() does.
+  *
+  * @param	pRxBuff - received data
+  * @param	size - number of received bytes
+  * @retval	n/a
+  */
+void OVC3860::getData(const uint8_t* pRxBuff, size_t size){
+	if (isOverflowed())
+		return;
+	size_t stored = putN(pRxBuff, size);
+	while (stored < size)
+		put(pRxBuff[stored++]);
+}
+
+/**
+  * @brief	Decode OVC uart communicates.
+  * @note	Beacause OVC3860 uses asynchronous communication, both:
+  * 		 - as a answer to command,
+  * 		 - and in some cases periodic,
+  * 		 this method should be executed as frequent as it is
+  * 		  required.
+  *
+  * 		After command parsing method sets tail positnion after
+  * 		 the oldest \r\n sequence.
+  *
+  * 		Status queries triggered by indications are not sent
+  * 		 here, they are merged by PollScheduler and sent by
+  * 		 periodicTask(void).
+  *
+  * @param	n/a
+  * @retval	uint8_t retVal - to be honest I do not know what is
+  * 		 it fore but was in source code that I studied.
+  * 		 	Maybe it is better to rewrite it to return parsed
+  * 		 	 command type (enum STATES).
+  */
+uint8_t OVC3860::decodeReceivedString(void){
+
+	serviceTransmit();					//commands queued while UART was busy
+	receiveFromTransport();
+	circularBufferSearchResult bufferState = detectRN();
+	OVC3860_reponse parsedCommand = NO_MESSAGE;
+	uint8_t retVal = 1;
+
+	if (bufferState.isFound== true)		//OVC3860 receive buf_ (receive buffer) contains "\r\n" sequence which means that OVC386 send compleet message
+	{
+
+		size_t searchRange = bufferState.tail2virtualTail_ + 2; /* +2 because "\r\n"*/
+
+		//received command parsing, pattern has to start the line (range == pattern length),
+		//so parameters (i.e. "MMCar Kit", "MWV1.IS2") are not taken for other indication
+		for (size_t i = 0; i < responseRegistryLength; i++)
+		{
+			if (responseRegistry[i].length <= searchRange
+					&& SearchItemTail2Range(responseRegistry[i].pattern, responseRegistry[i].length, responseRegistry[i].length, false).isFound)
+			{
+				parsedCommand = (OVC3860_reponse) responseRegistry[i].code;
+				break;
+			}
+		}
+		//received command parsing
+
+		if (parsedCommand != NO_MESSAGE)
+			retVal = applyTransition(responseTransitions[parsedCommand]);
+
+		//move tail_ to the end of the parsed command
+		 SearchItem("\r\n", 2);
+		 skipBufferItem(2);
+		 //move tail_ to the end of command
+
+		publishStateSnapshot();
+	}
+	return retVal;
+}
+
+/**
+  * @brief	Decode all complete lines waiting in circular buffer.
+  * @note	decodeReceivedString(void) decodes one line per call,
+  * 		 so during bursts (connection, phonebook) backlog
+  * 		 grows if main loop does other job between calls.
+  * 		 process() decodes lines until buffer has no complete
+  * 		 line or budget is used:
+  * 		 - lineBudget - max. number of decoded lines,
+  * 		 - timeBudget - ms (getTick()), checked before each line.
+  * 		Use small budget to keep main loop latency low, big one
+  * 		 to avoid circular buffer overflow.
+  *
+  * @param	lineBudget - max. lines, OVC3860_AllLines - no limit
+  * @param	timeBudget - max. time in ms, OVC3860_NoDeadline - no limit
+  * @retval	number of complete lines left in circular buffer
+  */
+uint32_t OVC3860::process(uint32_t lineBudget, uint32_t timeBudget){
+	uint32_t startTime = getTick();
+
+	receiveFromTransport();
+	while (detectRN().isFound)
+	{
+		if (lineBudget == 0 || getTick() - startTime >= timeBudget)
+			return countReceivedLines();
+		decodeReceivedString();
+		lineBudget--;
+	}
+	return 0;
+}
+
+/**
+  * @brief	Number of complete ("\r\n" terminated) lines in
+  * 		 circular buffer.
+  */
+uint32_t OVC3860::countReceivedLines(void) const{
+	uint32_t lines = 0;
+
+	for (const_iterator item = begin(); item != end(); ++item)
+		if (*item == '\n')
+			lines++;
+	return lines;
+}
+
+/**
+  * @brief	Apply decoded indication to object state.
+  * @note	Transition (OVC3860::responseTransitions line) gives:
+  * 		 - parameter parser, run first because it reads
+  * 		   the rest of the line from circular buffer,
+  * 		 - state field and its new value,
+  * 		 - follow-up actions (bit mask).
+  *
+  * @param	transition - line of responseTransitions
+  * @retval	0 - module reported error (EPER, ERR, NOEP), 1 - OK
+  */
+uint8_t OVC3860::applyTransition(const OVC3860ResponseTransition& transition){
+	static const STATES HFPStatus[] = {Ready, Connecting, Connected, OutgoingCall, IncomingCall, OngoingCall};	//MG1..MG6
+	static const STATES AVRCPStatus[] = {Ready, Connecting, Connected};											//ML1..ML3
+	static const STATES A2DPStatus[] = {Ready, Initializing, SignallingActive, Connected, Streaming};			//MU1..MU5
+	uint32_t timeStamp = getTick();
+
+	switch (transition.parser)
+	{
+	case OVC3860ResponseTransition::ParserHFPStatus:
+		readStatusDigit(HFPStatus, sizeof(HFPStatus) / sizeof(HFPStatus[0]), &HFPState);
+		break;
+	case OVC3860ResponseTransition::ParserAVRCPStatus:
+		readStatusDigit(AVRCPStatus, sizeof(AVRCPStatus) / sizeof(AVRCPStatus[0]), &AVRCPState);
+		break;
+	case OVC3860ResponseTransition::ParserA2DPStatus:
+		if (readStatusDigit(A2DPStatus, sizeof(A2DPStatus) / sizeof(A2DPStatus[0]), &A2DPState)
+				&& (A2DPState == Connected || A2DPState == Streaming))
+			LinkSupervisor.linkRestored(OVC3860LinkSupervisor::A2DP, timeStamp);
+		break;
+	case OVC3860ResponseTransition::ParserAutoAnswerConnect:	//MFXY
+		skipBufferItem(2);
+		switch (OVC3860::get()) {
+		  case '0': AutoAnswer = Off; break;
+		  case '1': AutoAnswer = On; break;
+		}
+		switch (OVC3860::get()) {
+		  case '0': AutoConnect = Off; break;
+		  case '1': AutoConnect = On; break;
+		}
+		ConfigCache.setAutoAnswer(AutoAnswer == On);
+		ConfigCache.setAutoConnect(AutoConnect == On);
+		break;
+	case OVC3860ResponseTransition::ParserVersion:
+	{
+		char version[OVC3860_CacheVersionLength];
+		size_t length = readParameter(2, version, sizeof(version));
+		if (length > 0)
+			ConfigCache.setVersion(version, length);
+		break;
+	}
+	case OVC3860ResponseTransition::ParserName:
+	{
+		char name[OVC3860_CacheNameLength];
+		size_t length = readParameter(2, name, sizeof(name));
+		if (length > 0)
+			ConfigCache.setName(name, length);
+		break;
+	}
+	case OVC3860ResponseTransition::ParserPin:
+	{
+		char pin[OVC3860_CachePinLength];
+		size_t length = readParameter(2, pin, sizeof(pin));
+		if (length > 0)
+			ConfigCache.setPin(pin, length);
+		break;
+	}
+#if OVC3860_FEATURE_MEMORY
+	case OVC3860ResponseTransition::ParserMemory:	//MEM:<val> answer to #MX
+	{
+		char parameter[8];
+		uint32_t value;
+		size_t parameterLength = readParameter(4, parameter, sizeof(parameter));
+		if (hexToValue(parameter, parameterLength, &value))
+			memoryReadReceived((uint8_t) value);
+		break;
+	}
+	case OVC3860ResponseTransition::ParserMemoryError:
+		memoryReadRefused();
+		break;
+#endif /* OVC3860_FEATURE_MEMORY */
+	case OVC3860ResponseTransition::ParserVolume:	//VOL<xx>, decimal level
+	{
+		char parameter[3];
+		uint8_t level = 0;
+		size_t parameterLength = readParameter(3, parameter, sizeof(parameter));
+		size_t i = 0;
+		while (i < parameterLength && parameter[i] >= '0' && parameter[i] <= '9')
+			level = level * 10 + (parameter[i++] - '0');
+		if (i > 0 && i == parameterLength)
+		{
+			VolumeControl.volumeReported(level, timeStamp);
+			serviceVolume(timeStamp);					//next steps go out at once
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	if (transition.field != OVC3860ResponseTransition::FieldNone)
+		*getStateField(transition.field) = (STATES) transition.value;
+	if (transition.parser == OVC3860ResponseTransition::ParserCodec)
+		codecChanged(timeStamp);
+
+	uint8_t actions = transition.actions;
+	if (actions & OVC3860ResponseTransition::ActionPowerOn)
+		PowerState = On;
+	if (actions & OVC3860ResponseTransition::ActionHangUp)
+		CallState = PhoneHangUp;
+	if (actions & OVC3860ResponseTransition::ActionHFPLost)
+		LinkSupervisor.linkLost(OVC3860LinkSupervisor::HFP, timeStamp);
+	if (actions & OVC3860ResponseTransition::ActionHFPRestored)
+		LinkSupervisor.linkRestored(OVC3860LinkSupervisor::HFP, timeStamp);
+	if (actions & OVC3860ResponseTransition::ActionA2DPLost)
+		LinkSupervisor.linkLost(OVC3860LinkSupervisor::A2DP, timeStamp);
+	if (actions & OVC3860ResponseTransition::ActionPollA2DP)
+		PollScheduler.markDirty(OVC3860PollScheduler::A2DPStatus);
+	if (actions & OVC3860ResponseTransition::ActionModuleReady)
+	{
+		moduleReady();
+		ConfigCache.startRevalidation(timeStamp);
+		VolumeControl.reset();
+	}
+	return (actions & OVC3860ResponseTransition::ActionError) ? 0 : 1;
+}
+
+/**
+  * @brief	State member selected by transition field.
+  */
+OVC3860::STATES* OVC3860::getStateField(uint8_t field){
+	switch (field)
+	{
+	case OVC3860ResponseTransition::FieldBT:	return &BTState;
+	case OVC3860ResponseTransition::FieldHFP:	return &HFPState;
+	case OVC3860ResponseTransition::FieldA2DP:	return &A2DPState;
+	case OVC3860ResponseTransition::FieldCall:	return &CallState;
+	case OVC3860ResponseTransition::FieldMusic:	return &MusicState;
+	default:									return &Audio;
+	}
+}
+
+/**
+  * @brief	Read status digit of MGX / MLX / MUX indication.
+  *
+  * @param	pValues - states for digits '1', '2', ...
+  * @param	valuesCount - number of pValues
+  * @param	pState - state to update, not changed if digit
+  * 		 is out of range
+  * @retval	true - pState is updated
+  */
+bool OVC3860::readStatusDigit(const STATES* pValues, size_t valuesCount, STATES* pState){
+	skipBufferItem(2);
+	uint8_t digit = OVC3860::get() - '1';
+
+	if (digit >= valuesCount)
+		return false;
+	*pState = pValues[digit];
+	return true;
+}
+
+/**
+  * @brief	Pass new Audio value to CodecTelemetry.
+  */
+void OVC3860::codecChanged(uint32_t timeStamp){
+	switch (Audio)
+	{
+	case ASR_48000:		CodecTelemetry.sampleRateSet(OVC3860CodecTelemetry::Rate_48000, timeStamp);		break;
+	case ASR_44100:		CodecTelemetry.sampleRateSet(OVC3860CodecTelemetry::Rate_44100, timeStamp);		break;
+	case ASR_32000:		CodecTelemetry.sampleRateSet(OVC3860CodecTelemetry::Rate_32000, timeStamp);		break;
+	case ASR_16000:		CodecTelemetry.sampleRateSet(OVC3860CodecTelemetry::Rate_16000, timeStamp);		break;
+	case PhoneCall:		CodecTelemetry.sampleRateSet(OVC3860CodecTelemetry::RatePhoneCall, timeStamp);	break;
+	case ConfigError:	CodecTelemetry.configError(timeStamp);											break;
+	case CodecClosed:	CodecTelemetry.codecClosed(timeStamp);											break;
+	default:			break;
+	}
+}
+
+
+/*
+ * State snapshot layout. Each state field stores index of its value in
+ *  the field's table, so whole snapshot fits in one 32-bit word which
+ *  Cortex-M reads and writes with single, not interruptible access.
+ *
+ *  bits:	31..21		20..18	17..16	15..14	13..11	10..9	8..6	5..3	2..0
+ *  		version		Audio	Power	Music	Call	AVRCP	A2DP	HFP		BT
+ */
+struct snapshotFieldLayout
+{
+	uint8_t 				shift;
+	uint8_t 				width;
+	const OVC3860::STATES*	pValues;
+	uint8_t 				valuesCount;
+};
+
+static const OVC3860::STATES snapshotBTValues[] = {OVC3860::Disconnected, OVC3860::Connected, OVC3860::Discoverable, OVC3860::Listening,
+												   OVC3860::SPPopened, OVC3860::SPPclosed, OVC3860::Pairing, OVC3860::ConfigMode};
+static const OVC3860::STATES snapshotHFPValues[] = {OVC3860::Disconnected, OVC3860::Ready, OVC3860::Connecting, OVC3860::Connected,
+													OVC3860::OutgoingCall, OVC3860::IncomingCall, OVC3860::OngoingCall};
+static const OVC3860::STATES snapshotA2DPValues[] = {OVC3860::Disconnected, OVC3860::Ready, OVC3860::Initializing, OVC3860::SignallingActive,
+													 OVC3860::Connected, OVC3860::Streaming};
+static const OVC3860::STATES snapshotAVRCPValues[] = {OVC3860::Disconnected, OVC3860::Ready, OVC3860::Connecting, OVC3860::Connected};
+static const OVC3860::STATES snapshotCallValues[] = {OVC3860::Disconnected, OVC3860::OutgoingCall, OVC3860::IncomingCall, OVC3860::OngoingCall,
+													 OVC3860::PhoneHangUp, OVC3860::Idle};
+static const OVC3860::STATES snapshotMusicValues[] = {OVC3860::Idle, OVC3860::Playing, OVC3860::FastForwarding, OVC3860::Rewinding};
+static const OVC3860::STATES snapshotPowerValues[] = {OVC3860::Off, OVC3860::On, OVC3860::ShutdownInProgress};
+static const OVC3860::STATES snapshotAudioValues[] = {OVC3860::CodecClosed, OVC3860::ConfigError, OVC3860::ASR_48000, OVC3860::ASR_44100,
+													  OVC3860::ASR_32000, OVC3860::ASR_16000, OVC3860::PhoneCall};
+
+#define snapshotFieldLayoutEntry(shift, width, values)	{shift, width, values, sizeof(values)/sizeof(values[0])}
+
+static const snapshotFieldLayout snapshotLayout[OVC3860::snapshotField_count] = {		//order of enum snapshotField
+		snapshotFieldLayoutEntry(0,  3, snapshotBTValues),
+		snapshotFieldLayoutEntry(3,  3, snapshotHFPValues),
+		snapshotFieldLayoutEntry(6,  3, snapshotA2DPValues),
+		snapshotFieldLayoutEntry(9,  2, snapshotAVRCPValues),
+		snapshotFieldLayoutEntry(11, 3, snapshotCallValues),
+		snapshotFieldLayoutEntry(14, 2, snapshotMusicValues),
+		snapshotFieldLayoutEntry(16, 2, snapshotPowerValues),
+		snapshotFieldLayoutEntry(18, 3, snapshotAudioValues)
+};
+
+static_assert(sizeof(snapshotBTValues)/sizeof(snapshotBTValues[0]) <= (1 << 3), "BT state field too narrow");
+static_assert(sizeof(snapshotHFPValues)/sizeof(snapshotHFPValues[0]) <= (1 << 3), "HFP state field too narrow");
+static_assert(sizeof(snapshotA2DPValues)/sizeof(snapshotA2DPValues[0]) <= (1 << 3), "A2DP state field too narrow");
+static_assert(sizeof(snapshotAVRCPValues)/sizeof(snapshotAVRCPValues[0]) <= (1 << 2), "AVRCP state field too narrow");
+static_assert(sizeof(snapshotCallValues)/sizeof(snapshotCallValues[0]) <= (1 << 3), "Call state field too narrow");
+static_assert(sizeof(snapshotMusicValues)/sizeof(snapshotMusicValues[0]) <= (1 << 2), "Music state field too narrow");
+static_assert(sizeof(snapshotPowerValues)/sizeof(snapshotPowerValues[0]) <= (1 << 2), "Power state field too narrow");
+static_assert(sizeof(snapshotAudioValues)/sizeof(snapshotAudioValues[0]) <= (1 << 3), "Audio state field too narrow");
+
+#define snapshotVersionShift	21
+#define snapshotStatesMask		((1UL << snapshotVersionShift) - 1)
+
+/**
+  * @brief	Pack actual states into snapshot word (without version).
+  * @note	State which is not listed in field's table is
+  * 		 packed as index 0 of the table.
+  *
+  * @param	n/a
+  * @retval	packed states
+  */
+uint32_t OVC3860::packStates(void) const{
+	const STATES states[snapshotField_count] = {BTState, HFPState, A2DPState, AVRCPState, CallState, MusicState, PowerState, Audio};
+	uint32_t packed = 0;
+
+	for (uint8_t field = 0; field < snapshotField_count; field++)
+	{
+		const snapshotFieldLayout* pLayout = &snapshotLayout[field];
+		uint32_t index = 0;
+
+		for (uint8_t i = 0; i < pLayout->valuesCount; i++)
+		{
+			if (pLayout->pValues[i] == states[field])
+			{
+				index = i;
+				break;
+			}
+		}
+		packed |= index << pLayout->shift;
+	}
+	return packed;
+}
+
+/**
+  * @brief	Publish states as snapshot.
+  * @note	Snapshot is built aside and stored with single
+  * 		 32-bit write, so reader never sees half updated
+  * 		 states. Version is incremented only if states
+  * 		 changed.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860::publishStateSnapshot(void){
+	uint32_t previous = stateSnapshot;
+	uint32_t packed = packStates();
+
+	if (packed != (previous & snapshotStatesMask))
+		stateSnapshot = (previous & ~snapshotStatesMask) + (1UL << snapshotVersionShift) + packed;	//version wraps around
+}
+
+/**
+  * @brief	Read snapshot of states.
+  * @note	Safe to call from ISR or other task, snapshot is
+  * 		 read with single load. Use snapshotState() to
+  * 		 unpack states.
+  *
+  * @param	n/a
+  * @retval	snapshot word
+  */
+uint32_t OVC3860::getStateSnapshot(void) const{
+	return stateSnapshot;
+}
+
+/**
+  * @brief	Unpack one state from snapshot.
+  *
+  * @param	snapshot - value returned by getStateSnapshot()
+  * @param	field - which state to unpack
+  * @retval	state value
+  */
+OVC3860::STATES OVC3860::snapshotState(uint32_t snapshot, snapshotField field){
+	const snapshotFieldLayout* pLayout = &snapshotLayout[field];
+	uint32_t index = (snapshot >> pLayout->shift) & ((1UL << pLayout->width) - 1);
+
+	if (index >= pLayout->valuesCount)
+		index = 0;
+	return pLayout->pValues[index];
+}
+
+/**
+  * @brief	Version of snapshot.
+  * @note	Changes each time published states change, so
+  * 		 reader can detect change comparing versions only.
+  *
+  * @param	snapshot - value returned by getStateSnapshot()
+  * @retval	version (11 bits, wraps around)
+  */
+uint16_t OVC3860::snapshotVersion(uint32_t snapshot){
+	return (uint16_t) (snapshot >> snapshotVersionShift);
+}
+
+/**
+  * @brief	Timing hook of the library.
+  * @note	Sends commands which are scheduled in time i.e.
+  * 		 link reconnection attempts (LinkSupervisor) and
+  * 		 merged status queries (PollScheduler), counts
+  * 		 memory read timeouts and starts transmission of
+  * 		 queued commands.
+  * 		It does not block, execute it as frequent as
+  * 		 decodeReceivedString(void), i.e. in main loop.
+  * 		Calling it is mandatory - without it HFP / AVRCP
+  * 		 status queries of application and A2DP status
+  * 		 queries triggered by indications are never sent.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860::periodicTask(void){
+	uint32_t timeStamp = getTick();
+
+	serviceReset();
+
+	if (LinkSupervisor.isReconnectDue(OVC3860LinkSupervisor::HFP, timeStamp))
+		connectHSHF();
+	if (LinkSupervisor.isReconnectDue(OVC3860LinkSupervisor::A2DP, timeStamp))
+		connectA2DP();
+
+	if (PollScheduler.isQueryDue(OVC3860PollScheduler::HFPStatus, timeStamp))
+		sendData(OVC3860_QUERY_HFP_STATUS);
+	if (PollScheduler.isQueryDue(OVC3860PollScheduler::A2DPStatus, timeStamp))
+		queryA2DPStatus();
+	if (PollScheduler.isQueryDue(OVC3860PollScheduler::AVRCPStatus, timeStamp))
+		sendData(OVC3860_QUERY_AVRCP_STATUS);
+
+#if OVC3860_FEATURE_MEMORY
+	if (!memoryPending.isEmpty() && (timeStamp - memoryLastActivity) > OVC3860_MemoryReadTimeout)
+		memoryReadTimeout();
+	memoryRangeRequestNext();						//requests which did not fit into transmit queue
+#endif /* OVC3860_FEATURE_MEMORY */
+
+	if (ConfigCache.isRevalidationDue(OVC3860ConfigCache::CacheVersion, timeStamp))
+		queryVersion();
+	bool isAutoAnswerDue = ConfigCache.isRevalidationDue(OVC3860ConfigCache::CacheAutoAnswer, timeStamp);
+	bool isAutoConnectDue = ConfigCache.isRevalidationDue(OVC3860ConfigCache::CacheAutoConnect, timeStamp);
+	if (isAutoAnswerDue || isAutoConnectDue)
+		queryConfiguration();							//one MF answer revalidates both
+
+	char digit;
+	if (DtmfSequencer.isDigitDue(timeStamp, &digit) && sendDTMF(&digit, 1))
+		DtmfSequencer.digitSent(timeStamp);				//dropped digit is sent by the next call
+
+	serviceVolume(timeStamp);
+	serviceTransmit();
+}
+
+/**
+  * @brief	Cold start with cached module configuration.
+  * @note	Cached auto answer / auto connect are applied to
+  * 		 states at once, so application does not have to
+  * 		 wait for queryConfiguration() answer. All cached
+  * 		 values are revalidated lazily after WELCOME / IS.
+  * 		Save ConfigCache.getImage() when ConfigCache.isDirty().
+  *
+  * @param	pStorage - cache image, i.e. (const void*) BKPSRAM_BASE
+  * @param	storageSize - size of pStorage
+  * @retval	true - cache is valid
+  */
+bool OVC3860::loadConfigCache(const void* pStorage, size_t storageSize){
+	if (!ConfigCache.load(pStorage, storageSize))
+		return false;
+	if (ConfigCache.isValid(OVC3860ConfigCache::CacheAutoAnswer))
+		AutoAnswer = ConfigCache.getAutoAnswer() ? On : Off;
+	if (ConfigCache.isValid(OVC3860ConfigCache::CacheAutoConnect))
+		AutoConnect = ConfigCache.getAutoConnect() ? On : Off;
+	return true;
+}
+
+/**
+  * @brief	Check if driver has job to do right now.
+  * @note	Low power main loop pattern:
+  * 			__disable_irq();
+  * 			if (!BT_audio.isWorkPending() && BT_audio.getTimeToNextDeadline() != 0)
+  * 				__WFI();
+  * 			__enable_irq();
+  * 		 UART RX / TX DMA interrupts wake the core even if
+  * 		 interrupts are disabled in PRIMASK, so no indication
+  * 		 received between check and WFI is lost.
+  *
+  * @param	n/a
+  * @retval	true - complete line waits for decodeReceivedString(void)
+  * 		 or queued command may be transmitted
+  */
+bool OVC3860::isWorkPending(void){
+	receiveFromTransport();
+	if (detectRN().isFound)
+		return true;
+	return !transmitQueue.isEmpty() && isTransmitterFree();
+}
+
+/**
+  * @brief	Time left to the nearest job of periodicTask(void).
+  * @note	Reset sequence, link reconnection attempts, status
+  * 		 queries, memory read timeout and configuration
+  * 		 cache revalidation. Nothing else than UART
+  * 		 interrupt can create new job when OVC3860_NoDeadline
+  * 		 is returned, so MCU may sleep as long as it wants
+  * 		 (i.e. with SysTick suspended or in STOP mode with
+  * 		 RX line wake-up).
+  *
+  * @param	n/a
+  * @retval	ms, 0 - periodicTask(void) has job now,
+  * 		 OVC3860_NoDeadline - nothing is scheduled
+  */
+uint32_t OVC3860::getTimeToNextDeadline(void){
+	uint32_t timeStamp = getTick();
+	uint32_t timeLeft = OVC3860_NoDeadline;
+	uint32_t componentTimeLeft;
+
+	if (getTimeToResetDeadline(&componentTimeLeft) && componentTimeLeft < timeLeft)
+		timeLeft = componentTimeLeft;
+	if (LinkSupervisor.getTimeToNextAttempt(timeStamp, &componentTimeLeft) && componentTimeLeft < timeLeft)
+		timeLeft = componentTimeLeft;
+	if (PollScheduler.getTimeToNextQuery(timeStamp, &componentTimeLeft) && componentTimeLeft < timeLeft)
+		timeLeft = componentTimeLeft;
+	if (ConfigCache.getTimeToRevalidation(timeStamp, &componentTimeLeft) && componentTimeLeft < timeLeft)
+		timeLeft = componentTimeLeft;
+	if (VolumeControl.getTimeToTimeout(timeStamp, &componentTimeLeft) && componentTimeLeft < timeLeft)
+		timeLeft = componentTimeLeft;
+	if (DtmfSequencer.getTimeToNextDigit(timeStamp, &componentTimeLeft) && componentTimeLeft < timeLeft)
+		timeLeft = componentTimeLeft;
+#if OVC3860_FEATURE_MEMORY
+	if (!memoryPending.isEmpty())
+	{
+		uint32_t idleTime = timeStamp - memoryLastActivity;
+		componentTimeLeft = (idleTime > OVC3860_MemoryReadTimeout) ? 0 : OVC3860_MemoryReadTimeout + 1 - idleTime;
+		if (componentTimeLeft < timeLeft)
+			timeLeft = componentTimeLeft;
+	}
+#endif /* OVC3860_FEATURE_MEMORY */
+	return timeLeft;
+}
+
+/**
+  * @brief	Read parameter of decoded indication.
+  * @note	Copies rest of the line (without '\r','\n') after
+  * 		 "skip" items, i.e. readParameter(4, ...) of
+  * 		 "MEM:3F" gives "3F". Tail is left at '\r' so
+  * 		 decodeReceivedString(void) finishes line as usual.
+  *
+  * @param	skip - length of indication name
+  * @param	pParameter - destination, no '\0' is added
+  * @param	maxLength - size of pParameter, longer parameter
+  * 		 is cut
+  * @retval	number of copied characters
+  */
+size_t OVC3860::readParameter(uint8_t skip, char* pParameter, size_t maxLength){
+	circularBufferSearchResult endOfLine = detectRN();
+	size_t copied = 0;
+
+	if (!endOfLine.isFound || endOfLine.tail2virtualTail_ < skip)
+		return 0;
+
+	skipBufferItem(skip);
+	for (size_t i = skip; i < endOfLine.tail2virtualTail_; i++)
+	{
+		char item = (char) OVC3860::get();
+		if (copied < maxLength)
+			pParameter[copied++] = item;
+	}
+	return copied;
+}
+
+/**
+  * @brief	Move tail in circular buffer.
+  * @note	Additional method to move tail x position ahead.
+  *
+  * @param	howMany - number of items to move forward.
+  * @retval	n/a
+  */
+void OVC3860::skipBufferItem(uint8_t howMany){
+	for(uint8_t i=0; i< howMany; i++)
+	{
+		OVC3860::get();
+	}
+}
+
+/**
+  * @brief	Send command to OVC3860
+  * @note	Command is built in transmit queue slot and sent
+  * 		 by serviceTransmit(void) when UART is free, so
+  * 		 commands may be issued back-to-back without
+  * 		 waiting for previous DMA transfer.
+  * 		If queue is full or command is longer than
+  * 		 OVC3860_CommandMaxLength it is dropped and
+  * 		 counted by getDroppedCommands().
+  * 		If UART is busy command only waits in queue, it is
+  * 		 sent by the next serviceTransmit(void) call i.e.
+  * 		 from periodicTask(void) or decodeReceivedString(void).
+  *
+  * @param	pCMD - pointer to command that have to executed, take a look at:
+  *   *          		- OVC3860 AT Command Application Notes Revision:1.1
+  *          			- BLK-MD-SPK-B AT 命令应用指导 pdf
+  * @param	pExtraData - pointer to extra data if pCMD requires this, take a look at:
+  *   	        			- OVC3860 AT Command Application Notes Revision:1.1
+  *          				- BLK-MD-SPK-B AT 命令应用指导 pdf
+  *          			It is overloaded parameter "=0" and can be omitted if
+  *          			 pCMD do not reqiures extra data.
+  * @param	ExtraDataSize - size of pExtraData data. It is overloaded parameter "=0" and can be omitted if
+  *          			 pCMD do not reqiure extra data.
+  * @retval	false - command was dropped
+  */
+bool OVC3860::sendData(const char* pCMD, const char* pExtraData, size_t ExtraDataSize){
+
+	transmitCommand command;
+	size_t commandLength = 3				/*AT#*/
+						   +2				/*COMMAND*/
+						   +ExtraDataSize	/*pExtraData*/
+						   +2;				/*\r\n*/
+
+	if (commandLength > OVC3860_CommandMaxLength || transmitQueue.isFull())
+	{
+		droppedCommands++;
+		return false;
+	}
+
+	memcpy(command.data, "AT#", 3);										//Cpoy "AT#"
+	memcpy(command.data+3, pCMD, 2);										//Copy command 'XY'
+	if (pExtraData!=0)
+		memcpy(command.data+3+2, pExtraData, ExtraDataSize);				//Copy ExtraData
+	memcpy(command.data+3+2+ExtraDataSize, "\r\n", 2);					//Copy '\r\n'
+	command.length = (uint8_t) commandLength;
+
+	transmitQueue.put(command);
+	serviceTransmit();
+	return true;
+}
+
+/**
+  * @brief	Start transmission of the oldest queued command.
+  * @note	BECAUSE command is sent in nonblocking mode (DMA)
+  * 		 its data have to exist as long as HAL_UART_TRANSMIT_DMA
+  * 		 do not finish its work. That is why command is
+  * 		 moved to transmittedCommand which is part of the
+  * 		 object.
+  * 		Executed by sendData() and periodicTask(void), do not
+  * 		 call it from interrupt.
+  * 		With OVC3860RTOS commands are passed to its transmit
+  * 		 task queue instead.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860::serviceTransmit(void){
+	if (transmitQueue.isEmpty())
+		return;
+
+#ifdef OVC3860_USE_FREERTOS
+	if (rtosTransmitQueue != 0)					//OVC3860RTOS transmit task sends commands
+	{
+		while (!transmitQueue.isEmpty() && uxQueueSpacesAvailable(rtosTransmitQueue) > 0)
+		{
+			transmitCommand command = transmitQueue.get();
+			xQueueSend(rtosTransmitQueue, &command, 0);
+		}
+		return;
+	}
+#endif
+	if (!isTransmitterFree())								//previous command is still being sent
+		return;
+
+	transmittedCommand = transmitQueue.get();
+	transport.transmit(transmittedCommand.data, transmittedCommand.length);
+}
+
+/**
+  * @brief	Check if next command may be passed to transmitter.
+  * @note	UART is free or, with OVC3860RTOS, its transmit task
+  * 		 queue has space.
+  * 		Commands issued during reset wait in transmit queue
+  * 		 until module is ready (or reset times out).
+  */
+bool OVC3860::isTransmitterFree(void) const{
+	if (getResetPhase() == ResetPulse || getResetPhase() == ResetBooting)
+		return false;
+#ifdef OVC3860_USE_FREERTOS
+	if (rtosTransmitQueue != 0)
+		return uxQueueSpacesAvailable(rtosTransmitQueue) > 0;
+#endif
+	return transport.isTransmitterFree();
+}
+
+/**
+  * @brief	Move bytes received by transport to circular
+  * 		 buffer.
+  * @note	Only transports without receive interrupt (POSIX,
+  * 		 loopback) return data here, with STM32 HAL bytes
+  * 		 are put by getData() in HAL_UART_RxCpltCallback.
+  * 		Bytes stay in transport if circular buffer is full
+  * 		 of complete lines. Buffer full without "\r\n" is
+  * 		 dropped by dropUndecodableData(void).
+  * 		Transport writes directly to free space reserved
+  * 		 in circular buffer, without per-byte calls.
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860::receiveFromTransport(void){
+	size_t window;
+	uint8_t* pWindow;
+	uint16_t received;
+
+	do
+	{
+		dropUndecodableData();
+		pWindow = reserve(OVC3860_ReceiveBufferSize, &window);		//transport writes directly to circular buffer
+		if (window == 0)
+			return;
+		received = transport.receive(pWindow, window);
+		commit(received);
+	}
+	while (received == window);
+	dropUndecodableData();
+}
+
+/**
+  * @brief	Drop received data which can never be decoded.
+  * @note	Line longer than circular buffer fills it without
+  * 		 "\r\n", so neither decodeReceivedString(void) nor
+  * 		 transport could move on. Overflow (getData() had
+  * 		 to overwrite the oldest byte) stops getData()
+  * 		 until buffer is reset. In both cases buffer is
+  * 		 emptied and the rest of the line is dropped up to
+  * 		 its '\n', so parser resynchronizes at the next line.
+  * 		Dropped bytes are counted by getDroppedBytes().
+  *
+  * @param	n/a
+  * @retval	n/a
+  */
+void OVC3860::dropUndecodableData(void){
+	static const OVC3860_ReceiveBufferType lineEnd = '\n';
+
+	if (isDroppingLine && !isEmpty())
+	{
+		const_iterator item = find(&lineEnd, 1);
+		size_t dropped = (item == end()) ? dataSize() : item.distance() + 1;
+		isDroppingLine = (item == end());
+		droppedBytes += dropped;
+		release(dropped);
+	}
+	if (isOverflowed() || (isFull() && !detectRN().isFound))
+	{
+		isDroppingLine = (peek(dataSize() - 1) != lineEnd);
+		droppedBytes += dataSize();
+		resetCircularBuffer();
+	}
+}
+
+/**
+  * @brief	Number of commands dropped by sendData() because
+  * 		 transmit queue was full or command too long.
+  */
+uint32_t OVC3860::getDroppedCommands(void) const{
+	return droppedCommands;
+}
+
+/**
+  * @brief	Number of received bytes dropped because their
+  * 		 line did not fit into circular buffer.
+  */
+uint32_t OVC3860::getDroppedBytes(void) const{
+	return droppedBytes;
+}
+
+
+/*
+  Pairing
+  Set pairing, waiting for the remote device to connect, the command format is:
+  AT#CA // discoverable for 2 minutes  - DISCOVERY TIME CAN BE MODIFIED WITH PSKey: app_to_pairing
+  ovc3860 returns the indication:
+  II // state indication, HSHF enters pairing state indication
+  if 2 minutes' timeout is arrived(no peer connect to ovc3860 device), returns the indication:
+  IJ2 // state indication, HSHF exits pairing mode and enters listening
+  The device can't be found, if need to be search, repeat Pairing operation.
+
+  Enter Pairing Mode #CA
+
+  Command
+  #CA
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  II
+  Indication Description
+  Enter Pairing Mode Indication
+
+  Description
+  This command puts the module in the pairing mode. The information response and causes will
+  indicate the command success or failure. Enter pairing mode indication or failure indication
+  will be sent to the host.
+
+  Note:
+  1. This command will cause a disconnection if module has already connected with some device.
+  2. Module will exit pairing mode if connection not happen in 2 minutes.
+
+  Syntax: AT#CA
+
+  FOR MORE DETAILS:
+  Take a look at OVC3860 AT Command Application Notes.pdf
+  chapter 4 Command Explanations
+*/
+
+void OVC3860::enterPairingMode(void){
+	LinkSupervisor.linkReleased(OVC3860LinkSupervisor::HFP);		//pairing drops actual connection on purpose
+	LinkSupervisor.linkReleased(OVC3860LinkSupervisor::A2DP);
+	sendData(OVC3860_PAIRING_INIT);
+}
+
+
+/*
+  Exit pairing
+  Exit pairing, can not be found by peers, the command format is:
+  AT#CB // exit pairing mode, non-discoverable
+  return:
+  IJ2 // state indication, HSHF exits pairing mode and enters listening
+
+  Cancel Pairing Mode #CB
+
+  Command
+  #CB
+  Current Status(s)
+  Pairing
+  Possible   Indication(s)
+  IJ2
+  Indication Description
+  Exit Pairing Mode Indication
+
+  Description
+  If the module is in pairing mode, this command causes the module to exit the pairing mode and
+  enter the idle mode. The information response and causes will indicate the command success or
+  failure.
+
+  Syntax: AT#CB
+
+    FOR MORE DETAILS:
+  Take a look at OVC3860 AT Command Application Notes.pdf
+  chapter 4 Command Explanations
+*/
+void OVC3860::CancelPairingMode(void){
+	sendData(OVC3860_PAIRING_EXIT);
+}
+
+
+/*
+  Active connection
+  Actively connect to the last successful connected device
+  AT#CC // Connect to remote Device
+  then input the local PIN code, and ovc3860 returns HSHF's state indication:
+  IV
+  HSHF state is connected indication
+  if Bluetooth mobile phone is turned off or not in Bluetooth signal range, will return a stat
+  us indication:
+  IJ2 // HSHF exits pairing mode and enters listening state indication
+
+  Connect HFP to Handset #CC
+  Command
+  #CC
+  Current Status(s)
+  HFP Status = 1
+  Possible Indication(s)
+  IV
+  Description Indication
+  Connecting Indication
+
+  Note: You can get current HFP status by #CY.
+
+  Description
+  This command causes the module to connect to a paired handset. The information response and
+  causes will indicate the command success or failure. Connect Indication will be sent to the host
+  after the connection is established. Otherwise Disconnect Indication will be sent to the host.
+
+  Syntax: AT#CC
+*/
+void OVC3860::connectHSHF(void){
+	sendData(OVC3860_CONNECT_HSHF);
+}
+
+
+/*
+  taken from BLK module datasheet
+  BLK-MD-SPK-B_AT_Command_set_original( BLK-MD-SPK-B AT Command Application Guide)
+
+  no mention of this command in OVC3860_AT_Command_Application_Notes.pdf
+
+  module responce:
+
+  sending AT#CV
+  ERR2
+  ERR2
+  OK
+  OK
+*/
+void OVC3860::pairingDeleteThenInit() {
+  OVC3860::sendData(OVC3860_PAIRING_DELETE_THEN_INIT);
+}
+
+/*
+  Exit connecting
+  Send the command:
+  AT#CD // ACL disconnect from remote
+  ovc3860 returns the indication:
+  IA // HSHF state is listening
+  if the remote device disconnects connection actively, ovc3860 also returns the same indication
+
+  Disconnect HFP from Handset #CD
+  Command
+  #CD
+  Current Status(s)
+  HFP Status ≥ 3
+  Possible Indication(s)
+  IA
+  Description Indication
+  Disconnected Indication
+
+  Description
+  This command causes the module to disconnect from the connected handset. The information
+  response and causes will indicate the command success or failure. Disconnect Indication will be
+  sent to the host after the connection is dropped.
+
+  Syntax: AT#CD
+*/
+void OVC3860::disconnectHSHF() {
+	LinkSupervisor.linkReleased(OVC3860LinkSupervisor::HFP);
+	sendData(OVC3860_DISCONNECT_HSHF);
+}
+
+
+
+
+
+/*
+  user may answer the phone:
+  AT#CE
+  return the indication:
+  IF // hang-up indication
+  if the other party hangs up the phone, also return:
+  IF // hang-up indication
+
+  Answer Call #CE
+  Command
+  #CE
+  Current Status(s)
+  HFP Status = 4
+  Possible
+  Indication(s)
+  IG
+  Indication Description
+  Pick up Indication
+
+  Description
+  This command causes the module to answer an incoming call. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#CE
+*/
+void OVC3860::callAnswer(void) {
+	sendData(OVC3860_CALL_ANSWARE);
+}
+
+/*
+  Answering the phone
+  The phone receives a call, ovc3860 returns the indication, such as:   02167850001
+  Receive a incoming call 02167850001
+  at this time, user may refuse to answer the phone:
+  AT#CF // Refuse to answer the phone
+  ovc3860 returns:
+  IF // Call-setup status is idle
+
+  Reject Call #CF
+
+  Command
+  #CF
+  Current Status(s)
+  HFP status = 4
+  Possible Indication(s)
+  IF
+  Indication Description
+  Hang up Indication
+
+  Description
+  This command causes the module to reject an incoming call. The information response and causes
+  will indicate the command success or failure.
+
+  Syntax: AT#CF
+*/
+void OVC3860::callReject() {
+	sendData(OVC3860_CALL_REJECT);
+}
+
+/*
+  End Call
+  Command
+  #CG
+  Current Status(s)
+  HFP Status = 5 | 6
+  Posible Indication(s)
+  IF
+  Indication Description
+  Hang up Indication
+
+  Description
+  This command causes the module to end an active call. The information response and causes will
+  indicate the command success or failure.
+  Syntax: AT#CG
+*/
+void OVC3860::callEnd() {
+  sendData(OVC3860_CALL_HANGUP);
+}
+
+
+/*
+  Redialing
+  Redial the last outgoing call:
+  AT#CH
+  return:
+  ICv//Call-setup status is outgoing
+
+  Redial #CH
+  Command
+  #CH
+  Current Status(s)
+  HFP Status = 3 | 6
+  Possible Indication(s)
+  IC
+  Indication Description
+  Outgoing Call Indication
+
+  Description
+  This command causes the module to redial the last number called in the phone. The information
+  response and causes will indicate the command success or failure.
+
+  Syntax: AT#CH
+*/
+void OVC3860::callRedial() {
+  sendData(OVC3860_CALL_REDIAL);
+}
+
+
+/*
+  Voice dialing
+  The command format is:
+  AT#CI
+  return:
+  PE // The voice dial start indication
+  or,
+  PF // The voice dial is not supported indication
+
+  Voice Dial #CI
+  Command
+  #CI
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PE
+  PF
+  Indication Description
+  Voice Dial Start Indication
+  Handset Not Support Void Dial
+
+  Description
+  This command causes the module to active voice dial functionary in the phone. The information
+  response and causes will indicate the command success or failure.
+  Note: Voice dialing not works in some handset while .
+
+  Syntax: AT#CI
+*/
+void OVC3860::voiceDialStart() {
+	sendData(OVC3860_VOICE_CALL_START);
+}
+
+
+/*
+  cancel the voice dialing:
+  AT#CJ
+  return:
+  PF //The voice dial is stopped indication
+
+  Cancel Voice Dial #CJ
+  Command
+  #CJ
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PF
+  Indication Description
+  Voice Dial Stop Indication
+
+  Description
+  This command causes the module to cancel on going voice dial in the phone. The information
+  response and causes will indicate the command success or failure.
+
+  Syntax: AT#CJ
+*/
+void OVC3860::voiceDialEnd() {
+	sendData(OVC3860_VOICE_CALL_CANCEL);
+}
+
+/*
+  Mute/Unmute MIC #CM
+
+  Command
+  #CM
+  Current Status(s)
+  HFP Status = 6
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted by Module
+
+  Description
+  This command causes the module to mute or unmute the MIC. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#CM
+*/
+void OVC3860::micToggle() {
+  sendData(OVC3860_MIC_TOGGLE);
+}
+
+
+/*
+  Audio transfer
+  Transfer audio between HSHF and phone speaker:
+  AT#CO
+  when transfered to HSHF, ovc3860 returns:
+  MC //The voice is on Bluetooth indication
+  when transfered to HSHF:
+  MD //The voice is on phone indication
+
+  Transfer Call to/from Handset #CO
+
+  Command
+  #CO
+  Current Status(s)
+  HFP Status = 6(without audio)
+  HFP Status = 6(without audio)
+  Possible Indication(s)
+  MC
+  MD
+  Indication Description
+  HFP Audio Connected
+  MD HFP Audio Disconnect
+
+  Description
+  This command causes the module to transfer the active call from the module to the handset ( MD
+  will received ) or from the handset to the module ( MC will received ). The information response
+  and causes will indicate the command success or failure.
+
+  Syntax: AT#CO
+*/
+void OVC3860::transferAudio() {
+  sendData(OVC3860_TRANSFER_AUDIO_TO_SPEAKER);
+}
+
+
+
+/*
+  Release&Reject Call #CQ
+  Command
+  #CQ
+  Current Status(s)
+  HFP Status = 6
+  Possible Indication(s)
+  IN
+  Indication Description
+  Release Held Call, Reject Waiting Call
+  by
+  Description
+  This command causes the module to release held call, and reject waiting call. The information
+  response and causes will indicate the command success or failure.
+
+  Syntax: AT#CQ
+*/
+void OVC3860::callReleaseReject() {
+  sendData(OVC3860_RELEASE_REJECT_CALL);
+}
+
+
+/*
+  Release&Accept Call #CR
+
+  Command
+  #CR
+  Current Status(s)
+  HFP Status = 6
+  Possible Indication(s)
+  IT
+  Indication Description
+  Release Active Call, Accept Other Call
+
+  Description
+  This command causes the module to release active call, accept other call.
+  The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#CR
+*/
+void OVC3860::callReleaseAccept() {
+  sendData(OVC3860_RELEASE_ACCEPT_CALL);
+}
+
+
+/*
+  Hold&Accept Call #CS
+
+  Command
+  #CS
+  Current Status(s)
+  HFP Status = 6
+  Possible Indication(s)
+  IM
+  Indication Description
+  Release Active Call, Accept Other Call
+
+  Description
+  This command causes the module to hold active call, accept other call. The information response
+  and causes will indicate the command success or failure.
+
+  Syntax: AT#CS
+*/
+void OVC3860::callHoldAccept() {
+  sendData(OVC3860_HOLD_ACCEPT_CALL);
+}
+
+
+/*
+  Conference Call #CT
+
+  Command
+  #CT
+  Current Status(s)
+  HFP Status = 6
+  Possible Indication(s)
+  IM
+  Indication Description
+  Make Conference Call
+
+  Description
+  This command causes the module to make a conference call. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#CT
+*/
+void OVC3860::callConference() {
+  sendData(OVC3860_CONFERENCE_CALL);
+}
+
+/*
+  Dialing
+  For example, dialing 10086, the command format is:
+  AT#CW10086
+  return
+  IC // Call-setup status is outgoing
+  IP5 // Outgoing call number length indication
+  IR10086 // Outgoing call number indication
+
+  Dial One Call #CW
+
+  Command
+  #CW
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  IC
+  IP<lehgth>
+  IR<phone number>
+  Outgoing Call Indication
+  Length of Phone Number
+  Current Call Indication
+
+  Description
+  This command causes the module to dial one call. The information response and causes will
+  indicate the command success or failure.
+  Note: IP, IR indications only supported by HFP1.5 version.
+
+
+  Syntax: AT#CW13800138000
+*/
+void OVC3860::callDialNumber(const char* pExtraData, size_t ExtraDataSize) {
+
+  sendData(OVC3860_CALL_DIAL_NUMBER,  pExtraData, ExtraDataSize);
+}
+
+
+/*
+  Sending DTMF
+  For example, sending number “1”
+  AT#CX1
+  return:
+  OK // send DTMF successfully indication
+  NOTE: sopported sending characters (0-9, #, *, A-D).
+
+  Send DTMF #CX
+
+  Command
+  #CX
+  Current Status(s)
+  HFP Status = 6
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to send one DTMF. The information response and causes will
+  indicate the command success or failure.
+  Syntax:
+  AT#CX1
+  AT#CX5
+
+*/
+bool OVC3860::sendDTMF(const char* pExtraData, size_t ExtraDataSize) {
+  return OVC3860::sendData(OVC3860_SEND_DTMF,  pExtraData, ExtraDataSize);
+}
+
+/**
+  * @brief	Send DTMF string (i.e. IVR PIN).
+  * @note	Digits are sent one by one with #CX by periodicTask(void),
+  * 		 DtmfSequencer.getDigitGap() ms apart, ',' gives
+  * 		 OVC3860_DtmfPause. Check DtmfSequencer.getStatus()
+  * 		 for completion. Previous string is replaced.
+  *
+  * @param	pDigits - 0-9, '*', '#', A-D, ','
+  * @param	length - number of characters, 0 - pDigits is '\0'
+  * 		 terminated
+  * @retval	false - string is invalid and nothing is sent
+  */
+bool OVC3860::sendDTMFString(const char* pDigits, size_t length) {
+	if (pDigits != 0 && length == 0)
+		length = strlen(pDigits);
+	return DtmfSequencer.start(pDigits, length, getTick());
+}
+
+
+/*
+  Query the HSHF applications state, the command is:
+  AT#CY
+  ovc3860 returns:
+  MGX // The HSHF applications state is X indication
+  NOTE: X is the return parameter:
+          1 – “Ready”
+          2 – “Connecting”
+          3 – “Connected”
+          4 –“Outgoing call”
+          5 –“Incoming call”
+          6 – “Ongoing call”.
+
+  Query HFP Status #CY
+
+  Command
+  #CY
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  MG<code>
+  Report Current HFP Status
+
+  Description
+  This command queries the module’s HFP current status. The information response and causes will
+  indicate the command success or failure.
+
+  Syntax: AT#CY
+
+  Query is not sent inline, it is merged by PollScheduler and sent by
+  periodicTask(void), at most one per OVC3860_StatusPollInterval.
+*/
+void OVC3860::queryHFPStatus() {
+  PollScheduler.markDirty(OVC3860PollScheduler::HFPStatus);
+}
+
+
+/*
+  Reset #CZ
+
+  Command
+  #CZ
+  Current Status(s)
+  Any
+  Possible
+  IS<version>
+  MF<a><b>
+  Indication Description
+  Power ON Init Complete
+  Report Auto Answer and PowerOn Auto
+  Connection Configuration
+
+  Description
+  This command causes the module to reset. The information response and causes will indicate the
+  command success or failure.
+
+  Syntax: AT#CZ
+*/
+void OVC3860::resetSoftware() {
+  LinkSupervisor.linkReleased(OVC3860LinkSupervisor::HFP);
+  LinkSupervisor.linkReleased(OVC3860LinkSupervisor::A2DP);
+  sendData(OVC3860_RESET);
+}
+
+
+/*
+  Play/Pause Music #MA
+
+  Command
+  #MA
+  Current Status(s)
+  A2DP State = 5
+  Possible Indication(s)
+  MA
+  MB
+  Indication Description
+  AV pause/stop Indication
+  AV play Indication
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV source to play/pause
+  music. If module isn’t connected AV source, this command will cause module try to connected
+  current connected mobile’s AV source. The information response and causes will indicate the
+  command success or failure.
+
+  Syntax: AT#MA
+*/
+void OVC3860::musicTogglePlayPause() {
+  sendData(OVC3860_MUSIC_TOGGLE_PLAY_PAUSE);
+}
+
+
+/*
+  Stop Music #MC
+
+  Command
+  #MC
+  Current Status(s)
+  A2DP State = 5
+  Possible Indication(s)
+  MA
+  Indication Description
+  AV pause/stop Indication
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV Source to Stop Music.
+  The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MC
+*/
+void OVC3860::musicStop() {
+  sendData(OVC3860_MUSIC_STOP);
+}
+
+
+/*
+  Forward Music #MD
+
+  Command
+  #MD
+  Current Status(s)
+  A2DP State = 5
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted by Module
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV Source to Play next
+  song. The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MD
+*/
+void OVC3860::musicNextTrack() {
+  sendData(OVC3860_MUSIC_NEXT_TRACK);
+}
+
+
+
+/*
+  Backward Music #ME
+
+  Command
+  #ME
+  Current Status(s)
+  A2DP State = 5
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted by Module
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV Source to play last
+  song. The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#ME
+*/
+void OVC3860::musicPreviousTrack() {
+  sendData(OVC3860_MUSIC_PREVIOUS_TRACK);
+}
+
+
+/*
+  Query Auto Answer and PowerOn Auto Connection Configuration #MF
+
+  Command Current Status(s)
+  #MF
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  MF<a><b>
+  Indication Description
+  Report Auto Answer and PowerOn Auto
+  Connection Configuration
+
+  Description
+  This command queries the module’s auto answer configuration and poweron auto connect
+  configuration. The information response and causes will indicate the command success or failure
+
+  Syntax: MF<a><b>
+  Value:
+  < a >: auto answer configuration, where 0: disable, 1: enabled
+  < b >: poweron auto configuration, where 0: disable, 1: enabled
+*/
+void OVC3860::queryConfiguration() {
+ sendData(OVC3860_QUERY_CONFIGURATION);
+}
+
+
+/*`
+  Enable PowerOn Auto Connection #MG
+
+  Command
+  #MG
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command enables the module to connect to the last used AG after PowerOn. The information
+  response and causes will indicate the command success or failure.
+
+  Syntax: AT#MG
+*/
+void OVC3860::autoconnEnable() {
+  sendData(OVC3860_AUTOCONN_ENABLE);
+}
+
+
+
+/*
+  Disable PowerOn Auto Connection #MH
+
+  Command
+  #MH
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command disables the module to connect to the Last used AG after PowerOn. The
+  information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MH
+*/
+void OVC3860::autoconnDisable() {
+  sendData(OVC3860_AUTOCONN_DISABLE);
+}
+
+
+/*
+  Connect to AV Source #MI
+
+  Command
+  #MI
+  Current Status(s)
+  A2DP State = 1
+  Possible Indication(s)
+  MA
+  MB
+  Indication Description
+  AV pause/stop Indication
+  AV play Indication
+
+  Description
+  If the module is connected with a HFP phone, this command causes the module try to connect to
+  the phone’s AV Source. The information response and causes will indicate the command success
+  or failure.
+  Note: Music will be played automatic after A2DP connected in some handset.
+
+  Syntax: AT#MI
+*/
+void OVC3860::connectA2DP() {
+  sendData(OVC3860_AV_SOURCE_CONNECT);
+}
+
+
+/*
+  Disconnect from AV Source #MJ
+
+  Command
+  #MJ
+  Current Status(s)
+  A2DP Status ≥ 3
+  Possible Indication(s)
+  MY
+  Indication Description
+  AV Disconnect Indication
+
+  Description
+  This module causes the module to disconnect from the connected phone’s AV source. The
+  information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MJ
+*/
+void OVC3860::disconnectA2DP() {
+  LinkSupervisor.linkReleased(OVC3860LinkSupervisor::A2DP);
+  OVC3860::sendData(OVC3860_AV_SOURCE_DISCONNECT);
+}
+
+
+
+/*
+  Query AVRCP Status #MO
+
+  Command
+  #MO
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  ML<code>
+  <code> Status
+  1 Ready (to be connected)
+  2 Connecting
+  3 Connected
+  Indication Description
+  Report Current AVRCP Status
+
+  Description
+  This command queries the module’s AVRCP current status. The information response and causes
+  will indicate the command success or failure.
+
+  Syntax: AT#MO
+
+  Responce ML<code>:
+  <code>
+  1 Ready (to be connected)
+  2 Connecting
+  3 Connected
+
+  Query is not sent inline, it is merged by PollScheduler and sent by
+  periodicTask(void), at most one per OVC3860_StatusPollInterval.
+*/
+void OVC3860::queryAvrcpStatus() {
+  PollScheduler.markDirty(OVC3860PollScheduler::AVRCPStatus);
+}
+
+
+
+/*
+  Enable Auto Answer #MP
+
+  Command
+  #MP
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command enables the module auto answer an incoming call. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#MP
+*/
+void OVC3860::autoAnswerEnable() {
+  OVC3860::sendData(OVC3860_AUTO_ANSWER_ENABLE);
+}
+
+
+
+/*
+  Disable Auto Answer #MQ
+
+  Command
+  #MQ
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command disables the module auto answer an incoming call. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#MQ
+*/
+void OVC3860::autoAnswerDisable() {
+  OVC3860::sendData(OVC3860_AUTO_ANSWER_DISABLE);
+}
+
+
+/*
+  Start Fast Forward #MR
+
+  Command
+  #MR
+  Current Status(s)
+  A2DP Status = 5 OK
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted by Module
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV Source to start fast
+  forward. The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MR
+*/
+void OVC3860::musicStartFastForward() {
+  OVC3860::sendData(OVC3860_MUSIC_START_FF);
+}
+
+
+
+/*
+  Start Rewind #MS
+
+  Command
+  #MS
+  Current Status(s)
+  A2DP Status = 5
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted by Module
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV Source to start rewind.
+  The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MS
+*/
+void OVC3860::musicStartRewind() {
+  OVC3860::sendData(OVC3860_MUSIC_START_RWD);
+}
+
+
+/*
+  Stop Fast Forward / Rewind #MT
+
+  Command
+  #MT
+  Current Status(s)
+  A2DP Status = 5 (after started Fast Forward or Rewind)
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted by Module
+
+  Description
+  If the module is connected with a AV Source, this command causes the AV Source to stop fast
+  forward or rewind. The information response and causes will indicate the command success or failure.
+
+  Syntax: AT#MT
+*/
+void OVC3860::musicStopFFRWD() {
+  OVC3860::sendData(OVC3860_MUSIC_STOP_FF_RWD);
+}
+
+
+/*
+  Query A2DP Status #MV
+
+  Command
+  #MV
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  MU<code>
+  Indication Description
+  Report Current A2DP Status
+
+  Description
+  This command queries the module’s A2DP current status. The information response and causes
+  will indicate the command success or failure.
+
+  Syntax: AT#MV
+
+  Responce:
+  MU<code>:1-5, status of A2DP
+  1 Ready
+  2 Initiating
+  3 SignallingActive
+  4 Connected
+  5 Streaming
+*/
+void OVC3860::queryA2DPStatus(void){
+	PollScheduler.querySent(OVC3860PollScheduler::A2DPStatus, getTick());
+	sendData(OVC3860_QUERY_A2DP_STATUS);
+}
+
+
+
+#if OVC3860_FEATURE_MEMORY
+/*
+  Write to Memory #MW
+
+  Command
+  #MW
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to write a byte into a given memory address. The information
+  response and causes will indicate the command success or failure.
+
+  Syntax: AT#MWADDR_VAL
+  ADDR: a given 32-bit, hexadecimal address
+  VAL: a written hexadecimal byte value
+*/
+void OVC3860::writeToMemory(const char* pExtraData, size_t ExtraDataSize) {
+  OVC3860::sendData(OVC3860_WRITE_TO_MEMORY, pExtraData, ExtraDataSize);
+}
+
+
+/*
+  Read from Memory #MX
+
+  Command
+  #MX
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  MEM:<val>
+  Indication Description
+  The Returned Value
+
+
+  Description
+  This command causes the module to read a byte from a given memory address. The information
+  response and causes will indicate the returned value from module reading.
+
+  Syntax: AT#MXADDR
+  ADDR: a given 32-bit, hexadecimal address
+  <val>: a read hexadecimal byte value
+
+  Request is tracked as readFromMemory(uint32_t) one, so its answer
+  is never matched with other request. It is not sent if ADDR is not
+  hex or other #MX requests are still waiting for answer.
+*/
+void OVC3860::readFromMemory(const char* pExtraData, size_t ExtraDataSize) {
+  uint32_t address;
+  if (!memoryPending.isEmpty() || !hexToValue(pExtraData, ExtraDataSize, &address))
+    return;
+  readFromMemory(address);
+}
+
+
+/**
+  * @brief	Read one byte from module memory (#MX).
+  * @note	Non blocking. Address is formatted as 8 hex
+  * 		 digits. Answer (MEM:<val>) is matched with
+  * 		 request in order of sending and stored in
+  * 		 LastMemoryRead.
+  *
+  * @param	address - 32-bit module memory address
+  * @retval	false - OVC3860_MemoryReadWindow requests are already
+  * 		 waiting for answer, answers of timed out requests
+  * 		 may still come or transmit queue is full, try later
+  */
+bool OVC3860::readFromMemory(uint32_t address) {
+	if (memoryPending.isFull() || isMemoryReadBlocked())
+		return false;
+	return sendMemoryRead(address);
+}
+
+
+/**
+  * @brief	Write one byte to module memory (#MW).
+  * @note	Command is formatted as ADDR_VAL: 8 hex digits of
+  * 		 address, '_' and 2 hex digits of value.
+  *
+  * @param	address - 32-bit module memory address
+  * @param	value - byte to write
+  * @retval	n/a
+  */
+void OVC3860::writeToMemory(uint32_t address, uint8_t value) {
+	char extraData[8+1+2];
+	valueToHex(address, 8, extraData);
+	extraData[8] = '_';
+	valueToHex(value, 2, extraData+9);
+	sendData(OVC3860_WRITE_TO_MEMORY, extraData, sizeof(extraData));
+}
+
+
+/**
+  * @brief	Read range of module memory into caller buffer.
+  * @note	Non blocking. Up to OVC3860_MemoryReadWindow #MX
+  * 		 requests are sent back-to-back, each MEM:<val>
+  * 		 answer sends next request. Progress is checked
+  * 		 with getMemoryReadStatus() / getMemoryReadProgress().
+  * 		pBuffer have to exist until read is finished.
+  *
+  * @param	address - first 32-bit module memory address
+  * @param	pBuffer - destination of read bytes
+  * @param	length - number of bytes to read
+  * @retval	false - range read is already ongoing,
+  * 		 single reads are waiting for answers or answers
+  * 		 of timed out requests may still come
+  */
+bool OVC3860::readMemoryRange(uint32_t address, uint8_t* pBuffer, size_t length) {
+	if (memoryRange.status == MemoryBusy || !memoryPending.isEmpty() || pBuffer == 0 || isMemoryReadBlocked())
+		return false;
+
+	memoryRange.pBuffer = pBuffer;
+	memoryRange.startAddress = address;
+	memoryRange.length = length;
+	memoryRange.requested = 0;
+	memoryRange.received = 0;
+	memoryRange.status = (length == 0) ? MemoryDone : MemoryBusy;
+
+	memoryRangeRequestNext();
+	return true;
+}
+
+
+/**
+  * @brief	State of range read started by readMemoryRange().
+  */
+OVC3860::memoryReadStatus OVC3860::getMemoryReadStatus(void) const {
+	return memoryRange.status;
+}
+
+
+/**
+  * @brief	Number of bytes already stored in range read
+  * 		 buffer.
+  */
+size_t OVC3860::getMemoryReadProgress(void) const {
+	return memoryRange.received;
+}
+
+
+/**
+  * @brief	Check if answers of timed out #MX requests may
+  * 		 still come.
+  * @note	Such answer would be matched with new request, so
+  * 		 new requests wait until all late answers came or
+  * 		 next OVC3860_MemoryReadTimeout passed.
+  *
+  * @retval	true - do not send new #MX request
+  */
+bool OVC3860::isMemoryReadBlocked(void) {
+	if (memoryStaleAnswers > 0 && (getTick() - memoryTimeoutTime) > OVC3860_MemoryReadTimeout)
+		memoryStaleAnswers = 0;							//late answers are lost
+	return memoryStaleAnswers > 0;
+}
+
+
+/**
+  * @brief	Send #MX request and remember its address, so
+  * 		 answer could be matched.
+  * @note	Address is remembered only if command was queued,
+  * 		 otherwise MEM: answers would be matched with
+  * 		 wrong addresses.
+  *
+  * @param	address - 32-bit module memory address
+  * @retval	false - transmit queue is full, request was not sent
+  */
+bool OVC3860::sendMemoryRead(uint32_t address) {
+	char extraData[8];
+	valueToHex(address, 8, extraData);
+	if (!sendData(OVC3860_READ_FROM_MEMORY, extraData, sizeof(extraData)))
+		return false;
+	if (memoryPending.isEmpty())
+		memoryLastActivity = getTick();
+	memoryPending.put(address);
+	return true;
+}
+
+
+/**
+  * @brief	Fill request window of range read.
+  * @note	Stops when transmit queue is full, periodicTask(void)
+  * 		 calls it again.
+  */
+void OVC3860::memoryRangeRequestNext(void) {
+	while (memoryRange.status == MemoryBusy
+			&& memoryRange.requested < memoryRange.length
+			&& !memoryPending.isFull())
+	{
+		if (!sendMemoryRead(memoryRange.startAddress + memoryRange.requested))
+			break;
+		memoryRange.requested++;
+	}
+}
+
+
+/**
+  * @brief	MEM:<val> answer had been decoded.
+  * @note	Answers come in order of requests, so the oldest
+  * 		 pending address is the address of this value.
+  *
+  * @param	value - read byte
+  * @retval	n/a
+  */
+void OVC3860::memoryReadReceived(uint8_t value) {
+	if (memoryPending.isEmpty())
+	{
+		if (memoryStaleAnswers > 0)
+			memoryStaleAnswers--;						//late answer of timed out request
+		return;
+	}
+
+	uint32_t address = memoryPending.get();
+	memoryLastActivity = getTick();
+
+	LastMemoryRead.address = address;
+	LastMemoryRead.value = value;
+	LastMemoryRead.isValid = true;
+
+	if (memoryRange.status == MemoryBusy
+			&& (address - memoryRange.startAddress) < memoryRange.length)
+	{
+		memoryRange.pBuffer[address - memoryRange.startAddress] = value;
+		memoryRange.received++;
+		if (memoryRange.received == memoryRange.length)
+			memoryRange.status = MemoryDone;
+		memoryRangeRequestNext();
+	}
+}
+
+
+/**
+  * @brief	ERR had been decoded while #MX requests are
+  * 		 waiting for answer.
+  * @note	Module answers commands in order, so ERR is the
+  * 		 answer of the oldest pending request. Its address
+  * 		 is dropped, LastMemoryRead is marked as not valid
+  * 		 and range read stops with MemoryError.
+  */
+void OVC3860::memoryReadRefused(void) {
+	if (memoryPending.isEmpty())
+		return;											//ERR of other command
+
+	uint32_t address = memoryPending.get();
+	memoryLastActivity = getTick();
+
+	LastMemoryRead.address = address;
+	LastMemoryRead.isValid = false;
+
+	if (memoryRange.status == MemoryBusy
+			&& (address - memoryRange.startAddress) < memoryRange.length)
+		memoryRange.status = MemoryError;
+}
+
+
+/**
+  * @brief	Module did not answer pending #MX requests
+  * 		 within OVC3860_MemoryReadTimeout.
+  * @note	Their answers may still come, new requests are
+  * 		 blocked until then (isMemoryReadBlocked()).
+  */
+void OVC3860::memoryReadTimeout(void) {
+	memoryStaleAnswers = (uint8_t) memoryPending.dataSize();
+	memoryTimeoutTime = getTick();
+	memoryPending.resetCircularBuffer();
+	if (memoryRange.status == MemoryBusy)
+		memoryRange.status = MemoryTimeout;
+}
+#endif /* OVC3860_FEATURE_MEMORY */
+
+
+/*
+  Switch Two Remote Devices #MZ
+
+  Command
+  #MZ
+  Current Status(s)
+  Any
+  Possible
+  Indication(s)
+  SW
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to switch two remote devices. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#MZ
+*/
+void OVC3860::switchDevices() {
+  sendData(OVC3860_SWITCH_DEVICES);
+}
+
+
+
+#if OVC3860_FEATURE_SPP
+/*
+  SPP data transmit #ST
+
+  Command
+  #ST
+  Current Status(s)
+  When SPP is connected
+  Possible Indication(s)
+  OK
+  IndicationDescription
+  Command Accepted
+
+
+  Description
+  This command will send SPP data to the remote device.
+
+  Syntax: AT#STdata
+  data: the string you need to send. The max len is 20.
+*/
+void OVC3860::sppDataTransmit(const char* pExtraData, size_t ExtraDataSize) {
+  OVC3860::sendData(OVC3860_SPP_DATA_TRANSMIT, pExtraData, ExtraDataSize);
+}
+#endif /* OVC3860_FEATURE_SPP */
+
+
+#if OVC3860_FEATURE_TESTMODE
+/*
+  Set Clock Debug Mode #VC
+  Command
+  #VC
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  IndicationDescription
+  Command Accepted
+
+  Description
+  This command causes the module to enter clock debug mode. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#VC
+*/
+void OVC3860::setClockdebugMode() {
+  sendData(OVC3860_SET_CLOCKDEBUG_MODE);
+}
+#endif /* OVC3860_FEATURE_TESTMODE */
+
+
+/*
+  Speaker Volume Down #VD
+
+  Command
+  #VD
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  IndicationDescription
+  Command Accepted
+
+  Description
+  This command causes the module to decrease the speaker volume. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#VD
+*/
+void OVC3860::volumeDown() {
+  OVC3860::sendData(OVC3860_VOLUME_DOWN);
+}
+
+
+#if OVC3860_FEATURE_TESTMODE
+/*
+  Enter BQB Test Mode #VE
+
+  Command
+  #VE
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  IndicationDescription
+  Command Accepted
+
+  Description
+  This command causes the module to enter test mode. The information response and causes will
+  indicate the command success or failure.
+
+  Syntax: AT#VE
+*/
+void OVC3860::enterBQBTestMode() {
+  sendData(OVC3860_ENTER_TEST_MODE);
+}
+
+
+/*
+  Set to Fixed Frequency #VF
+
+  Command
+  #VF
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to work at 2404MHz. The information response and causes will
+  indicate the command success or failure.
+
+  Syntax: AT#VF
+*/
+void OVC3860::setFixedFrequency() {
+  OVC3860::sendData(OVC3860_SET_FIXED_FREQUENCY);
+}
+
+
+/*
+  Enter EMC Test Mode #VG
+
+  Command
+  #VG
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to work at 2404MHz. The information response and causes will
+  indicate the command success or failure.
+
+  Syntax: AT#VGxx_yy
+
+  xx: if set to be 0~78, the frequency is fixed at (2402+xx)MHz, If set to 88, the frequency is in
+  hopping mode.
+
+  yy: set the tx packet type according to the following table.
+
+  Packet Type Value
+  DH1          '04
+  DH3          '08
+  DH5           10
+  2DH1         '05
+  2DH3          11
+  2DH5          13
+  3DH1         '06
+  3DH3          12
+  3DH5          14
+*/
+void OVC3860::enterEMCTestMode(const char* pExtraData, size_t ExtraDataSize){
+  OVC3860::sendData(OVC3860_EMC_TEST_MODE, pExtraData, ExtraDataSize);
+}
+
+
+/*
+  Set RF Register #VH
+
+  Command
+  #VH
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to set a RF register with a given value. The information
+  response and causes will indicate the command success or failure.
+
+  Syntax: AT#VHxx_yy
+  xx: a register address
+  yy: a byte value
+  Example: AT#VH54_88(set RF reg 0x54 to be 0x88)
+*/
+void OVC3860::setRFRegister(const char* pExtraData, size_t ExtraDataSize){
+  OVC3860::sendData(OVC3860_SET_RF_REGISTER, pExtraData, ExtraDataSize);
+}
+#endif /* OVC3860_FEATURE_TESTMODE */
+
+
+
+/*
+  Start Inquiry #VI
+
+  Command
+  #VI
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to inquiry Bluetooth devices. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#VI
+*/
+void OVC3860::inquiryStart() {
+  OVC3860::sendData(OVC3860_INQUIRY_START);
+}
+
+
+/*
+  Cancel Inquiry #VJ
+
+  Command
+  #VJ
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to cancel inquiry Bluetooth devices. The information response
+  and causes will indicate the command success or failure.
+
+  Syntax: AT#VJ
+*/
+void OVC3860::inquiryStop() {
+  OVC3860::sendData(OVC3860_INQUIRY_STOP);
+}
+
+
+/*
+  Speaker Volume Up #VU
+
+  Command
+  #VU
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to increase the speaker volume. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#VU
+*/
+void OVC3860::volumeUp() {
+  OVC3860::sendData(OVC3860_VOLUME_UP);
+}
+
+/**
+  * @brief	Set absolute speaker volume.
+  * @note	Module has only #VU / #VD commands, so the number of
+  * 		 steps is counted from the latest VOL<xx> level and
+  * 		 steps are sent back-to-back (max. OVC3860_VolumeWindow
+  * 		 not confirmed). It may be called on each slider move,
+  * 		 superseded target is dropped. Remaining steps are sent
+  * 		 when VOL<xx> arrives or by periodicTask(void).
+  *
+  * @param	level - 0..OVC3860_VolumeMax
+  * @retval	n/a
+  */
+void OVC3860::setVolume(uint8_t level) {
+	VolumeControl.setTarget(level);
+	serviceVolume(getTick());
+}
+
+/**
+  * @brief	Send #VU / #VD steps requested by VolumeControl.
+  * @note	Step dropped by sendData() (transmit queue is full)
+  * 		 is given back to VolumeControl, so it does not wait
+  * 		 for VOL<xx> which never comes. It is sent by the
+  * 		 next periodicTask(void).
+  */
+void OVC3860::serviceVolume(uint32_t timeStamp) {
+	int8_t step;
+
+	while ((step = VolumeControl.nextStep(timeStamp)) != 0)
+	{
+		if (!sendData((step > 0) ? OVC3860_VOLUME_UP : OVC3860_VOLUME_DOWN))
+		{
+			VolumeControl.stepDropped(step);
+			return;
+		}
+	}
+}
+
+
+/*
+  Power Off OOL #VX
+
+  Command
+  #VX
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  OK
+  Indication Description
+  Command Accepted
+
+  Description
+  This command causes the module to power off OOL. The information response and causes will
+  indicate the command success or failure.
+
+  Syntax: AT#VX
+*/
+void OVC3860::shutdown() {
+  LinkSupervisor.linkReleased(OVC3860LinkSupervisor::HFP);
+  LinkSupervisor.linkReleased(OVC3860LinkSupervisor::A2DP);
+  OVC3860::sendData(OVC3860_SHUTDOWN_MODULE);
+}
+
+
+
+/*
+  Change Local Device Name Casually #MM
+
+  Command
+  #MM
+  Current Status(s)
+  Any
+  Parameters
+  [new name]
+  Possible Indication(s)
+  [MM<current name>]
+  Indication Description
+  Report Current Local Device Name
+
+  Description
+  This command causes the module to change the device name. The information response and causes will indicate the command
+  success or failure.
+
+  Syntax: AT#MM<new name>
+
+  Value:< new name >: local device name
+
+  ※ If new name is empty, the module will report current local device name.
+
+  example:
+  AT#MMMy Car Kit\r\n :the new name is “My Car Kit”
+  AT#MM\r\n :indication will be MM<current name>
+*/
+void OVC3860::changeLocalName(const char* pExtraData, size_t ExtraDataSize) {
+  OVC3860::sendData(OVC3860_CHANGE_LOCAL_NAME, pExtraData, ExtraDataSize);
+}
+
+/*
+  Change Local Device Pin Code #MN
+
+  Command
+  #MN
+  Current Status(s)
+  Any
+  Parameters
+  [new pin]
+  Possible Indication(s)
+  [MN<current pin>]
+  Indication Description
+  Report current local device Pin code
+
+  Description
+  This command causes the module to change the device pin code. The information response and causes will indicate the
+  command success or failure.
+
+  Syntax: AT#MN<new pin>\r\n
+
+  Value:<new pin >: local device pin (4 digital),
+
+  ※ If new pin is empty, the module will report current local pin code.
+
+  example:
+  AT#MN1234 :the new pin is :1234
+  AT#MN :indication will be MP<current pin>
+*/
+void OVC3860::changePin(const char* pExtraData, size_t ExtraDataSize) {
+  OVC3860::sendData(OVC3860_CHANGE_PIN, pExtraData, ExtraDataSize);;
+}
+
+
+/* taken from BLK-MD-SPK-B AT Command Application Guide, did not work on module for me (kovo)
+    pdf: https://github.com/tomaskovacik/kicad-library/blob/master/library/datasheet/OVC3860_based_modules/BLK-MD-SPK-B_AT_Command_set_original.pdf
+  Query Module Software Version #MY
+
+  Command
+  #MY
+  Current Status(s)
+  Any
+  Parameters
+  MW<version>
+  Indication Description
+  Report Module Software Version
+
+  Description
+  This command queries the module’s software version. The information response and causes will indicate the command
+  success or failure.
+
+  Syntax: AT#MY
+*/
+void OVC3860::queryVersion() {
+  OVC3860::sendData(OVC3860_QUERY_VERSION);
+}
+
+
+#if OVC3860_FEATURE_PHONEBOOK
+/*
+  Synchronize Phonebook Stored by SIM(via AT Command) #PA
+
+  Command
+  #PA
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PA1
+  PA0
+  Indication Description
+  Phonebook Synchronize Indication
+  Command Not Supported
+
+  Description
+  This command causes the module to synchronize the phonebook which is stored by SIM. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#PA
+*/
+void OVC3860::pbSyncBySim() {
+  OVC3860::sendData(OVC3860_PB_SYNC_BY_SIM);
+}
+
+
+/*
+  Read Next One Phonebook Item #PC
+
+  Command
+  #PC
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  IP<lehgth>
+  PB<phonebook>
+  PC
+  Indication Description
+  Length of Phone Number
+  One Phonebook Indication
+  End of Phonebook/Call History
+
+  Description
+  This command causes the module to read next one phonebook item from phone or local. The information response and causes
+  will indicate the command success or failure.
+
+  Syntax: AT#PC
+*/
+void OVC3860::pbReadNextItem() {
+  OVC3860::sendData(OVC3860_PB_READ_NEXT_ITEM);
+}
+
+
+
+/*
+  Read Previous One Phonebook Item #PD
+
+  Command
+  #PD
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  IP<lehgth>
+  PB<phonebook>
+  PC
+  Indication Description
+  Length of Phone Number
+  One Phonebook Indication
+  End of Phonebook/Call History
+
+  Description
+  This command causes the module to read previous one phonebook item from phone or local. The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#PD
+*/
+void OVC3860::pbReadPreviousItem() {
+  OVC3860::sendData(OVC3860_PB_READ_PREVIOUS_ITEM);
+}
+
+
+/*
+  Synchronize Dialed Calls List (via AT Command) #PH
+
+  Command
+  #PH
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PA1
+  PA0
+  Indication Description
+  Phonebook Synchronize Indication
+  Command Not Supported
+
+  Description
+  This command causes the module to synchronize the dialed calls list. The information response and causes will indicate the
+  command success or failure.
+
+  Syntax: AT#PH
+  */
+void OVC3860::pbSyncByDialer() {
+  OVC3860::sendData(OVC3860_PB_SYNC_BY_DIALED);
+}
+
+
+/*
+  Synchronize Received Calls List (via AT Command) #PI
+
+  Command
+  #PI
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PA1
+  PA0
+  Indication Description
+  Phonebook Synchronize Indication
+  Command Not Supported
+
+  Description
+  This command causes the module to synchronize the received calls list. The information response and causes will indicate the
+  command success or failure.
+
+  Syntax: AT#PI
+*/
+void OVC3860::pbSyncByReceiver() {
+  OVC3860::sendData(OVC3860_PB_SYNC_BY_RECEIVED);
+}
+
+
+
+/*
+  Synchronize Missed Calls List (via AT Command) #PJ
+
+  Command
+  #PJ
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PA1
+  PA0
+  Indication Description
+  Phonebook Synchronize Indication
+  Command Not Supported
+
+  Description
+  This command causes the module to synchronize the missed calls list. The information response and causes
+  will indicate the command success or failure.
+
+  Syntax: AT#PJ
+*/
+void OVC3860::pbSyncByMissed() {
+  OVC3860::sendData(OVC3860_PB_SYNC_BY_MISSED);
+}
+
+/*
+  Synchronize Last Call List (via AT Command) #PK
+
+  Command
+  #PK
+  Current Status(s)
+  HFP Status = 3
+  Possible Indication(s)
+  PA1
+  PA0
+  Indication Description
+  Phonebook Synchronize Indication
+  Command Not Supported
+
+  Description
+  This command causes the module to synchronize the last call list. The information response and causes will indicate the
+  command success or failure.
+
+  Syntax: AT#PK
+*/
+void OVC3860::pbSyncByLastCall() {
+	OVC3860::sendData(OVC3860_PB_SYNC_BY_LAST_CALL);
+}
+
+/*
+  Get Recent Dialed Call History (record by module) #PL
+
+  Command
+  #PL
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  IP<length>
+  MN<phone number>
+  PC
+  Indication Description
+  Length of Phone Number Indication
+  One Phonebook Indication
+  End of Phonbook/Call History Download Ind
+
+  Description
+  This command causes the module to read one of recently dialed call number(record by module). The information response and
+  causes will indicate the command success or failure.
+
+  Syntax: AT#PL
+*/
+void OVC3860::getLocalLastDialedList() {
+  OVC3860::sendData(OVC3860_GET_LOCAL_LAST_DIALED_LIST);
+}
+
+
+
+/*
+  Get Recent Received Call History (record by module) #PM
+
+  Command
+  #PM
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  IP<length>
+  MN<phone number>
+  PC
+  Indication Description
+  Length of Phone Number Indication
+  One Phonebook Indication
+  End of Phonbook/Call History Download Ind
+
+  Description
+  This command causes the module to read one of recently received call number(record by module). The information response
+  and causes will indicate the command success or failure.
+
+  Syntax: AT#PM
+*/
+void OVC3860::getLocalLastReceivedList() {
+  OVC3860::sendData(OVC3860_GET_LOCAL_LAST_RECEIVED_LIST);
+}
+
+
+/*
+  Get Recent Missed Call History (record by module) #PN
+
+  Command
+  #PN
+  Current Status(s)
+  Any
+  Possible Indication(s)
+  IP<length>
+  MN<phone number>
+  PC
+  Indication Description
+  Length of Phone Numbervoid print Indication
+  One Phonebook Indication
+  End of Phonbook/Call History Download Ind
+
+  Description
+  This command causes the module to read one of recently missed call number(record by module). The information response
+  and causes will indicate the command success or failure.
+
+  Syntax: AT#PN
+*/
+void OVC3860::getLocalLastMissedList() {
+  OVC3860::sendData(OVC3860_GET_LOCAL_LAST_MISSED_LIST);
+}
+#endif /* OVC3860_FEATURE_PHONEBOOK */
+
+
+
+/*
+  Dial Last Received Phone Number #PO
+
+  Command
+  #PO
+  Current Status(s)
+  HFP Status = 3 | 6
+  Possible Indication(s)
+  IC
+  IP<length>
+  IR<phone number>
+  Indication Description
+  Outgoing Call Indication
+  Length of Phone Number Indication
+  Current Call Indication
+
+  Description
+  This command causes the module to dial last received phone number. The information response and causes will indicate the
+  command success or failure.
+
+  Note: IP,IR indication only supported by HFP1.5 version.
+
+  Syntax: AT#PO
+*/
+void OVC3860::dialLastReceivedCall() {
+  OVC3860::sendData(OVC3860_DIAL_LAST_RECEIVED_CALL);
+}
+
+
+
+/*
+  Clear Call History (record by module) #PR
+
+  Command
+  Current Status(s)
+  Possible Indication(s) Indication Description
+  #PO
+  Any
+  OK
+  Command Accepted by Module
+
+  Description
+  This command causes the module to clear call history(record by module). The information response and causes will indicate
+  the command success or failure.
+
+  Syntax: AT#PR
+*/
+void OVC3860::clearLocalCallHistory() {
+  OVC3860::sendData(OVC3860_CLEAR_LOCAL_CALL_HISTORY);
+}
+
+
+/* ---------------------------------------------------------
+ *
+ * 							OVC3860
+ * 						COMMINUCATION module methods
+ *
+ *
+ ---------------------------------------------------------  */
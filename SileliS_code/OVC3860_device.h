@@ -1,533 +1,771 @@
-/**
-  ******************************************************************************
-  * @file    OVC3860_device.h
-  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
-  * @brief   OVC3860 hardware and audio/ phone classes.
-  *          This file provides code to manage OVC3860 audio/ phone.
-  *          It is written in C++ and SMT32 HAL.
-  *          To write this module author uses helpful informations from:
-  *          		- OVC3860 AT Command Application Notes Revision:1.1
-  *          		- BLK-MD-SPK-B AT 命令应用指导 pdf
-  *          		- https://github.com/tomaskovacik/OVC3860
-  *
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
-  * All rights reserved.</center></h2>
-  *
-  *For education and private projects:
-  * This software component is licensed by GNU Public Licence, * the "License" *;
-  * You to copy this scope of file to give informations about copyright to future
-  * commercial / open source projects.
-  *
-  *To use this library for commercial and open source projects please contact with
-  *To  author to agree the terms of use.
-  ******************************************************************************
-*/
-
-#ifndef OVC3860_DEVICE_H_
-#define OVC3860_DEVICE_H_
-
-
-#include "CircularBuffer.h"			//You can find this code on my Github
-#include "stm32f4xx_hal.h"
-//#include <string>
-
-#define	OVC3860_ReceiveBufferType	uint8_t				//defines type of data that are received from OVC6860 chip
-#define	OVC3860_ReceiveBufferSize	65					//defines length of circular buffer to capture data from OVC, min. length is determined by datasheet max. val is mcu depend
-#define	OVC3860_resetLineHigh		GPIO_PIN_RESET		//dfines if OVC reser high is high/ low state of mcu pin. Depend on Your hardware design
-#define	OVC3860_resetLineLow		GPIO_PIN_SET		//dfines if OVC reser high is high/ low state of mcu pin. Depend on Your hardware design
-
-
-/*
- * OVC3860HardWare  is class to manage hardware.
- * This is parrent class for  OVC3860 and OVC3860PSKeys.
- *
- */
-class OVC3860HardWare{
-public:
-	OVC3860HardWare(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin);
-	~OVC3860HardWare();
-
-	void 		resetModule(void);							//Hardware module reset
-	void 		resetHigh();								//Hardware module start
-	void 		resetLow();									//Hardware module stop
-
-
-protected:
-	UART_HandleTypeDef* OVC_huart;
-	GPIO_TypeDef* 		OVC_ResetGPIOx;
-	uint16_t 			OVC_Reset_Pin;
-};
-
-/*
- * OVC3860 is class to manage audio / phone for OVC3860 chip
- * The parrent class is  OVC3860HardWare which sets hardware
- *  issues of OVC3860 i.e. uart, reset line port and pin.
- *
- *  Please take under consideration that this class uses DMA
- *  mechanism to contact with chip.
- */
-class OVC3860: protected CircularBuffer<OVC3860_ReceiveBufferType, OVC3860_ReceiveBufferSize>,
-			   public OVC3860HardWare
-{
-
-public:
-	OVC3860(UART_HandleTypeDef* huart, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin);
-	~OVC3860(void);
-
-	//enumerate for all avaliable on the chip states
-	enum STATES
-	{
-		/*
-		from datasheet:
-		HFP Status Value Description:(MG) => uint8_t HFPState
-		1. Ready (to be connected)
-		2. Connecting
-		3. Connected
-		4. Outgoing Call
-		5. Incoming Call
-		6. Ongoing Call
-		A2DP Status Value Description:(MU) => uint8_t A2DPState
-		1. Ready (to be connected)
-		2. Initializing
-		3. Signalling Active
-		4. Connected
-		5. Streaming
-		AVRCP Status Value Description:(ML) => uint8_t AVRCPState
-		1. Ready (to be connected)
-		2. Connecting
-		3. Connected
-		 */
-
-	  Ready, //HFP,A2DP.AVRCP
-	  Connecting, //HFP.AVRCP
-	  Connected, //HFP,A2DP.AVRCP
-	  OutgoingCall,//HFP
-	  IncomingCall,//HFP
-	  OngoingCall,//HFP
-	  Initializing,//A2DP
-	  SignallingActive,//A2DP
-	  Streaming,//A2DP
-	  Playing, //Music
-	  Idle, //Music = paused/stoped, call =idle;
-	  On, //PowerState
-	  Off, //PowerState
-	  Pairing, //BT
-	  ShutdownInProgress,//PowerState
-	  FastForwarding, //Music
-	  Rewinding, //Music
-	  ConfigError, //Audio
-	  CodecClosed,//Audio
-	  ASR_44800,//Audio
-	  ASR_44100,//Audio
-	  ASR_32000,//Audio
-	  ASR_16000,//Audio
-	  PhoneCall,
-	  Listening,
-	  PhoneHangUp,
-	  SPPopened,
-	  SPPclosed,
-	  Discoverable,
-	  Disconnected,
-	  ConfigMode
-	};
-
-	STATES BTState = Disconnected;
-	STATES HFPState = Disconnected;
-	STATES A2DPState = Disconnected;
-	STATES AVRCPState = Disconnected;
-	STATES CallState = Disconnected;
-	STATES MusicState = Idle;
-	STATES PowerState = Off;
-	STATES Audio;
-	STATES AutoAnswer=Off;
-	STATES AutoConnect=Off;
-
-	//uint8_t volume;			//TODO: code implementation of this feature in decodeReceivedString VOL:
-	//string CallerID;			//TODO: code implementation of this feature in decodeReceivedString NUM:
-	//uint8_t BT_ADDR[6];		//TODO: read thic in PSkey mode
-	//string BT_NAME;			//TODO: code implementation of this feature in decodeReceivedString MM:
-	//string BT_PIN;			//TODO: code implementation of this feature in decodeReceivedString MN:
-
-	//AT COMMANDS
-	//OVC3860 AT Command Application Notes.pfd (version 1.1 2012-10-18 - English)
-	void enterPairingMode(void);
-	void CancelPairingMode(void);
-	void connectHSHF(void);
-	void disconnectHSHF(void);
-	void callAnswer(void);
-	void callReject(void);
-	void callEnd(void);
-	void callRedial(void);
-	void voiceDialStart();
-	void voiceDialEnd();
-	void micToggle();
-	void transferAudio();
-	void callReleaseReject();
-	void callReleaseAccept();
-	void callHoldAccept();
-	void callConference();
-	void callDialNumber(const char* pExtraData, size_t ExtraDataSize);		//Extradata is 13800138000 (number)
-	void sendDTMF(const char* pExtraData, size_t ExtraDataSize=1);			//ExtraData is 1 or 5
-	void queryHFPStatus();
-	void resetSoftware();
-	void musicTogglePlayPause();
-	void musicStop();
-	void musicNextTrack();
-	void musicPreviousTrack();
-	void queryConfiguration();
-	void autoconnEnable();
-	void autoconnDisable();
-	void connectA2DP();
-	void disconnectA2DP();
-	void queryAvrcpStatus();
-	void autoAnswerEnable();
-	void autoAnswerDisable();
-	void musicStartFastForward();
-	void musicStartRewind();
-	void musicStopFFRWD();
-	void queryA2DPStatus();
-	void writeToMemory(const char* pExtraData, size_t ExtraDataSize);	//ExtraData should be givea as: ADDR_VAL
-	void readFromMemory(const char* pExtraData, size_t ExtraDataSize);	//ExtraData is ADDR: a given 32-bit, hexadecimal address so: "00000179" <--len 8
-	void switchDevices();
-	void sppDataTransmit(const char* pExtraData, size_t ExtraDataSize);	//ExtraData is the string you need to send. The max len is 20.
-	void setClockdebugMode();
-	void volumeDown();
-	void enterBQBTestMode();
-	void setFixedFrequency();
-	void enterEMCTestMode(const char* pExtraData, size_t ExtraDataSize=5); //Extra data is xx_yy with "_"
-																		 //xx: if set to be 0~78, the frequency is fixed at (2402+xx)MHz,
-																		 //					If set to 88, the frequency is in hopping mode.
-																		 //yy: set the tx packet type according to the following table.
-	void setRFRegister(const char* pExtraData, size_t ExtraDataSize=5);	 //Extra data is xx_yy xx: a register address
-																		 //			yy: a byte value Example: AT#VH54_88(set RF reg 0x54 to be 0x88)
-	void inquiryStart();
-	void inquiryStop();
-	void volumeUp();
-	void shutdown();
-	//AT COMMANDS
-
-
-
-
-	//AT COMMANDS from chiness documentation
-	//BLK-MD-SPK-B AT.pfd (version ?? 2011-03 - Chiness)
-	//I am not sure if those command works with all moduls in my case had not been working
-	void pairingDeleteThenInit();
-	void changeLocalName(const char* pExtraData, size_t ExtraDataSize);		//without parameter module should return actual name, did not work for me		//TODO: sprawdzić jak to działa
-	void changePin(const char* pExtraData, size_t ExtraDataSize=4); 			//without parameter module should return actual pin, did not work for me				//TODO: sprawdzić jak to działa
-	void queryVersion();
-	void pbSyncBySim();
-	void pbSyncByPhone();
-	void pbReadNextItem();
-	void pbReadPreviousItem();
-	void pbSyncByDialer();
-	void pbSyncByReceiver();
-	void pbSyncByMissed();
-	void pbSyncByLastCall();
-	void getLocalLastDialedList();
-	void getLocalLastReceivedList();
-	void getLocalLastMissedList();
-	void dialLastReceivedCall();
-	void clearLocalCallHistory();
-	//AT COMMANDS from chiness documentation
-
-	void		getData(uint8_t RxBuff);							//get data from OVC and put it to circular buffer
-	uint8_t 	decodeReceivedString(void);
-	circularBufferSearchResult	detectRN(void);						//detect if received message has '\r','\n' sequence which means end of message.
-
-protected:
-
-private:
-	uint8_t* 			pOVC3860SendDataArray = 0;		//HAL_UART_DMA and HAL_UART_IT data arrays have to be GLOBAL, that is the reason why this pointer is declared
-														//it is used in sendData method
-	size_t 				OVC3860SendDataArrayLenght = 0;
-	void createSendDataArray (size_t sizeOfArray);
-	void destroySendDataArray (void);
-
-	void skipBufferItem(uint8_t howMany);
-	void sendData(const char* pCMD, const char* pExtraData=0, size_t ExtraDataSize=0);		//most commands requires
-
-
-	//this enum contains switch() function cases that are used in decodeReceivedString(void) method
-	enum OVC3860_reponse
-		{
-			AX_PA,	//
-			AA1,	//The audio sample rating is set 48000
-			AA2,	//The audio sample rating is set 44100
-			AA4,	//The audio sample rating is set 32000
-			AA8,	//The audio sample rating is set 16000
-			AE,		//Audio config error
-			AF,		//Audio codec is closed
-			AS,		//Audio codec is in phone call mode
-			EPER,	//Error eeprom parameter
-			ERR,	//The command is error
-			II,		//HSHF enters pairing state indication
-			IJ2,	//HSHF exits pairing mode and enters listening
-			IA,		//Disconnected,HSHF state is listening
-			IC,		//Call-setup status is outgoing
-			IF,		//Phone hand up,Call-setup status is idle
-			IG,		//
-	  	  	IL,		//Hold Active Call       Accept Other Call
-			IM,		//Make Conference Call
-			IN,		//Release Held Call       Reject Waiting Call
-			IP,		//IPX Outgoing call number length(X) indication
-			IR,		//Outgoing call number indication
-			IS,		//IS<version>        Power ON Init Complete
-			IT,		//Release Active Call       Accept Other Call
-			IV,		//Connected
-			MA, 	//AV pause/stop Indication
-			MB,		//AV play Indication
-			MC,		//Indication the voice is on Bluetooth
-			MD,		//Indication the voice is on phone
-			ME,		//
-	  	    MEM_,	//
-	  	  	MF,		//MFXY: X and Y are auto answer and auto connect configuration
-			MG,		//MGX: The HSHF applications state is X indication       Report Current HFP Status
-			ML,		//Report Current AVRCP Status
-			MM,		//name
-			MN,		//pin
-			MW,		//version
-			MP,		//Music Pause
-			MR,		//Music Resume;
-			MS,		//Backward song
-			MU,		//Report Current A2DP Status
-			MX,		//Forward song
-			MY,		//AV Disconnect Indication
-			M0,		//
-			M1,		//AV Disconnect Indication
-			M2,		//AV Disconnect Indication
-			M3,		//AV Disconnect Indication
-			M4,		//AV Disconnect Indication
-			NOEP,	//No eeprom
-	  	  	NUM,
-	  	  	OK,
-	  	  	PA,
-	  	  	PB,
-	  	  	PC,		//?
-			PE,		//The voice dial start indication
-			PF,		//The voice dial is not supported/stopped indication
-			SC,		//SPP opened
-			SD,		//SPP closed
-			SW,  	//Command Accepted
-			VOL, 	//Command Accepted
-			WELCOME,
-//			PSkeyEntry,
-//			PSkeyQuit,
-			NO_MESSAGE
-		};
-
-	#define decodedAnswer_len			61	//63
-
-	//this is parsing data table which is used by decodeReceivedString(void)
-	struct typeOVC3860DecodeStruct{
-
-		//this array contains all searched words used by decodeReceivedString(void)
-		//DO NOT CHANDE ORDER of the lines
-		OVC3860_ReceiveBufferType decodeStrings [143  /*153*/] = {
-			0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00, 	//7	//WELCOME
-			//0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00, 	//7	//PSkeyEntry
-			'A','X','_','P','A',	//5
-			//0x60, 0x00, 0x00, 0x00,						//4	//PSkeyQuit
-			'E','P','E','R',		//4		//Error eeprom parameter
-			'M','E','M',':',		//4
-			'N','O','E','P',		//4		//No eeprom
-			'V','O','L',			//3		//Command Accepted
-			'A','A','1',			//3     //The audio sample rating is set 48000
-			'A','A','2',			//3		//The audio sample rating is set 44100
-			'A','A','4',			//3		//The audio sample rating is set 32000
-			'A','A','8',			//3		//The audio sample rating is set 16000
-			'E','R','R',			//3		//The command is error
-			'I','J','2',			//3		//HSHF exits pairing mode and enters listening
-			'N','U','M',			//3
-			'A','E',				//2		//Audio config error
-			'A','F',				//2		//Audio codec is closed
-			'A','S',				//2		//Audio codec is in phone call mode
-			'I','I',				//2		//HSHF enters pairing state indication
-			'I','A',				//2		//Disconnected,HSHF state is listening
-			'I','C',				//2		//Call-setup status is outgoing
-			'I','F',				//2		//Phone hand up,Call-setup status is idle
-			'I','G',				//2
-			'I','L',				//2    	//Hold Active Call       Accept Other Call
-			'I','M',				//2		//Make Conference Call
-			'I','N',				//2		//Release Held Call       Reject Waiting Call
-			'I','P',				//2		//IPX Outgoing call number length(X) indication
-			'I','R',				//2		//Outgoing call number indication
-			'I','S',				//2		//IS<version>        Power ON Init Complete
-			'I','T',				//2		//Release Active Call       Accept Other Call
-			'I','V',				//2		//Connected
-			'M','A',				//2		//AV pause/stop Indication
-			'M','B',				//2		//AV play Indication
-			'M','C',				//2		//Indication the voice is on Bluetooth
-			'M','D',				//2		//Indication the voice is on phone
-			'M','E',				//2
-			'M','F',				//2		//MFXY: X and Y are auto answer and auto connect configuration
-			'M','G',				//2		//MGX: The HSHF applications state is X indication       Report Current HFP Status
-			'M','L',				//2		//Report Current AVRCP Status
-			'M','M',				//2		//name
-			'M','N',				//2		//pin
-			'M','W',				//2		//version
-			'M','P',				//2		//Music Pause
-			'M','R',				//2		//Music Resume;
-			'M','S',				//2		//Backward song
-			'M','U',				//2		//Report Current A2DP Status
-			'M','X',				//2		//Forward song
-			'M','Y',				//2		//AV Disconnect Indication
-			'M','0',				//2		//
-			'M','1',				//2		//AV Disconnect Indication
-			'M','2',				//2		//AV Disconnect Indication
-			'M','3',				//2		//AV Disconnect Indication
-			'M','4',				//2		//AV Disconnect Indication
-			'O','K',				//2
-			'P','A',				//2
-			'P','B',				//2
-			'P','C',				//2
-			'P','E',				//2		//The voice dial start indication
-			'P','F',				//2		//The voice dial is not supported/stopped indication
-			'S','C',				//2		//SPP opened
-			'S','D',				//2		//SPP closed
-			'S','W'				//2		//Command Accepted
-
-		};
-
-		//this array contains all searched words length used by decodeReceivedString(void)
-		//DO NOT CHANDE ORDER of the lines
-		uint8_t decodeStringsLenght [decodedAnswer_len-1] ={
-				7,		//0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00,	//WELCOME
-				//7,		//0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00, 	//PSkeyEntry
-				5,		//AX_PA
-				//4,		//0x60, 0x00, 0x00, 0x00			//PSkeyQuit
-				4,		//EPER	//Error eeprom parameter
-				4,		//MEM:
-				4,		//NOEP	//No eeprom
-				3,		//VOL	//Command Accepted
-				3,		//AA1	//The audio sample rating is set 48000
-				3,		//AA2	//The audio sample rating is set 44100
-				3,		//AA4	//The audio sample rating is set 32000
-				3,		//AA8	//The audio sample rating is set 16000
-				3,		//ERR	//The command is error
-				3,		//IJ2	//HSHF exits pairing mode and enters listening
-				3,		//NUM
-				2,		//AE	//Audio config error
-				2,		//AF	//Audio codec is closed
-				2,		//AS	//Audio codec is in phone call mode
-				2,		//II	//HSHF enters pairing state indication
-				2,		//IA	//Disconnected,HSHF state is listening
-				2,		//IC	//Call-setup status is outgoing
-				2,		//IF	//Phone hand up,Call-setup status is idle
-				2,		//IG
-				2,		//IL	//Hold Active Call       Accept Other Call
-				2,		//IM	//Make Conference Call
-				2,		//IN	//Release Held Call       Reject Waiting Call
-				2,		//IP	//IPX Outgoing call number length(X) indication
-				2,		//IR	//Outgoing call number indication
-				2,		//IS	//IS<version>        Power ON Init Complete
-				2,		//IT	//Release Active Call       Accept Other Call
-				2,		//IV	//Connected
-				2,		//MA	//AV pause/stop Indication
-				2,		//MB	//AV play Indication
-				2,		//MC	//Indication the voice is on Bluetooth
-				2,		//MD	//Indication the voice is on phone
-				2,		//ME
-				2,		//MF	//MFXY: X and Y are auto answer and auto connect configuration
-				2,		//MG	//MGX: The HSHF applications state is X indication       Report Current HFP Status
-				2,		//ML	//Report Current AVRCP Status
-				2,		//MM	//name
-				2,		//MN	//pin
-				2,		//MW	//version
-				2,		//MP	//Music Pause
-				2,		//MR	//Music Resume;
-				2,		//MS	//Backward song
-				2,		//MU	//Report Current A2DP Status
-				2,		//MX	//Forward song
-				2,		//MY	//AV Disconnect Indication
-				2,		//M0	//
-				2,		//M1	//AV Disconnect Indication
-				2,		//M2	//AV Disconnect Indication
-				2,		//M3	//AV Disconnect Indication
-				2,		//M4	//AV Disconnect Indication
-				2,		//OK
-				2,		//PA
-				2,		//PB
-				2,		//PC
-				2,		//PE	//The voice dial start indication
-				2,		//PF	//The voice dial is not supported/stopped indication
-				2,		//SC	//SPP opened
-				2,		//SD	//SPP closed
-				2		//SW	//Command Accepted
-				//0		//NONE
-		};
-
-		//this array contains all searched words enum values (enum OVC3860_reponse) used by decodeReceivedString(void)
-		//DO NOT CHANDE ORDER of the lines
-		OVC3860_reponse decodedAnswer [decodedAnswer_len] = {		//is +1 than "decodeStringsLenght" ponieważ posiada jeszcze odpowiedź NONE
-				WELCOME,		//7,		//0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00,	//WELCOME
-				//PSkeyEntry,	//7,		//0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00, 	//PSkeyEntry
-				AX_PA,			//5,		//AX_PA
-				//PSkeyQuit,	//4,		//0x60, 0x00, 0x00, 0x00			//PSkeyQuit
-				EPER,		//4,		//EPER	//Error eeprom parameter
-				MEM_,		//4,		//MEM:
-				NOEP,		//4,		//NOEP	//No eeprom
-				VOL,		//3,		//VOL	//Command Accepted
-				AA1,		//3,		//AA1	//The audio sample rating is set 48000
-				AA2,		//3,		//AA2	//The audio sample rating is set 44100
-				AA4,		//3,		//AA4	//The audio sample rating is set 32000
-				AA8,		//3,		//AA8	//The audio sample rating is set 16000
-				ERR,		//3,		//ERR	//The command is error
-				IJ2,		//3,		//IJ2	//HSHF exits pairing mode and enters listening
-				NUM,		//3,		//NUM
-				AE,			//2,		//AE	//Audio config error
-				AF,			//2,		//AF	//Audio codec is closed
-				AS,			//2,		//AS	//Audio codec is in phone call mode
-				II,			//2,		//II	//HSHF enters pairing state indication
-				IA,			//2,		//IA	//Disconnected,HSHF state is listening
-				IC,			//2,		//IC	//Call-setup status is outgoing
-				IF,			//2,		//IF	//Phone hand up,Call-setup status is idle
-				IG,			//2,		//IG
-				IL,			//2,		//IL	//Hold Active Call       Accept Other Call
-				IM,			//2,		//IM	//Make Conference Call
-				IN,			//2,		//IN	//Release Held Call       Reject Waiting Call
-				IP,			//2,		//IP	//IPX Outgoing call number length(X) indication
-				IR,			//2,		//IR	//Outgoing call number indication
-				IS,			//2,		//IS	//IS<version>        Power ON Init Complete
-				IT,			//2,		//IT	//Release Active Call       Accept Other Call
-				IV,			//2,		//IV	//Connected
-				MA,			//2,		//MA	//AV pause/stop Indication
-				MB,			//2,		//MB	//AV play Indication
-				MC,			//2,		//MC	//Indication the voice is on Bluetooth
-				MD,			//2,		//MD	//Indication the voice is on phone
-				ME,			//2,		//ME
-				MF,			//2,		//MF	//MFXY: X and Y are auto answer and auto connect configuration
-				MG,			//2,		//MG	//MGX: The HSHF applications state is X indication       Report Current HFP Status
-				ML,			//2,		//ML	//Report Current AVRCP Status
-				MM,			//2,		//MM	//name
-				MN,			//2,		//MN	//pin
-				MW,			//2,		//MW	//version
-				MP,			//2,		//MP	//Music Pause
-				MR,			//2,		//MR	//Music Resume;
-				MS,			//2,		//MS	//Backward song
-				MU,			//2,		//MU	//Report Current A2DP Status
-				MX,			//2,		//MX	//Forward song
-				MY,			//2,		//MY	//AV Disconnect Indication
-				M0,			//2,		//M0	//
-				M1,			//2,		//M1	//AV Disconnect Indication
-				M2,			//2,		//M2	//AV Disconnect Indication
-				M3,			//2,		//M3	//AV Disconnect Indication
-				M4,			//2,		//M4	//AV Disconnect Indication
-				OK,			//2,		//OK
-				PA,			//2,		//PA
-				PB,			//2,		//PB
-				PC,			//2,		//PC
-				PE,			//2,		//PE	//The voice dial start indication
-				PF,			//2,		//PF	//The voice dial is not supported/stopped indication
-				SC,			//2,		//SC	//SPP opened
-				SD,			//2,			//SPP closed
-				SW,			//2		//Command Accepted
-				NO_MESSAGE	//0		//NONE
-		};
-	} const OVC3860DecodeStruct;
-};
-
-#endif /* OVC3860_DEVICE_H_ */
+/**
+  ******************************************************************************
+  * @file    OVC3860_device.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 hardware and audio/ phone classes.
+  *          This file provides code to manage OVC3860 audio/ phone.
+  *          It is written in C++ and SMT32 HAL.
+  *          To write this module author uses helpful informations from:
+  *          		- OVC3860 AT Command Application Notes Revision:1.1
+  *          		- BLK-MD-SPK-B AT 命令应用指导 pdf
+  *          		- https://github.com/tomaskovacik/OVC3860
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_DEVICE_H_
+#define OVC3860_DEVICE_H_
+
+
+#include "CircularBuffer.h"			//You can find this code on my Github
+#include "OVC3860_CodecTelemetry.h"
+#include "OVC3860_LinkSupervisor.h"
+#include "OVC3860_PollScheduler.h"
+#include "OVC3860_ConfigCache.h"
+#include "OVC3860_VolumeControl.h"
+#include "OVC3860_DtmfSequencer.h"
+#include "OVC3860_Transport.h"		//STM32 HAL / POSIX / loopback transport
+
+//#define OVC3860_USE_FREERTOS							//uncomment to use library with FreeRTOS (delays with vTaskDelay, OVC3860RTOS tasks)
+#ifdef OVC3860_USE_FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#endif
+//#include <string>
+
+#define	OVC3860_ReceiveBufferType	uint8_t				//defines type of data that are received from OVC6860 chip
+#define	OVC3860_ReceiveBufferSize	65					//defines length of circular buffer to capture data from OVC, min. length is determined by datasheet max. val is mcu depend
+#define	OVC3860_ReceiveBufferMirrored	true			//true - receive buffer is stored twice (2x OVC3860_ReceiveBufferSize RAM), so response search is one memcmp per position without wrap-around split
+#define	OVC3860_TransmitQueueSize	8					//defines how many commands could wait for UART transmission
+#define	OVC3860_CommandMaxLength	40					//defines max. length of command "AT#XY<extra data>\r\n"
+#define	OVC3860_MemoryReadWindow	4					//defines how many #MX requests could wait for MEM: answer
+#define	OVC3860_MemoryReadTimeout	500					//ms, pending #MX requests are dropped if module does not answer
+#define	OVC3860_ResetPulseWidth		500					//ms, min. time of reset line low state, configurable with setResetPulseWidth()
+#define	OVC3860_ResetReadyTimeout	3000				//ms, max. time between reset line high and WELCOME / IS indication
+#define	OVC3860_NoDeadline			0xFFFFFFFF			//getTimeToNextDeadline(void) value when nothing is scheduled, sleep until interrupt
+#define	OVC3860_AllLines			0xFFFFFFFF			//process(void) line budget, decode all complete lines
+
+//command groups, set to 0 (here or with -D compiler option) to strip not used commands
+// together with their responses from responseRegistry / responseTransitions (small flash MCUs)
+#ifndef OVC3860_FEATURE_PHONEBOOK
+#define	OVC3860_FEATURE_PHONEBOOK	1					//pb*(), getLocalLast*() - #PA..#PN, PA / PB / PC responses
+#endif
+#ifndef OVC3860_FEATURE_TESTMODE
+#define	OVC3860_FEATURE_TESTMODE	1					//setClockdebugMode(), enterBQBTestMode(), setFixedFrequency(), enterEMCTestMode(), setRFRegister() - #VC, #VE..#VH
+#endif
+#ifndef OVC3860_FEATURE_SPP
+#define	OVC3860_FEATURE_SPP			1					//sppDataTransmit() - #ST, SC / SD responses
+#endif
+#ifndef OVC3860_FEATURE_MEMORY
+#define	OVC3860_FEATURE_MEMORY		1					//writeToMemory(), readFromMemory(), readMemoryRange() - #MW / #MX, MEM: response
+#endif
+
+
+/*
+ * OVC3860HardWare  is class to manage hardware.
+ * This is parrent class for  OVC3860 and OVC3860PSKeys.
+ * Hardware access goes through transport selected at compile time
+ *  in OVC3860_Transport.h, so protocol code is not tied to STM32 HAL.
+ *
+ */
+class OVC3860HardWare{
+public:
+	OVC3860HardWare(const OVC3860Transport& Transport);
+#ifdef OVC3860_TRANSPORT_STM32HAL
+	OVC3860HardWare(UART_HandleTypeDef* huart  /*in DMA mode*/, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin);
+#endif
+	~OVC3860HardWare();
+
+	//non-blocking reset sequence, driven by serviceReset() / OVC3860::periodicTask(void)
+	enum resetPhase
+	{
+		ResetIdle,				//no reset since power on
+		ResetPulse,				//reset line is low
+		ResetBooting,			//reset line is high, waiting for WELCOME / IS
+		ResetReady,				//module reported readiness
+		ResetTimeout			//no WELCOME / IS within OVC3860_ResetReadyTimeout
+	};
+
+	void 		resetModule(void);							//Hardware module reset, blocking for reset pulse width only
+	void 		startReset(void);							//non-blocking hardware module reset
+	resetPhase	serviceReset(void);							//moves reset sequence forward
+	resetPhase	getResetPhase(void) const;
+	bool 		isModuleReady(void) const;
+	void 		setResetPulseWidth(uint32_t ms);
+	uint32_t 	getResetPulseWidth(void) const;
+	uint32_t 	getBootTime(void) const;					//ms between reset line high and readiness of last reset
+	bool 		getTimeToResetDeadline(uint32_t* pTimeLeft) const;	//false - no reset in progress
+	void 		resetHigh();								//Hardware module start
+	void 		resetLow();									//Hardware module stop
+	uint32_t 	getTick(void) const;						//time base in ms used for time stamps and timeouts
+	void 		delay(uint32_t ms);							//blocking delay, vTaskDelay with FreeRTOS
+
+
+protected:
+	OVC3860Transport	transport;						//UART, reset line and time base, selected in OVC3860_Transport.h
+	void 		moduleReady(void);							//WELCOME / IS received
+
+private:
+	resetPhase	ResetPhase = ResetIdle;
+	uint32_t	resetPulseWidth = OVC3860_ResetPulseWidth;
+	uint32_t	resetPhaseStart = 0;						//time stamp of actual phase start
+	uint32_t	bootTime = 0;
+};
+
+/*
+ * OVC3860ResponsePattern is one entry of OVC3860::responseRegistry,
+ *  the table of indications searched by decodeReceivedString(void).
+ *  Registry is constexpr, so it is placed in flash and pattern
+ *  lengths are counted by compiler.
+ */
+struct OVC3860ResponsePattern{
+	const char*	pattern;
+	uint8_t		length;
+	uint8_t		code;				//OVC3860::OVC3860_reponse
+
+	template<size_t N> constexpr OVC3860ResponsePattern(const char (&text)[N], uint8_t responseCode): pattern(text), length(N - 1), code(responseCode) {}
+
+	//true if "prefix" is the beginning of "entry"
+	static constexpr bool isPrefix(const OVC3860ResponsePattern& prefix, const OVC3860ResponsePattern& entry){
+		if (prefix.length > entry.length)
+			return false;
+		for (uint8_t i = 0; i < prefix.length; i++)
+			if (prefix.pattern[i] != entry.pattern[i])
+				return false;
+		return true;
+	}
+
+	//entries are compared with line start in order and the first match wins,
+	// so none of them may be a prefix of any later one: each line which starts
+	// with the later entry starts with its prefix too
+	static constexpr bool isOrderValid(const OVC3860ResponsePattern* pRegistry, size_t length){
+		for (size_t i = 0; i < length; i++)
+			for (size_t j = i + 1; j < length; j++)
+				if (isPrefix(pRegistry[i], pRegistry[j]))
+					return false;
+		return true;
+	}
+
+	static constexpr bool isCodeUnique(const OVC3860ResponsePattern* pRegistry, size_t length){
+		for (size_t i = 0; i < length; i++)
+			for (size_t j = i + 1; j < length; j++)
+				if (pRegistry[i].code == pRegistry[j].code)
+					return false;
+		return true;
+	}
+};
+
+
+/*
+ * OVC3860ResponseTransition is one entry of OVC3860::responseTransitions,
+ *  the table which says what decodeReceivedString(void) does with
+ *  decoded indication: state field and value to set, follow-up
+ *  actions and parser of indication parameters.
+ */
+struct OVC3860ResponseTransition{
+	enum stateField
+	{
+		FieldNone,
+		FieldBT,
+		FieldHFP,
+		FieldA2DP,
+		FieldCall,
+		FieldMusic,
+		FieldAudio
+	};
+
+	enum action
+	{
+		ActionPowerOn		= 0x01,		//PowerState = On
+		ActionError			= 0x02,		//decodeReceivedString(void) returns 0
+		ActionPollA2DP		= 0x04,		//PollScheduler: A2DP status query
+		ActionHangUp		= 0x08,		//CallState = PhoneHangUp
+		ActionHFPLost		= 0x10,		//LinkSupervisor
+		ActionHFPRestored	= 0x20,		//LinkSupervisor
+		ActionA2DPLost		= 0x40,		//LinkSupervisor
+		ActionModuleReady	= 0x80		//moduleReady() and ConfigCache revalidation
+	};
+
+	enum parameterParser
+	{
+		ParserNone,
+		ParserCodec,				//CodecTelemetry event from Audio value
+		ParserHFPStatus,			//MGX
+		ParserAVRCPStatus,			//MLX
+		ParserA2DPStatus,			//MUX
+		ParserAutoAnswerConnect,	//MFXY
+		ParserVersion,				//IS<version>, MW<version>
+		ParserName,					//MM<name>
+		ParserPin,					//MN<pin>
+		ParserMemory,				//MEM:<value>
+		ParserMemoryError,			//ERR, may be answer to #MX
+		ParserVolume				//VOL<xx>
+	};
+
+	uint8_t		code;				//OVC3860::OVC3860_reponse, table is indexed by code
+	uint8_t		field;				//stateField
+	uint8_t		value;				//OVC3860::STATES
+	uint8_t		actions;			//bit mask of action
+	uint8_t		parser;				//parameterParser
+
+	static constexpr bool isIndexedByCode(const OVC3860ResponseTransition* pTable, size_t length){
+		for (size_t i = 0; i < length; i++)
+			if (pTable[i].code != i)
+				return false;
+		return true;
+	}
+};
+
+
+/*
+ * OVC3860 is class to manage audio / phone for OVC3860 chip
+ * The parrent class is  OVC3860HardWare which sets hardware
+ *  issues of OVC3860 i.e. uart, reset line port and pin.
+ *
+ *  Please take under consideration that this class uses DMA
+ *  mechanism to contact with chip.
+ *
+ *  Both decodeReceivedString(void) and periodicTask(void) have
+ *   to be called from main loop. decodeReceivedString(void)
+ *   only marks A2DP status as dirty, queryHFPStatus() and
+ *   queryAvrcpStatus() mark HFP / AVRCP status, the queries
+ *   (AT#MV, AT#CY, AT#MO) are sent by periodicTask(void).
+ */
+class OVC3860: protected CircularBuffer<OVC3860_ReceiveBufferType, OVC3860_ReceiveBufferSize, OVC3860_ReceiveBufferMirrored>,
+			   public OVC3860HardWare
+{
+
+public:
+	OVC3860(const OVC3860Transport& Transport);
+#ifdef OVC3860_TRANSPORT_STM32HAL
+	OVC3860(UART_HandleTypeDef* huart, GPIO_TypeDef* ResetGPIOx, uint16_t GPIO_Pin);
+#endif
+	~OVC3860(void);
+
+	//enumerate for all avaliable on the chip states
+	enum STATES
+	{
+		/*
+		from datasheet:
+		HFP Status Value Description:(MG) => uint8_t HFPState
+		1. Ready (to be connected)
+		2. Connecting
+		3. Connected
+		4. Outgoing Call
+		5. Incoming Call
+		6. Ongoing Call
+		A2DP Status Value Description:(MU) => uint8_t A2DPState
+		1. Ready (to be connected)
+		2. Initializing
+		3. Signalling Active
+		4. Connected
+		5. Streaming
+		AVRCP Status Value Description:(ML) => uint8_t AVRCPState
+		1. Ready (to be connected)
+		2. Connecting
+		3. Connected
+		 */
+
+	  Ready, //HFP,A2DP.AVRCP
+	  Connecting, //HFP.AVRCP
+	  Connected, //HFP,A2DP.AVRCP
+	  OutgoingCall,//HFP
+	  IncomingCall,//HFP
+	  OngoingCall,//HFP
+	  Initializing,//A2DP
+	  SignallingActive,//A2DP
+	  Streaming,//A2DP
+	  Playing, //Music
+	  Idle, //Music = paused/stoped, call =idle;
+	  On, //PowerState
+	  Off, //PowerState
+	  Pairing, //BT
+	  ShutdownInProgress,//PowerState
+	  FastForwarding, //Music
+	  Rewinding, //Music
+	  ConfigError, //Audio
+	  CodecClosed,//Audio
+	  ASR_48000,//Audio
+	  ASR_44100,//Audio
+	  ASR_32000,//Audio
+	  ASR_16000,//Audio
+	  PhoneCall,
+	  Listening,
+	  PhoneHangUp,
+	  SPPopened,
+	  SPPclosed,
+	  Discoverable,
+	  Disconnected,
+	  ConfigMode
+	};
+
+	STATES BTState = Disconnected;
+	STATES HFPState = Disconnected;
+	STATES A2DPState = Disconnected;
+	STATES AVRCPState = Disconnected;
+	STATES CallState = Disconnected;
+	STATES MusicState = Idle;
+	STATES PowerState = Off;
+	STATES Audio = CodecClosed;
+	STATES AutoAnswer=Off;
+	STATES AutoConnect=Off;
+
+	OVC3860CodecTelemetry CodecTelemetry;	//codec history fed with AA1/AA2/AA4/AA8, AE, AF, AS indications
+	OVC3860LinkSupervisor LinkSupervisor;	//HFP / A2DP reconnection policy, disabled by default
+	OVC3860PollScheduler  PollScheduler;	//merges #CY / #MV / #MO status queries of indications and application
+	OVC3860ConfigCache	  ConfigCache;		//last known version, name, pin, baudrate, auto answer / connect
+	OVC3860VolumeControl  VolumeControl;	//speaker level from VOL<xx>, #VU / #VD steps requested by setVolume()
+	OVC3860DtmfSequencer  DtmfSequencer;	//DTMF string sent by sendDTMFString(), paced by periodicTask(void)
+	bool 		loadConfigCache(const void* pStorage, size_t storageSize);	//cold start, i.e. from backup SRAM
+
+	//states above are updated field by field, snapshot is their bit-packed copy
+	//published as one word after each decoded line, so ISR or other task reads consistent view
+	enum snapshotField
+	{
+		SnapshotBT,
+		SnapshotHFP,
+		SnapshotA2DP,
+		SnapshotAVRCP,
+		SnapshotCall,
+		SnapshotMusic,
+		SnapshotPower,
+		SnapshotAudio,
+		snapshotField_count
+	};
+	uint32_t 		getStateSnapshot(void) const;								//single 32-bit load
+	static STATES 	snapshotState(uint32_t snapshot, snapshotField field);		//unpack state from snapshot
+	static uint16_t	snapshotVersion(uint32_t snapshot);						//changes each time published states change
+
+	//volume is stored in VolumeControl
+	//string CallerID;			//TODO: code implementation of this feature in decodeReceivedString NUM:
+	//uint8_t BT_ADDR[6];		//TODO: read thic in PSkey mode
+	//BT_NAME, BT_PIN and version are stored in ConfigCache
+
+	//AT COMMANDS
+	//OVC3860 AT Command Application Notes.pfd (version 1.1 2012-10-18 - English)
+	void enterPairingMode(void);
+	void CancelPairingMode(void);
+	void connectHSHF(void);
+	void disconnectHSHF(void);
+	void callAnswer(void);
+	void callReject(void);
+	void callEnd(void);
+	void callRedial(void);
+	void voiceDialStart();
+	void voiceDialEnd();
+	void micToggle();
+	void transferAudio();
+	void callReleaseReject();
+	void callReleaseAccept();
+	void callHoldAccept();
+	void callConference();
+	void callDialNumber(const char* pExtraData, size_t ExtraDataSize);		//Extradata is 13800138000 (number)
+	bool sendDTMF(const char* pExtraData, size_t ExtraDataSize=1);			//ExtraData is 1 or 5, false - dropped
+	bool sendDTMFString(const char* pDigits, size_t length=0);				//non-blocking, i.e. "1234#", length 0 - '\0' terminated
+	void queryHFPStatus();
+	void resetSoftware();
+	void musicTogglePlayPause();
+	void musicStop();
+	void musicNextTrack();
+	void musicPreviousTrack();
+	void queryConfiguration();
+	void autoconnEnable();
+	void autoconnDisable();
+	void connectA2DP();
+	void disconnectA2DP();
+	void queryAvrcpStatus();
+	void autoAnswerEnable();
+	void autoAnswerDisable();
+	void musicStartFastForward();
+	void musicStartRewind();
+	void musicStopFFRWD();
+	void queryA2DPStatus();
+#if OVC3860_FEATURE_MEMORY
+	void writeToMemory(const char* pExtraData, size_t ExtraDataSize);	//ExtraData should be givea as: ADDR_VAL
+	void readFromMemory(const char* pExtraData, size_t ExtraDataSize);	//ExtraData is ADDR: a given 32-bit, hexadecimal address so: "00000179" <--len 8
+	void writeToMemory(uint32_t address, uint8_t value);
+	bool readFromMemory(uint32_t address);								//answer is stored in LastMemoryRead
+	bool readMemoryRange(uint32_t address, uint8_t* pBuffer, size_t length);	//non blocking, pipelined #MX requests
+#endif /* OVC3860_FEATURE_MEMORY */
+	void switchDevices();
+#if OVC3860_FEATURE_SPP
+	void sppDataTransmit(const char* pExtraData, size_t ExtraDataSize);	//ExtraData is the string you need to send. The max len is 20.
+#endif /* OVC3860_FEATURE_SPP */
+#if OVC3860_FEATURE_TESTMODE
+	void setClockdebugMode();
+#endif /* OVC3860_FEATURE_TESTMODE */
+	void volumeDown();
+#if OVC3860_FEATURE_TESTMODE
+	void enterBQBTestMode();
+	void setFixedFrequency();
+	void enterEMCTestMode(const char* pExtraData, size_t ExtraDataSize=5); //Extra data is xx_yy with "_"
+																		 //xx: if set to be 0~78, the frequency is fixed at (2402+xx)MHz,
+																		 //					If set to 88, the frequency is in hopping mode.
+																		 //yy: set the tx packet type according to the following table.
+	void setRFRegister(const char* pExtraData, size_t ExtraDataSize=5);	 //Extra data is xx_yy xx: a register address
+																		 //			yy: a byte value Example: AT#VH54_88(set RF reg 0x54 to be 0x88)
+#endif /* OVC3860_FEATURE_TESTMODE */
+	void inquiryStart();
+	void inquiryStop();
+	void volumeUp();
+	void setVolume(uint8_t level);			//0..OVC3860_VolumeMax, #VU / #VD are sent until VOL<xx> reports level
+	void shutdown();
+	//AT COMMANDS
+
+
+
+
+	//AT COMMANDS from chiness documentation
+	//BLK-MD-SPK-B AT.pfd (version ?? 2011-03 - Chiness)
+	//I am not sure if those command works with all moduls in my case had not been working
+	void pairingDeleteThenInit();
+	void changeLocalName(const char* pExtraData, size_t ExtraDataSize);		//without parameter module should return actual name, did not work for me		//TODO: sprawdzić jak to działa
+	void changePin(const char* pExtraData, size_t ExtraDataSize=4); 			//without parameter module should return actual pin, did not work for me				//TODO: sprawdzić jak to działa
+	void queryVersion();
+#if OVC3860_FEATURE_PHONEBOOK
+	void pbSyncBySim();
+	void pbSyncByPhone();
+	void pbReadNextItem();
+	void pbReadPreviousItem();
+	void pbSyncByDialer();
+	void pbSyncByReceiver();
+	void pbSyncByMissed();
+	void pbSyncByLastCall();
+	void getLocalLastDialedList();
+	void getLocalLastReceivedList();
+	void getLocalLastMissedList();
+#endif /* OVC3860_FEATURE_PHONEBOOK */
+	void dialLastReceivedCall();
+	void clearLocalCallHistory();
+	//AT COMMANDS from chiness documentation
+
+#if OVC3860_FEATURE_MEMORY
+	enum memoryReadStatus
+	{
+		MemoryIdle,
+		MemoryBusy,
+		MemoryDone,
+		MemoryTimeout,
+		MemoryError					//module answered ERR to #MX request
+	};
+	memoryReadStatus 	getMemoryReadStatus(void) const;				//status of readMemoryRange()
+	size_t 				getMemoryReadProgress(void) const;				//bytes already read by readMemoryRange()
+	struct {
+		uint32_t	address;
+		uint8_t		value;
+		bool		isValid;
+	} LastMemoryRead = {0, 0, false};									//the latest MEM:<val> (isValid) or ERR (!isValid) answer matched with #MX request
+#endif /* OVC3860_FEATURE_MEMORY */
+
+	uint32_t	getDroppedCommands(void) const;
+	uint32_t	getDroppedBytes(void) const;						//received bytes of lines which did not fit into circular buffer
+	void		getData(uint8_t RxBuff);							//get data from OVC and put it to circular buffer
+	void		getData(const uint8_t* pRxBuff, size_t size);		//get block of data from OVC and put it to circular buffer
+	uint8_t 	decodeReceivedString(void);
+	uint32_t 	process(uint32_t lineBudget = OVC3860_AllLines, uint32_t timeBudget = OVC3860_NoDeadline);	//decode all complete lines within budget, returns lines left
+	void 		periodicTask(void);									//timing hook, execute it as frequent as decodeReceivedString(void)
+	bool 		isWorkPending(void);								//false - MCU may sleep until interrupt or next deadline
+	uint32_t 	getTimeToNextDeadline(void);						//ms to the next periodicTask(void) job or OVC3860_NoDeadline
+	circularBufferSearchResult	detectRN(void);						//detect if received message has '\r','\n' sequence which means end of message.
+
+protected:
+
+private:
+#ifdef OVC3860_USE_FREERTOS
+	friend class OVC3860RTOS;
+	QueueHandle_t		rtosTransmitQueue = 0;			//set by OVC3860RTOS, then commands are sent by its transmit task
+#endif
+	struct transmitCommand{
+		uint8_t		length;
+		uint8_t		data[OVC3860_CommandMaxLength];
+	};
+	CircularBuffer<transmitCommand, OVC3860_TransmitQueueSize> transmitQueue;		//commands waiting for UART
+	transmitCommand		transmittedCommand;				//HAL_UART_DMA and HAL_UART_IT data arrays have to exist until transmission ends,
+														//that is the reason why command being sent is part of the object
+	uint32_t			droppedCommands = 0;
+	uint32_t			droppedBytes = 0;
+	bool				isDroppingLine = false;			//rest of too long line is dropped up to its '\n'
+	void serviceTransmit(void);
+	bool isTransmitterFree(void) const;
+	void receiveFromTransport(void);
+	void dropUndecodableData(void);
+
+#if OVC3860_FEATURE_MEMORY
+	CircularBuffer<uint32_t, OVC3860_MemoryReadWindow> memoryPending;	//addresses of #MX requests waiting for MEM: answer, in order of sending
+	uint32_t			memoryLastActivity = 0;
+	uint8_t				memoryStaleAnswers = 0;			//answers of timed out requests which may still come
+	uint32_t			memoryTimeoutTime = 0;
+	struct {
+		uint8_t*			pBuffer;
+		uint32_t			startAddress;
+		size_t				length;
+		size_t				requested;
+		size_t				received;
+		memoryReadStatus	status;
+	} memoryRange = {0, 0, 0, 0, 0, MemoryIdle};
+	bool isMemoryReadBlocked(void);
+	bool sendMemoryRead(uint32_t address);
+	void memoryRangeRequestNext(void);
+	void memoryReadReceived(uint8_t value);
+	void memoryReadRefused(void);
+	void memoryReadTimeout(void);
+#endif /* OVC3860_FEATURE_MEMORY */
+	size_t readParameter(uint8_t skip, char* pParameter, size_t maxLength);
+
+	void skipBufferItem(uint8_t howMany);
+	uint32_t countReceivedLines(void) const;
+	uint32_t packStates(void) const;
+	void publishStateSnapshot(void);
+	volatile uint32_t	stateSnapshot = 0;				//bit-packed states + version, written only by publishStateSnapshot()
+	bool sendData(const char* pCMD, const char* pExtraData=0, size_t ExtraDataSize=0);		//false - dropped; queued command is sent when UART is free (serviceTransmit)
+
+
+	//this enum contains switch() function cases that are used in decodeReceivedString(void) method
+	enum OVC3860_reponse
+		{
+			AX_PA,	//
+			AA1,	//The audio sample rating is set 48000
+			AA2,	//The audio sample rating is set 44100
+			AA4,	//The audio sample rating is set 32000
+			AA8,	//The audio sample rating is set 16000
+			AE,		//Audio config error
+			AF,		//Audio codec is closed
+			AS,		//Audio codec is in phone call mode
+			EPER,	//Error eeprom parameter
+			ERR,	//The command is error
+			II,		//HSHF enters pairing state indication
+			IJ2,	//HSHF exits pairing mode and enters listening
+			IA,		//Disconnected,HSHF state is listening
+			IC,		//Call-setup status is outgoing
+			IF,		//Phone hand up,Call-setup status is idle
+			IG,		//
+	  	  	IL,		//Hold Active Call       Accept Other Call
+			IM,		//Make Conference Call
+			IN,		//Release Held Call       Reject Waiting Call
+			IP,		//IPX Outgoing call number length(X) indication
+			IR,		//Outgoing call number indication
+			IS,		//IS<version>        Power ON Init Complete
+			IT,		//Release Active Call       Accept Other Call
+			IV,		//Connected
+			MA, 	//AV pause/stop Indication
+			MB,		//AV play Indication
+			MC,		//Indication the voice is on Bluetooth
+			MD,		//Indication the voice is on phone
+			ME,		//
+#if OVC3860_FEATURE_MEMORY
+	  	    MEM_,	//
+#endif
+	  	  	MF,		//MFXY: X and Y are auto answer and auto connect configuration
+			MG,		//MGX: The HSHF applications state is X indication       Report Current HFP Status
+			ML,		//Report Current AVRCP Status
+			MM,		//name
+			MN,		//pin
+			MW,		//version
+			MP,		//Music Pause
+			MR,		//Music Resume;
+			MS,		//Backward song
+			MU,		//Report Current A2DP Status
+			MX,		//Forward song
+			MY,		//AV Disconnect Indication
+			M0,		//
+			M1,		//AV Disconnect Indication
+			M2,		//AV Disconnect Indication
+			M3,		//AV Disconnect Indication
+			M4,		//AV Disconnect Indication
+			NOEP,	//No eeprom
+	  	  	NUM,
+	  	  	OK,
+#if OVC3860_FEATURE_PHONEBOOK
+	  	  	PA,
+	  	  	PB,
+	  	  	PC,		//?
+#endif
+			PE,		//The voice dial start indication
+			PF,		//The voice dial is not supported/stopped indication
+#if OVC3860_FEATURE_SPP
+			SC,		//SPP opened
+			SD,		//SPP closed
+#endif
+			SW,  	//Command Accepted
+			VOL, 	//Command Accepted
+			WELCOME,
+//			PSkeyEntry,
+//			PSkeyQuit,
+			NO_MESSAGE
+		};
+
+	//this is parsing table which is used by decodeReceivedString(void)
+	//pattern has to start the line, patterns are compared from the first one
+	// and the first match wins, so longer pattern has to be before its prefix
+	// (i.e. "MEM:" before "ME"), static_assert checks it
+	static constexpr OVC3860ResponsePattern responseRegistry[] = {
+		{"\x04\x0F\x04\x00\x01\x00\x00",	WELCOME},	//HCI Command Complete event
+		//{"\x04\x0F\x04\x01\x01\x00\x00",	PSkeyEntry},
+		//{"\x60\x00\x00\x00",	PSkeyQuit},
+		{"AX_PA",		AX_PA},
+		{"EPER",		EPER},		//Error eeprom parameter
+#if OVC3860_FEATURE_MEMORY
+		{"MEM:",		MEM_},
+#endif
+		{"NOEP",		NOEP},		//No eeprom
+		{"VOL",		VOL},		//Command Accepted
+		{"AA1",		AA1},		//The audio sample rating is set 48000
+		{"AA2",		AA2},		//The audio sample rating is set 44100
+		{"AA4",		AA4},		//The audio sample rating is set 32000
+		{"AA8",		AA8},		//The audio sample rating is set 16000
+		{"ERR",		ERR},		//The command is error
+		{"IJ2",		IJ2},		//HSHF exits pairing mode and enters listening
+		{"NUM",		NUM},
+		{"AE",		AE},		//Audio config error
+		{"AF",		AF},		//Audio codec is closed
+		{"AS",		AS},		//Audio codec is in phone call mode
+		{"II",		II},		//HSHF enters pairing state indication
+		{"IA",		IA},		//Disconnected,HSHF state is listening
+		{"IC",		IC},		//Call-setup status is outgoing
+		{"IF",		IF},		//Phone hand up,Call-setup status is idle
+		{"IG",		IG},
+		{"IL",		IL},		//Hold Active Call       Accept Other Call
+		{"IM",		IM},		//Make Conference Call
+		{"IN",		IN},		//Release Held Call       Reject Waiting Call
+		{"IP",		IP},		//IPX Outgoing call number length(X) indication
+		{"IR",		IR},		//Outgoing call number indication
+		{"IS",		IS},		//IS<version>        Power ON Init Complete
+		{"IT",		IT},		//Release Active Call       Accept Other Call
+		{"IV",		IV},		//Connected
+		{"MA",		MA},		//AV pause/stop Indication
+		{"MB",		MB},		//AV play Indication
+		{"MC",		MC},		//Indication the voice is on Bluetooth
+		{"MD",		MD},		//Indication the voice is on phone
+		{"ME",		ME},
+		{"MF",		MF},		//MFXY: X and Y are auto answer and auto connect configuration
+		{"MG",		MG},		//MGX: The HSHF applications state is X indication       Report Current HFP Status
+		{"ML",		ML},		//Report Current AVRCP Status
+		{"MM",		MM},		//name
+		{"MN",		MN},		//pin
+		{"MW",		MW},		//version
+		{"MP",		MP},		//Music Pause
+		{"MR",		MR},		//Music Resume;
+		{"MS",		MS},		//Backward song
+		{"MU",		MU},		//Report Current A2DP Status
+		{"MX",		MX},		//Forward song
+		{"MY",		MY},		//AV Disconnect Indication
+		{"M0",		M0},		//
+		{"M1",		M1},		//AV Disconnect Indication
+		{"M2",		M2},		//AV Disconnect Indication
+		{"M3",		M3},		//AV Disconnect Indication
+		{"M4",		M4},		//AV Disconnect Indication
+		{"OK",		OK},
+#if OVC3860_FEATURE_PHONEBOOK
+		{"PA",		PA},
+		{"PB",		PB},
+		{"PC",		PC},
+#endif
+		{"PE",		PE},		//The voice dial start indication
+		{"PF",		PF},		//The voice dial is not supported/stopped indication
+#if OVC3860_FEATURE_SPP
+		{"SC",		SC},		//SPP opened
+		{"SD",		SD},		//SPP closed
+#endif
+		{"SW",		SW} 		//Command Accepted
+	};
+	static constexpr size_t responseRegistryLength = sizeof(responseRegistry) / sizeof(responseRegistry[0]);
+	static_assert(responseRegistryLength == NO_MESSAGE, "responseRegistry: each OVC3860_reponse (except NO_MESSAGE) needs one pattern");
+	static_assert(OVC3860ResponsePattern::isOrderValid(responseRegistry, responseRegistryLength), "responseRegistry: pattern is placed after its prefix, prefix matches the same line start first, so pattern would never be found");
+	static_assert(OVC3860ResponsePattern::isCodeUnique(responseRegistry, responseRegistryLength), "responseRegistry: OVC3860_reponse is used twice");
+
+	//this is transition table which is used by decodeReceivedString(void)
+	//the lines are in OVC3860_reponse order, table is indexed by decoded indication
+	typedef OVC3860ResponseTransition transition;
+	static constexpr OVC3860ResponseTransition responseTransitions[] = {
+		//code	field					value				actions																parser
+		{AX_PA,	transition::FieldNone,	0,					0,																	transition::ParserNone},
+		{AA1,	transition::FieldAudio,	ASR_48000,			transition::ActionPowerOn,											transition::ParserCodec},
+		{AA2,	transition::FieldAudio,	ASR_44100,			transition::ActionPowerOn,											transition::ParserCodec},
+		{AA4,	transition::FieldAudio,	ASR_32000,			transition::ActionPowerOn,											transition::ParserCodec},
+		{AA8,	transition::FieldAudio,	ASR_16000,			transition::ActionPowerOn,											transition::ParserCodec},
+		{AE,	transition::FieldAudio,	ConfigError,		transition::ActionPowerOn,											transition::ParserCodec},
+		{AF,	transition::FieldAudio,	CodecClosed,		transition::ActionPowerOn,											transition::ParserCodec},
+		{AS,	transition::FieldAudio,	PhoneCall,			transition::ActionPowerOn,											transition::ParserCodec},
+		{EPER,	transition::FieldNone,	0,					transition::ActionPowerOn | transition::ActionError,				transition::ParserNone},
+		{ERR,	transition::FieldNone,	0,					transition::ActionPowerOn | transition::ActionError,				transition::ParserMemoryError},
+		{II,	transition::FieldBT,	Discoverable,		transition::ActionPowerOn | transition::ActionPollA2DP,				transition::ParserNone},
+		{IJ2,	transition::FieldBT,	Listening,			transition::ActionPowerOn,											transition::ParserNone},
+		{IA,	transition::FieldHFP,	Disconnected,		transition::ActionPowerOn | transition::ActionHFPLost,				transition::ParserNone},
+		{IC,	transition::FieldCall,	OngoingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{IF,	transition::FieldCall,	PhoneHangUp,		transition::ActionPowerOn,											transition::ParserNone},
+		{IG,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+		{IL,	transition::FieldCall,	OngoingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{IM,	transition::FieldCall,	OngoingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{IN,	transition::FieldCall,	PhoneHangUp,		transition::ActionPowerOn,											transition::ParserNone},
+		{IP,	transition::FieldCall,	OngoingCall,		transition::ActionPowerOn,											transition::ParserNone},	//todo: IP<len>
+		{IR,	transition::FieldCall,	OutgoingCall,		transition::ActionPowerOn,											transition::ParserNone},	//todo: IR<phonenum>
+		{IS,	transition::FieldNone,	0,					transition::ActionPowerOn | transition::ActionModuleReady,			transition::ParserVersion},
+		{IT,	transition::FieldCall,	OngoingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{IV,	transition::FieldHFP,	Connected,			transition::ActionPowerOn | transition::ActionHFPRestored | transition::ActionPollA2DP,	transition::ParserNone},
+		{MA,	transition::FieldMusic,	Idle,				transition::ActionPowerOn | transition::ActionHangUp | transition::ActionPollA2DP,	transition::ParserNone},
+		{MB,	transition::FieldMusic,	Playing,			transition::ActionPowerOn | transition::ActionHangUp | transition::ActionPollA2DP,	transition::ParserNone},
+		{MC,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+		{MD,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+		{ME,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+#if OVC3860_FEATURE_MEMORY
+		{MEM_,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserMemory},
+#endif
+		{MF,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserAutoAnswerConnect},
+		{MG,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserHFPStatus},
+		{ML,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserAVRCPStatus},
+		{MM,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserName},
+		{MN,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserPin},
+		{MW,	transition::FieldNone,	0,					0,																	transition::ParserVersion},
+		{MP,	transition::FieldMusic,	Idle,				transition::ActionPowerOn | transition::ActionPollA2DP,				transition::ParserNone},
+		{MR,	transition::FieldMusic,	Playing,			transition::ActionPowerOn | transition::ActionPollA2DP,				transition::ParserNone},
+		{MS,	transition::FieldMusic,	Rewinding,			transition::ActionPowerOn,											transition::ParserNone},
+		{MU,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserA2DPStatus},
+		{MX,	transition::FieldMusic,	FastForwarding,		transition::ActionPowerOn,											transition::ParserNone},
+		{MY,	transition::FieldNone,	0,					transition::ActionPowerOn | transition::ActionA2DPLost | transition::ActionPollA2DP,	transition::ParserNone},
+		{M0,	transition::FieldBT,	Disconnected,		transition::ActionPowerOn | transition::ActionHFPLost | transition::ActionA2DPLost,	transition::ParserNone},
+		{M1,	transition::FieldBT,	Connected,			transition::ActionPowerOn,											transition::ParserNone},
+		{M2,	transition::FieldCall,	IncomingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{M3,	transition::FieldCall,	OutgoingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{M4,	transition::FieldCall,	OngoingCall,		transition::ActionPowerOn,											transition::ParserNone},
+		{NOEP,	transition::FieldNone,	0,					transition::ActionPowerOn | transition::ActionError,				transition::ParserNone},
+		{NUM,	transition::FieldCall,	IncomingCall,		transition::ActionPowerOn,											transition::ParserNone},	//todo: CallerID
+		{OK,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+#if OVC3860_FEATURE_PHONEBOOK
+		{PA,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},	//todo: PA1/PA0
+		{PB,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+		{PC,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+#endif
+		{PE,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+		{PF,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+#if OVC3860_FEATURE_SPP
+		{SC,	transition::FieldBT,	SPPopened,			transition::ActionPowerOn,											transition::ParserNone},
+		{SD,	transition::FieldBT,	SPPclosed,			transition::ActionPowerOn,											transition::ParserNone},
+#endif
+		{SW,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserNone},
+		{VOL,	transition::FieldNone,	0,					transition::ActionPowerOn,											transition::ParserVolume},
+		{WELCOME,	transition::FieldNone,	0,				transition::ActionPowerOn | transition::ActionModuleReady,			transition::ParserNone} 
+	};
+	static_assert(sizeof(responseTransitions) / sizeof(responseTransitions[0]) == NO_MESSAGE, "responseTransitions: each OVC3860_reponse (except NO_MESSAGE) needs one transition");
+	static_assert(OVC3860ResponseTransition::isIndexedByCode(responseTransitions, sizeof(responseTransitions) / sizeof(responseTransitions[0])), "responseTransitions: lines have to be in OVC3860_reponse order");
+	uint8_t applyTransition(const OVC3860ResponseTransition& transition);
+	STATES* getStateField(uint8_t field);
+	bool readStatusDigit(const STATES* pValues, size_t valuesCount, STATES* pState);
+	void codecChanged(uint32_t timeStamp);
+	void serviceVolume(uint32_t timeStamp);
+};
+
+#endif /* OVC3860_DEVICE_H_ */
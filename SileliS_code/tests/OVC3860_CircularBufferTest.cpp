@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_CircularBufferTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of CircularBuffer search.
+  *          find() and SearchItemTail2Range() (findItems() /
+  *          findFirstItem() / scanBytes()) are compared with byte by
+  *          byte search of model copy of buffer contents, for both
+  *          layouts, every tail position (alignment of SWAR words),
+  *          every data length (0..3 byte tails, wrap around end of
+  *          array) and random data.
+  *          Host build uses portable SWAR code, __ARM_FEATURE_SIMD32
+  *          variant is built only for Cortex-M.
+  *          CircularBuffer<uint16_t> is checked the same way: find(),
+  *          SearchItemTail2Range() distances are counted in items, not
+  *          bytes, peek() and iterators go through wrapped data.
+  *          O(1) resetCircularBuffer() leaves old bytes in array, test
+  *          checks that search never matches them. It is built twice,
+  *          with and without CIRCULARBUFFER_DEBUG_POISON.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "CircularBuffer.h"
+#include "OVC3860_Test.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define	SearchFills		6			//random contents per tail position and data length
+
+/**
+  * @brief	Reference search: first distance from tail where
+  * 		 pattern starts and fits into range (limited to
+  * 		 length), -1 if none.
+  */
+static long referenceSearch(const uint8_t* pData, size_t length, const uint8_t* pPattern, size_t patternLength, size_t range){
+	if (range > length)
+		range = length;
+	for (size_t distance = 0; distance + patternLength <= range; distance++)
+		if (memcmp(pData + distance, pPattern, patternLength) == 0)
+			return (long) distance;
+	return -1;
+}
+
+/**
+  * @brief	Move tail_ to tailPosition and put length random
+  * 		 bytes, model gets the same bytes.
+  */
+template<size_t Size, bool Mirrored> static void fillAt(CircularBuffer<uint8_t, Size, Mirrored>* pBuffer, size_t tailPosition, size_t length, uint8_t* pModel){
+	uint8_t skip[Size];
+	memset(skip, 0, sizeof(skip));
+	pBuffer->resetCircularBuffer();
+	pBuffer->putN(skip, tailPosition);
+	pBuffer->getN(skip, tailPosition);
+	for (size_t i = 0; i < length; i++)
+		pModel[i] = (uint8_t) ("\r\nAB\x80\xFF\x7F\x01"[rand() % 8]);	//few values, so matches are frequent; 0x80 / 0x7F / 0xFF / 0x01 stress SWAR carries
+	pBuffer->putN(pModel, length);
+}
+
+template<size_t Size, bool Mirrored> static void searchEquivalence(void){
+	static CircularBuffer<uint8_t, Size, Mirrored> buffer;
+	uint8_t model[Size];
+
+	for (size_t tailPosition = 0; tailPosition < Size; tailPosition++)
+		for (size_t length = 0; length <= Size; length++)
+			for (int fill = 0; fill < SearchFills; fill++)
+			{
+				fillAt(&buffer, tailPosition, length, model);
+
+				uint8_t pattern[3];
+				size_t patternLength = 1 + rand() % 3;
+				if (length >= patternLength && (rand() % 2))
+					memcpy(pattern, model + rand() % (length - patternLength + 1), patternLength);	//pattern which is in buffer
+				else
+					for (size_t i = 0; i < patternLength; i++)
+						pattern[i] = (uint8_t) ("\r\nAB\x80\xFF\x7F\x01"[rand() % 8]);
+
+				long expected = referenceSearch(model, length, pattern, patternLength, length);
+				typename CircularBuffer<uint8_t, Size, Mirrored>::const_iterator found = buffer.find(pattern, patternLength);
+				long actual = (found == buffer.end()) ? -1 : (long) found.distance();
+				TEST_CHECK(actual == expected);
+
+				size_t range = rand() % (Size + 2);
+				expected = referenceSearch(model, length, pattern, patternLength, range);
+				circularBufferSearchResult result = buffer.SearchItemTail2Range(pattern, patternLength, range, false);
+				TEST_CHECK(result.isFound == (expected >= 0));
+				TEST_CHECK(!result.isFound || (long) result.tail2virtualTail_ == expected);
+				TEST_CHECK(buffer.dataSize() == length);				//tailPosUpdate = false
+			}
+}
+
+/**
+  * @brief	Reference search of uint16_t items, distance in items.
+  */
+static long referenceSearchWide(const uint16_t* pData, size_t length, const uint16_t* pPattern, size_t patternLength, size_t range){
+	if (range > length)
+		range = length;
+	for (size_t distance = 0; distance + patternLength <= range; distance++)
+		if (memcmp(pData + distance, pPattern, patternLength * sizeof(uint16_t)) == 0)
+			return (long) distance;
+	return -1;
+}
+
+/**
+  * @brief	CircularBuffer<uint16_t>: search, peek and iterators
+  * 		 on wrapped data.
+  * @note	Values share bytes (0x0D0A / 0x0A0D, 0x0A00 / 0x000A),
+  * 		 so byte-wise match at odd offset would be found by
+  * 		 mistake.
+  */
+template<size_t Size, bool Mirrored> static void wideItems(void){
+	static CircularBuffer<uint16_t, Size, Mirrored> buffer;
+	static const uint16_t values[] = {0x0D0A, 0x0A0D, 0x0A00, 0x000A, 0xFFFF, 0x0100};
+	uint16_t model[Size];
+	uint16_t skip[Size];
+
+	memset(skip, 0, sizeof(skip));
+	for (size_t tailPosition = 0; tailPosition < Size; tailPosition++)
+		for (size_t length = 0; length <= Size; length++)
+			for (int fill = 0; fill < SearchFills; fill++)
+			{
+				buffer.resetCircularBuffer();
+				buffer.putN(skip, tailPosition);
+				buffer.getN(skip, tailPosition);
+				for (size_t i = 0; i < length; i++)
+					model[i] = values[rand() % (sizeof(values) / sizeof(values[0]))];
+				TEST_CHECK(buffer.putN(model, length) == length);
+
+				//peek and iterators see items in order, across end of array
+				bool isEqual = true;
+				size_t items = 0;
+				for (typename CircularBuffer<uint16_t, Size, Mirrored>::const_iterator item = buffer.begin(); item != buffer.end(); ++item, items++)
+					isEqual = isEqual && items < length && *item == model[items] && item.distance() == items
+							&& buffer.peek(items) == model[items];
+				TEST_CHECK(isEqual && items == length);
+
+				uint16_t pattern[2];
+				size_t patternLength = 1 + rand() % 2;
+				if (length >= patternLength && (rand() % 2))
+					memcpy(pattern, model + rand() % (length - patternLength + 1), patternLength * sizeof(uint16_t));
+				else
+					for (size_t i = 0; i < patternLength; i++)
+						pattern[i] = values[rand() % (sizeof(values) / sizeof(values[0]))];
+
+				long expected = referenceSearchWide(model, length, pattern, patternLength, length);
+				typename CircularBuffer<uint16_t, Size, Mirrored>::const_iterator found = buffer.find(pattern, patternLength);
+				long actual = (found == buffer.end()) ? -1 : (long) found.distance();
+				TEST_CHECK(actual == expected);
+
+				size_t range = rand() % (Size + 2);
+				expected = referenceSearchWide(model, length, pattern, patternLength, range);
+				circularBufferSearchResult result = buffer.SearchItemTail2Range(pattern, patternLength, range, false);
+				TEST_CHECK(result.isFound == (expected >= 0));
+				TEST_CHECK(!result.isFound || (long) result.tail2virtualTail_ == expected);
+
+				//tail moves to found item, get() returns it
+				if (result.isFound)
+				{
+					buffer.SearchItemTail2Range(pattern, patternLength, range, true);
+					TEST_CHECK(buffer.dataSize() == length - (size_t) expected);
+					TEST_CHECK(buffer.get() == pattern[0]);
+				}
+			}
+}
+
+/**
+  * @brief	Search after reset sees only bytes put after reset.
+  * @note	Whole array is filled with "\r\n" lines (mirrored copy
+  * 		 too), then buffer is reset and partially refilled with
+  * 		 bytes which are not in stale lines. Fresh data end with
+  * 		 '\r' followed in array by stale '\n'.
+  */
+template<size_t Size, bool Mirrored> static void resetStaleData(void){
+	static CircularBuffer<uint8_t, Size, Mirrored> buffer;
+	static const uint8_t staleLine[] = {'I', 'V', '\r', '\n'};
+	static const uint8_t lineEnd[] = {'\r', '\n'};
+	static const uint8_t fresh[] = {'A', 'B'};
+	uint8_t data[Size];
+
+	for (size_t staleTail = 0; staleTail < Size; staleTail++)
+		for (size_t moved = 0; moved < Size; moved += 5)
+			for (size_t length = 0; length < Size; length++)
+			{
+				//stale lines in whole array, starting at any position
+				buffer.resetCircularBuffer();
+				memset(data, 'x', sizeof(data));
+				buffer.putN(data, staleTail);
+				buffer.getN(data, staleTail);
+				for (size_t i = 0; i < Size; i++)
+					data[i] = staleLine[i % sizeof(staleLine)];
+				buffer.putN(data, Size);
+
+				//reset, move tail with fresh data, partial refill ending with '\r'
+				buffer.resetCircularBuffer();
+				for (size_t i = 0; i < Size; i++)
+					data[i] = fresh[i % sizeof(fresh)];
+				buffer.putN(data, moved);
+				buffer.getN(data, moved);
+				for (size_t i = 0; i < length; i++)
+					data[i] = fresh[i % sizeof(fresh)];
+				if (length > 0)
+					data[length - 1] = '\r';
+				buffer.putN(data, length);
+
+				TEST_CHECK(buffer.dataSize() == length);
+				TEST_CHECK(buffer.find(lineEnd, 2) == buffer.end());
+				TEST_CHECK(buffer.find(lineEnd + 1, 1) == buffer.end());
+				TEST_CHECK(buffer.find(staleLine, 1) == buffer.end());
+				TEST_CHECK(!buffer.SearchItemTail2Range(lineEnd, 2, Size, false).isFound);
+				TEST_CHECK(!buffer.SearchItemTail2Range(staleLine, 2, Size, false).isFound);
+				TEST_CHECK((buffer.find(lineEnd, 1) == buffer.end()) == (length == 0));
+#ifdef CIRCULARBUFFER_DEBUG_POISON
+				const uint8_t poison = CIRCULARBUFFER_DEBUG_POISON;
+				TEST_CHECK(buffer.find(&poison, 1) == buffer.end());
+#endif
+			}
+}
+
+int main(void){
+	srand(3860);
+	searchEquivalence<37, false>();
+	searchEquivalence<37, true>();
+	searchEquivalence<64, false>();
+	searchEquivalence<64, true>();
+	wideItems<37, false>();
+	wideItems<37, true>();
+	wideItems<16, false>();
+	wideItems<16, true>();
+	resetStaleData<37, false>();
+	resetStaleData<37, true>();
+#ifdef CIRCULARBUFFER_DEBUG_POISON
+	return TEST_RESULT("CircularBuffer (CIRCULARBUFFER_DEBUG_POISON)");
+#else
+	return TEST_RESULT("CircularBuffer");
+#endif
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_DtmfTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of DTMF string pacing.
+  *          OVC3860::sendDTMFString() is driven by periodicTask(void)
+  *          over loopback transport with virtual time, module side
+  *          records time of each #CX command. Digit dropped by
+  *          full transmit queue is sent when queue has space.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+#define	DtmfTestDuration		10000			//ms of virtual time per case
+#define	DtmfTestPulseWidth		100				//ms, setResetPulseWidth()
+
+struct sentDigit{
+	char		digit;
+	uint32_t	time;
+};
+
+/**
+  * @brief	Run main loop for DtmfTestDuration ms, 1 ms steps or
+  * 		 sleeping until getTimeToNextDeadline(void) (as
+  * 		 OVC3860RTOS / POSIX main loop do), collect #CX digits.
+  * @retval	number of digits in pSent
+  */
+static size_t runMainLoop(OVC3860LoopbackChannel* pChannel, OVC3860* pBT, bool isSleeping, sentDigit* pSent, size_t maxSent){
+	size_t sent = 0;
+	uint32_t end = pChannel->time + DtmfTestDuration;
+
+	while (pChannel->time < end)
+	{
+		pBT->periodicTask();
+
+		uint8_t command[16];
+		size_t length;
+		while ((length = pChannel->moduleReceive(command, 8)) > 0)		//"AT#CXd\r\n"
+		{
+			if (length == 8 && memcmp(command, "AT#CX", 5) == 0 && sent < maxSent)
+			{
+				pSent[sent].digit = (char) command[5];
+				pSent[sent].time = pChannel->time;
+				sent++;
+			}
+		}
+
+		uint32_t step = 1;
+		if (isSleeping)
+		{
+			step = pBT->getTimeToNextDeadline();
+			if (step == 0 || step > end - pChannel->time)
+				step = (step == 0) ? 1 : end - pChannel->time;
+		}
+		pChannel->advanceTime(step);
+	}
+	return sent;
+}
+
+static void checkSequence(const sentDigit* pSent, size_t sent, const sentDigit* pExpected, size_t expected){
+	TEST_CHECK(sent == expected);
+	for (size_t i = 0; i < sent && i < expected; i++)
+	{
+		TEST_CHECK(pSent[i].digit == pExpected[i].digit);
+		TEST_CHECK(pSent[i].time == pExpected[i].time);
+	}
+}
+
+/**
+  * @brief	Digit is not passed while transmit queue is full.
+  */
+static void fullTransmitQueue(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	char received[96];
+	size_t length;
+
+	BT_audio.setResetPulseWidth(DtmfTestPulseWidth);
+	BT_audio.startReset();											//commands wait in transmit queue
+	for (int i = 0; i < OVC3860_TransmitQueueSize; i++)
+		BT_audio.musicNextTrack();
+	TEST_CHECK(BT_audio.sendDTMFString("12", 0));
+	BT_audio.periodicTask();
+	TEST_CHECK(BT_audio.getDroppedCommands() == 1);
+	TEST_CHECK(BT_audio.DtmfSequencer.getSentDigits() == 0);
+
+	//module does not report readiness, queue is released after timeout
+	channel.advanceTime(DtmfTestPulseWidth);
+	BT_audio.periodicTask();
+	channel.advanceTime(OVC3860_ResetReadyTimeout);
+	for (int i = 0; i < 2 * OVC3860_TransmitQueueSize; i++)
+		BT_audio.periodicTask();
+	length = channel.moduleReceive((uint8_t*) received, sizeof(received) - 1);
+	received[length] = '\0';
+	TEST_CHECK(strcmp(received, "AT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#CX1\r\n") == 0);
+	TEST_CHECK(BT_audio.DtmfSequencer.getSentDigits() == 1);
+
+	channel.advanceTime(OVC3860_DtmfDigitGap);
+	BT_audio.periodicTask();
+	length = channel.moduleReceive((uint8_t*) received, sizeof(received) - 1);
+	TEST_CHECK(length == 8 && memcmp(received, "AT#CX2\r\n", 8) == 0);
+	TEST_CHECK(BT_audio.DtmfSequencer.getStatus() == OVC3860DtmfSequencer::DtmfCompleted);
+}
+
+int main(void){
+	for (int isSleeping = 0; isSleeping < 2; isSleeping++)
+	{
+		OVC3860LoopbackChannel channel;
+		OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+		sentDigit sent[OVC3860_DtmfMaxDigits];
+		size_t count;
+
+		//digits OVC3860_DtmfDigitGap apart, ',' adds OVC3860_DtmfPause, a-d sent as A-D
+		channel.advanceTime(1000);
+		TEST_CHECK(BT_audio.sendDTMFString("12,3#a", 0));
+		count = runMainLoop(&channel, &BT_audio, isSleeping, sent, OVC3860_DtmfMaxDigits);
+		const sentDigit pin[] = {{'1', 1000}, {'2', 1250}, {'3', 3500}, {'#', 3750}, {'A', 4000}};
+		checkSequence(sent, count, pin, sizeof(pin) / sizeof(pin[0]));
+		TEST_CHECK(BT_audio.DtmfSequencer.getStatus() == OVC3860DtmfSequencer::DtmfCompleted);
+		TEST_CHECK(BT_audio.DtmfSequencer.getSentDigits() == 5);
+
+		//leading pauses and custom gap
+		BT_audio.DtmfSequencer.setDigitGap(100);
+		uint32_t start = channel.time;
+		TEST_CHECK(BT_audio.sendDTMFString(",,9*", 0));
+		count = runMainLoop(&channel, &BT_audio, isSleeping, sent, OVC3860_DtmfMaxDigits);
+		const sentDigit pause[] = {{'9', start + 2 * OVC3860_DtmfPause}, {'*', start + 2 * OVC3860_DtmfPause + 100}};
+		checkSequence(sent, count, pause, sizeof(pause) / sizeof(pause[0]));
+
+		//invalid or too long string is not sent at all
+		char tooLong[OVC3860_DtmfMaxDigits + 1];
+		memset(tooLong, '1', sizeof(tooLong));
+		TEST_CHECK(!BT_audio.sendDTMFString("12E4", 0));
+		TEST_CHECK(!BT_audio.sendDTMFString(tooLong, sizeof(tooLong)));
+		TEST_CHECK(runMainLoop(&channel, &BT_audio, isSleeping, sent, OVC3860_DtmfMaxDigits) == 0);
+
+		//cancel drops digits which were not sent
+		TEST_CHECK(BT_audio.sendDTMFString("0123", 0));
+		BT_audio.periodicTask();
+		uint8_t first[8];
+		TEST_CHECK(channel.moduleReceive(first, sizeof(first)) == 8 && memcmp(first, "AT#CX0\r\n", 8) == 0);
+		channel.advanceTime(150);
+		BT_audio.DtmfSequencer.cancel();
+		count = runMainLoop(&channel, &BT_audio, isSleeping, sent, OVC3860_DtmfMaxDigits);
+		TEST_CHECK(count == 0);
+		TEST_CHECK(BT_audio.DtmfSequencer.getStatus() == OVC3860DtmfSequencer::DtmfCancelled);
+		TEST_CHECK(BT_audio.DtmfSequencer.getSentDigits() == 1);
+		TEST_CHECK(BT_audio.getDroppedCommands() == 0);
+	}
+	fullTransmitQueue();
+	return TEST_RESULT("OVC3860 DTMF");
+}
+
+#endif /* OVC3860_HOST_TEST */
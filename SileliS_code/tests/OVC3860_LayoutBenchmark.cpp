@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_LayoutBenchmark.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host benchmark of CircularBuffer layouts.
+  *          Compares Mirrored=false and Mirrored=true buffer of
+  *          OVC3860_ReceiveBufferSize and 256 bytes in operations used by
+  *          OVC3860 parser: "\r\n" search over wrapped data, search
+  *          which does not find anything, peek() scan, stream of
+  *          putN() / getN() and stream consumed with linearData().
+  *          Run with "make bench", numbers are host ns per operation,
+  *          only their ratio is meaningful for Cortex-M.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define	BenchmarkLoops		200000
+#define	BenchmarkRepeats	7
+
+static volatile uint32_t benchmarkSink;
+
+template<size_t Size, bool Mirrored> struct benchmark{
+	typedef CircularBuffer<uint8_t, Size, Mirrored> buffer;
+	static const size_t	dataSize = Size - 1;		//bytes waiting in buffer during search / peek
+	static const size_t	chunkSize = Size / 2;		//bytes of one putN() / getN()
+
+	static void fillWrapped(buffer* pBuffer);
+	static uint32_t searchFound(void);
+	static uint32_t searchMissing(void);
+	static uint32_t peekScan(void);
+	static uint32_t putGet(void);
+	static uint32_t putLinear(void);
+};
+
+/**
+  * @brief	Fill buffer with indication lines, so data wrap
+  * 		 around end of array and "\r\n" is at the end.
+  */
+template<size_t Size, bool Mirrored> void benchmark<Size, Mirrored>::fillWrapped(buffer* pBuffer){
+	uint8_t skip[Size];
+	memset(skip, 'x', sizeof(skip));
+	pBuffer->putN(skip, Size - dataSize / 2);
+	pBuffer->getN(skip, Size - dataSize / 2);
+
+	uint8_t line[dataSize];
+	for (size_t i = 0; i < sizeof(line); i++)
+		line[i] = (uint8_t) "MG3 IV MB VOL12 "[i % 16];
+	line[dataSize - 2] = '\r';
+	line[dataSize - 1] = '\n';
+	pBuffer->putN(line, sizeof(line));
+}
+
+/**
+  * @brief	Mean time of operation, the best of BenchmarkRepeats
+  * 		 runs (host scheduler noise only makes runs longer).
+  */
+template<typename Operation> static uint32_t measure(Operation operation){
+	uint32_t best = UINT32_MAX;
+	for (uint32_t repeat = 0; repeat < BenchmarkRepeats; repeat++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < BenchmarkLoops; i++)
+			operation();
+		auto stop = std::chrono::steady_clock::now();
+		uint32_t mean = (uint32_t) (std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / BenchmarkLoops);
+		if (mean < best)
+			best = mean;
+	}
+	return best;
+}
+
+template<size_t Size, bool Mirrored> uint32_t benchmark<Size, Mirrored>::searchFound(void){
+	static buffer ring;
+	fillWrapped(&ring);
+	return measure([]{ benchmarkSink += (uint32_t) ring.SearchItem("\r\n", 2, false).tail2virtualTail_; });
+}
+
+template<size_t Size, bool Mirrored> uint32_t benchmark<Size, Mirrored>::searchMissing(void){
+	static buffer ring;
+	fillWrapped(&ring);
+	return measure([]{ benchmarkSink += (uint32_t) ring.SearchItem("NO", 2, false).isFound; });
+}
+
+template<size_t Size, bool Mirrored> uint32_t benchmark<Size, Mirrored>::peekScan(void){
+	static buffer ring;
+	fillWrapped(&ring);
+	return measure([]{
+		uint32_t sum = 0;
+		for (size_t i = 0; i < dataSize; i++)
+			sum += ring.peek(i);
+		benchmarkSink += sum;
+	});
+}
+
+template<size_t Size, bool Mirrored> uint32_t benchmark<Size, Mirrored>::putGet(void){
+	static buffer ring;
+	static uint8_t chunk[chunkSize];
+	return measure([]{
+		ring.putN(chunk, sizeof(chunk));
+		benchmarkSink += (uint32_t) ring.getN(chunk, sizeof(chunk));
+	});
+}
+
+template<size_t Size, bool Mirrored> uint32_t benchmark<Size, Mirrored>::putLinear(void){
+	static buffer ring;
+	static uint8_t chunk[chunkSize];
+	return measure([]{
+		ring.putN(chunk, sizeof(chunk));
+		uint32_t sum = 0;
+		size_t length;
+		const uint8_t* pData;
+		while ((pData = ring.linearData(&length)) != 0 && length > 0)
+		{
+			for (size_t i = 0; i < length; i++)
+				sum += pData[i];
+			ring.release(length);
+		}
+		benchmarkSink += sum;
+	});
+}
+
+static void report(const char* pName, uint32_t unmirrored, uint32_t mirrored){
+	printf("%-28s %10u %10u %8u%%\n", pName, (unsigned) unmirrored, (unsigned) mirrored,
+			(unsigned) (unmirrored ? (100u * mirrored) / unmirrored : 0));
+}
+
+template<size_t Size> static void reportSize(void){
+	printf("CircularBuffer<uint8_t, %u>, ns per operation\n", (unsigned) Size);
+	printf("%-28s %10s %10s %9s\n", "operation", "unmirrored", "mirrored", "ratio");
+	report("SearchItem \"\\r\\n\" (wrapped)", benchmark<Size, false>::searchFound(), benchmark<Size, true>::searchFound());
+	report("SearchItem missing", benchmark<Size, false>::searchMissing(), benchmark<Size, true>::searchMissing());
+	report("peek() scan", benchmark<Size, false>::peekScan(), benchmark<Size, true>::peekScan());
+	report("putN() + getN()", benchmark<Size, false>::putGet(), benchmark<Size, true>::putGet());
+	report("putN() + linearData()", benchmark<Size, false>::putLinear(), benchmark<Size, true>::putLinear());
+}
+
+int main(void){
+	reportSize<OVC3860_ReceiveBufferSize>();
+	reportSize<256>();
+	return 0;
+}
+
+#endif /* OVC3860_HOST_TEST */
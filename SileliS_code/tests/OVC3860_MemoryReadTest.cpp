@@ -0,0 +1,203 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_MemoryReadTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of #MX request / MEM: answer matching.
+  *          Answers are matched with requests in order of sending,
+  *          test checks cases which used to move bytes to wrong
+  *          addresses: ERR answer, late MEM: after
+  *          OVC3860_MemoryReadTimeout and string readFromMemory()
+  *          during range read.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+#if OVC3860_FEATURE_MEMORY
+
+/**
+  * @brief	Number of #MX requests received by module, the
+  * 		 last requested address.
+  */
+static size_t moduleRequests(OVC3860LoopbackChannel* pChannel, uint32_t* pLastAddress){
+	uint8_t command[15];						//"AT#MXAAAAAAAA\r\n"
+	size_t requests = 0;
+
+	while (pChannel->moduleReceive(command, sizeof(command)) == sizeof(command))
+	{
+		if (memcmp(command, "AT#MX", 5) != 0)
+			continue;
+		uint32_t address = 0;
+		for (size_t i = 5; i < 13; i++)
+			address = (address << 4) | (uint32_t) ((command[i] <= '9') ? command[i] - '0' : command[i] - 'A' + 10);
+		*pLastAddress = address;
+		requests++;
+	}
+	return requests;
+}
+
+static void moduleAnswer(OVC3860LoopbackChannel* pChannel, OVC3860* pBT, const char* pLines){
+	pChannel->moduleSend(pLines);
+	pBT->process();
+}
+
+static bool isLastRead(const OVC3860& BT, uint32_t address, uint8_t value, bool isValid){
+	return BT.LastMemoryRead.address == address && BT.LastMemoryRead.isValid == isValid
+			&& (!isValid || BT.LastMemoryRead.value == value);
+}
+
+/**
+  * @brief	Range read fills buffer, requests are pipelined
+  * 		 in OVC3860_MemoryReadWindow.
+  */
+static void rangeRead(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	uint8_t buffer[6] = {0};
+	uint32_t address = 0;
+
+	TEST_CHECK(BT_audio.readMemoryRange(0x1000, buffer, sizeof(buffer)));
+	TEST_CHECK(moduleRequests(&channel, &address) == OVC3860_MemoryReadWindow && address == 0x1003);
+	TEST_CHECK(!BT_audio.readFromMemory(0x2000));							//window is full
+	moduleAnswer(&channel, &BT_audio, "MEM:10\r\nMEM:11\r\n");
+	TEST_CHECK(moduleRequests(&channel, &address) == 2 && address == 0x1005);
+	moduleAnswer(&channel, &BT_audio, "MEM:12\r\nMEM:13\r\nMEM:14\r\nMEM:15\r\n");
+	TEST_CHECK(BT_audio.getMemoryReadStatus() == OVC3860::MemoryDone);
+	TEST_CHECK(BT_audio.getMemoryReadProgress() == sizeof(buffer));
+	const uint8_t expected[6] = {0x10, 0x11, 0x12, 0x13, 0x14, 0x15};
+	TEST_CHECK(memcmp(buffer, expected, sizeof(buffer)) == 0);
+	TEST_CHECK(isLastRead(BT_audio, 0x1005, 0x15, true));
+}
+
+/**
+  * @brief	ERR is answer of the oldest request, next MEM:
+  * 		 belongs to the next one.
+  */
+static void errorAnswer(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	uint8_t buffer[3] = {0};
+	uint32_t address = 0;
+
+	TEST_CHECK(BT_audio.readFromMemory(0x100));
+	TEST_CHECK(BT_audio.readFromMemory(0x101));
+	moduleAnswer(&channel, &BT_audio, "ERR\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x100, 0, false));
+	moduleAnswer(&channel, &BT_audio, "MEM:22\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x101, 0x22, true));
+
+	//ERR stops range read, bytes after it are not stored
+	moduleRequests(&channel, &address);
+	TEST_CHECK(BT_audio.readMemoryRange(0x200, buffer, sizeof(buffer)));
+	TEST_CHECK(moduleRequests(&channel, &address) == 3);
+	moduleAnswer(&channel, &BT_audio, "MEM:AA\r\nERR\r\n");
+	TEST_CHECK(BT_audio.getMemoryReadStatus() == OVC3860::MemoryError);
+	TEST_CHECK(isLastRead(BT_audio, 0x201, 0, false));
+	moduleAnswer(&channel, &BT_audio, "MEM:CC\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x202, 0xCC, true));
+	TEST_CHECK(buffer[0] == 0xAA && buffer[1] == 0 && buffer[2] == 0);
+	TEST_CHECK(BT_audio.getMemoryReadProgress() == 1);
+
+	//ERR of other command does not touch memory reads
+	moduleAnswer(&channel, &BT_audio, "ERR\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x202, 0xCC, true));
+}
+
+/**
+  * @brief	Late MEM: of timed out request is not matched
+  * 		 with new request.
+  */
+static void lateAnswer(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	uint8_t buffer[2] = {0};
+	uint32_t address = 0;
+
+	TEST_CHECK(BT_audio.readMemoryRange(0x300, buffer, sizeof(buffer)));
+	TEST_CHECK(moduleRequests(&channel, &address) == 2);
+	channel.advanceTime(OVC3860_MemoryReadTimeout + 1);
+	BT_audio.periodicTask();
+	TEST_CHECK(BT_audio.getMemoryReadStatus() == OVC3860::MemoryTimeout);
+
+	//new requests wait for late answers
+	TEST_CHECK(!BT_audio.readFromMemory(0x400));
+	TEST_CHECK(!BT_audio.readMemoryRange(0x300, buffer, sizeof(buffer)));
+	moduleAnswer(&channel, &BT_audio, "MEM:33\r\n");
+	TEST_CHECK(!BT_audio.readFromMemory(0x400));
+	moduleAnswer(&channel, &BT_audio, "MEM:34\r\n");
+	TEST_CHECK(!BT_audio.LastMemoryRead.isValid);
+	TEST_CHECK(BT_audio.readFromMemory(0x400));
+	moduleAnswer(&channel, &BT_audio, "MEM:44\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x400, 0x44, true));
+
+	//answers which never come block requests for one more timeout
+	TEST_CHECK(BT_audio.readFromMemory(0x500));
+	channel.advanceTime(OVC3860_MemoryReadTimeout + 1);
+	BT_audio.periodicTask();
+	channel.advanceTime(OVC3860_MemoryReadTimeout);
+	TEST_CHECK(!BT_audio.readFromMemory(0x600));
+	channel.advanceTime(1);
+	TEST_CHECK(BT_audio.readFromMemory(0x600));
+	moduleAnswer(&channel, &BT_audio, "MEM:66\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x600, 0x66, true));
+}
+
+/**
+  * @brief	String readFromMemory() is tracked too and is not
+  * 		 sent while other requests wait for answer.
+  */
+static void stringRead(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	uint8_t buffer[2] = {0};
+	uint32_t address = 0;
+
+	TEST_CHECK(BT_audio.readMemoryRange(0x700, buffer, sizeof(buffer)));
+	moduleRequests(&channel, &address);
+	BT_audio.readFromMemory("00000800", 8);
+	TEST_CHECK(moduleRequests(&channel, &address) == 0);
+	moduleAnswer(&channel, &BT_audio, "MEM:70\r\nMEM:71\r\n");
+	TEST_CHECK(BT_audio.getMemoryReadStatus() == OVC3860::MemoryDone);
+	TEST_CHECK(buffer[0] == 0x70 && buffer[1] == 0x71);
+
+	BT_audio.readFromMemory("00000800", 8);
+	TEST_CHECK(moduleRequests(&channel, &address) == 1 && address == 0x800);
+	TEST_CHECK(!BT_audio.readMemoryRange(0x700, buffer, sizeof(buffer)));	//string request is pending
+	moduleAnswer(&channel, &BT_audio, "MEM:80\r\n");
+	TEST_CHECK(isLastRead(BT_audio, 0x800, 0x80, true));
+
+	BT_audio.readFromMemory("0000080G", 8);								//not hex
+	TEST_CHECK(moduleRequests(&channel, &address) == 0);
+}
+
+#endif /* OVC3860_FEATURE_MEMORY */
+
+int main(void){
+#if OVC3860_FEATURE_MEMORY
+	rangeRead();
+	errorAnswer();
+	lateAnswer();
+	stringRead();
+#endif /* OVC3860_FEATURE_MEMORY */
+	return TEST_RESULT("OVC3860 memory read");
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,232 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PSKeyProfileTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860PSKeyProfile.
+  *          load() has to reject every damaged profile: any changed
+  *          byte (CRC), wrong size, magic or layout, and runs which are
+  *          not sorted, overlap, are empty or do not fit payload /
+  *          address space even with correct CRC. apply() is checked
+  *          with simulated module (OVC3860_TestModule.h).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_PSKeyProfile.h"
+#include "OVC3860_Test.h"
+#include "OVC3860_TestModule.h"
+#include <string.h>
+
+#define	ProfileTestMaxSize		128
+#define	ProfileTestVersion		0x20200101
+#define	ProfileTestPulseWidth	100			//ms, setResetPulseWidth()
+
+struct testProfile{
+	uint8_t		blob[ProfileTestMaxSize];
+	size_t		size;
+};
+
+/**
+  * @brief	Header with correct CRC for given runs.
+  */
+static testProfile makeProfile(const uint8_t* pPayload, size_t payloadLength, uint16_t runs){
+	testProfile profile;
+	memcpy(profile.blob + OVC3860_ProfileHeaderLength, pPayload, payloadLength);
+	OVC3860PSKeyProfile::buildHeader(profile.blob, runs, profile.blob + OVC3860_ProfileHeaderLength, payloadLength, ProfileTestVersion);
+	profile.size = OVC3860_ProfileHeaderLength + payloadLength;
+	return profile;
+}
+
+/*
+ * Valid profile: pincode (4 bytes) and 30 bytes run at 0x300, which
+ *  needs two write frames.
+ */
+static uint8_t validPayload[2 * OVC3860_ProfileRunHeaderLength + 4 + 30];
+
+static testProfile validProfile(void){
+	uint8_t* pRun = validPayload;
+	pRun[0] = (uint8_t) PSkeys_pincode;
+	pRun[1] = (uint8_t) (PSkeys_pincode >> 8);
+	pRun[2] = 4;
+	pRun[3] = 0;
+	memcpy(pRun + OVC3860_ProfileRunHeaderLength, "1234", 4);
+	pRun += OVC3860_ProfileRunHeaderLength + 4;
+	pRun[0] = 0x00;
+	pRun[1] = 0x03;
+	pRun[2] = 30;
+	pRun[3] = 0;
+	for (uint8_t i = 0; i < 30; i++)
+		pRun[OVC3860_ProfileRunHeaderLength + i] = (uint8_t) (0xA0 + i);
+	return makeProfile(validPayload, sizeof(validPayload), 2);
+}
+
+static void validLoad(void){
+	OVC3860PSKeyProfile Profile;
+	testProfile profile = validProfile();
+	uint16_t address;
+	uint16_t length;
+	const uint8_t* pData;
+
+	TEST_CHECK(!Profile.isLoaded());
+	TEST_CHECK(Profile.load(profile.blob, profile.size));
+	TEST_CHECK(Profile.isLoaded());
+	TEST_CHECK(Profile.getRunCount() == 2);
+	TEST_CHECK(Profile.getProfileVersion() == ProfileTestVersion);
+	TEST_CHECK(Profile.getFrameCount() == 3);
+	TEST_CHECK(Profile.getRun(0, &address, &length, &pData) && address == PSkeys_pincode && length == 4 && memcmp(pData, "1234", 4) == 0);
+	TEST_CHECK(Profile.getRun(1, &address, &length, &pData) && address == 0x300 && length == 30 && pData[29] == 0xA0 + 29);
+	TEST_CHECK(!Profile.getRun(2, &address, &length, &pData));
+}
+
+/**
+  * @brief	Every single byte change and every bit flip of
+  * 		 valid profile is rejected, previous profile is
+  * 		 unloaded by failed load().
+  */
+static void damagedProfile(void){
+	OVC3860PSKeyProfile Profile;
+	testProfile profile = validProfile();
+
+	for (size_t position = 0; position < profile.size; position++)
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			testProfile damaged = profile;
+			damaged.blob[position] ^= (uint8_t) (1u << bit);
+			TEST_CHECK(Profile.load(profile.blob, profile.size));
+			TEST_CHECK(!Profile.load(damaged.blob, damaged.size));
+			TEST_CHECK(!Profile.isLoaded() && Profile.getRunCount() == 0 && Profile.getFrameCount() == 0);
+		}
+
+	//size
+	TEST_CHECK(!Profile.load(0, profile.size));
+	TEST_CHECK(!Profile.load(profile.blob, 0));
+	TEST_CHECK(!Profile.load(profile.blob, OVC3860_ProfileHeaderLength - 1));
+	TEST_CHECK(!Profile.load(profile.blob, profile.size - 1));
+	TEST_CHECK(!Profile.load(profile.blob, profile.size + 1));
+}
+
+/**
+  * @brief	Header with correct CRC but not supported layout,
+  * 		 runs which are not valid.
+  */
+static void invalidRuns(void){
+	OVC3860PSKeyProfile Profile;
+	testProfile profile;
+
+	//layout of future version, CRC is correct
+	profile = validProfile();
+	profile.blob[4] = OVC3860_ProfileLayout + 1;
+	uint32_t crc = OVC3860ConfigCache::crc32(profile.blob, OVC3860_ProfileHeaderLength - 4);
+	crc = OVC3860ConfigCache::crc32(profile.blob + OVC3860_ProfileHeaderLength, profile.size - OVC3860_ProfileHeaderLength, crc);
+	for (uint8_t i = 0; i < 4; i++)
+		profile.blob[16 + i] = (uint8_t) (crc >> (8 * i));
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));
+
+	//run count does not match payload
+	profile = makeProfile(validPayload, sizeof(validPayload), 1);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));					//bytes after the last run
+	profile = makeProfile(validPayload, sizeof(validPayload), 3);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));					//run header after payload
+
+	//run length: 0, longer than payload
+	const uint8_t emptyRun[] = {0x10, 0x00, 0x00, 0x00};
+	profile = makeProfile(emptyRun, sizeof(emptyRun), 1);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));
+	const uint8_t longRun[] = {0x10, 0x00, 0x03, 0x00, 0x01, 0x02};
+	profile = makeProfile(longRun, sizeof(longRun), 1);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));
+
+	//runs not sorted / overlapping, the same runs sorted are valid
+	const uint8_t unsorted[] = {0x20, 0x00, 0x01, 0x00, 0xAA,  0x10, 0x00, 0x01, 0x00, 0xBB};
+	profile = makeProfile(unsorted, sizeof(unsorted), 2);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));
+	const uint8_t overlapping[] = {0x10, 0x00, 0x02, 0x00, 0xAA, 0xAA,  0x11, 0x00, 0x01, 0x00, 0xBB};
+	profile = makeProfile(overlapping, sizeof(overlapping), 2);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));
+	const uint8_t sorted[] = {0x10, 0x00, 0x01, 0x00, 0xBB,  0x20, 0x00, 0x01, 0x00, 0xAA};
+	profile = makeProfile(sorted, sizeof(sorted), 2);
+	TEST_CHECK(Profile.load(profile.blob, profile.size));
+
+	//address space
+	const uint8_t lastByte[] = {0xFF, 0x0F, 0x01, 0x00, 0xCC};
+	profile = makeProfile(lastByte, sizeof(lastByte), 1);
+	TEST_CHECK(Profile.load(profile.blob, profile.size));
+	const uint8_t beyond[] = {0xFF, 0x0F, 0x02, 0x00, 0xCC, 0xCC};
+	profile = makeProfile(beyond, sizeof(beyond), 1);
+	TEST_CHECK(!Profile.load(profile.blob, profile.size));
+}
+
+/**
+  * @brief	apply(): one session, frames split by
+  * 		 OVC3860_PSKeyMaxPayload, failed write quits
+  * 		 config mode, silent module does not block.
+  */
+static void applyProfile(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKey PSKey{OVC3860Transport(&channel)};
+	OVC3860PSKeyProfile Profile;
+	testProfile profile = validProfile();
+
+	PSKey.setResetPulseWidth(ProfileTestPulseWidth);
+	TEST_CHECK(!Profile.apply(PSKey));										//not loaded
+	TEST_CHECK(channel.resetCount == 0);
+
+	TEST_CHECK(Profile.load(profile.blob, profile.size));
+	TEST_CHECK(Profile.apply(PSKey));
+	TEST_CHECK(module.sessions == 1 && module.framesCount == 4);
+	TEST_CHECK(module.frames[0].type == 3 && module.frames[0].address == PSkeys_pincode && module.frames[0].length == 4);
+	TEST_CHECK(module.frames[1].type == 3 && module.frames[1].address == 0x300 && module.frames[1].length == OVC3860_PSKeyMaxPayload);
+	TEST_CHECK(module.frames[2].type == 3 && module.frames[2].address == 0x300 + OVC3860_PSKeyMaxPayload);
+	TEST_CHECK(module.frames[3].type == 5);
+	TEST_CHECK(memcmp(&module.memory[PSkeys_pincode], "1234", 4) == 0);
+	TEST_CHECK(memcmp(&module.memory[0x300], validPayload + 2 * OVC3860_ProfileRunHeaderLength + 4, 30) == 0);
+
+	//module stops acknowledging after the first frame
+	module.clearLog();
+	module.writeACKLimit = 1;
+	uint32_t start = channel.time;
+	TEST_CHECK(!Profile.apply(PSKey));
+	TEST_CHECK(channel.time - start == ProfileTestPulseWidth + OVC3860_PSKeyReplyTimeout);
+	TEST_CHECK(module.framesCount == 3 && module.frames[2].type == 5);		//quit after failed write
+	TEST_CHECK(!module.isConfigMode);
+
+	//silent module
+	module.writeACKLimit = UINT32_MAX;
+	module.sendsWelcome = false;
+	start = channel.time;
+	TEST_CHECK(!Profile.apply(PSKey));
+	TEST_CHECK(channel.time - start == ProfileTestPulseWidth + OVC3860_ResetReadyTimeout);
+
+	//empty profile does not reset module
+	uint32_t resets = channel.resetCount;
+	profile = makeProfile(0, 0, 0);
+	TEST_CHECK(Profile.load(profile.blob, profile.size));
+	TEST_CHECK(Profile.apply(PSKey));
+	TEST_CHECK(channel.resetCount == resets);
+}
+
+int main(void){
+	validLoad();
+	damagedProfile();
+	invalidRuns();
+	applyProfile();
+	return TEST_RESULT("OVC3860 PSKey profile");
+}
+
+#endif /* OVC3860_HOST_TEST */
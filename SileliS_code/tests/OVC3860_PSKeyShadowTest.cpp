@@ -0,0 +1,270 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PSKeyShadowTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860PSKeyShadow.
+  *          Shadow is synchronized with simulated module
+  *          (OVC3860_TestModule.h), test checks which frames reach
+  *          module: only dirty bytes are written, never bytes which
+  *          were not written by application, clean shadow does not
+  *          reset module, failed write is not overwritten by read.
+  *          Config mode waits are bounded by OVC3860_ResetReadyTimeout
+  *          and OVC3860_PSKeyReplyTimeout (virtual time).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_PSKeyShadow.h"
+#include "OVC3860_Test.h"
+#include "OVC3860_TestModule.h"
+#include <string.h>
+
+#define	ShadowTestAddress		0x100		//registered range, not a real PSKey
+#define	ShadowTestLength		30			//two frames
+#define	ShadowTestPulseWidth	100			//ms, setResetPulseWidth()
+
+static bool isFrame(const OVC3860TestModule& module, uint32_t index, uint8_t type, uint16_t address, uint16_t length){
+	return index < module.framesCount && module.frames[index].type == type
+			&& module.frames[index].address == address && module.frames[index].length == length;
+}
+
+/**
+  * @brief	Registration and access before the first load.
+  */
+static void registration(void){
+	OVC3860PSKeyShadow Shadow;
+	uint8_t value[4] = {0};
+
+	TEST_CHECK(Shadow.addRange(OVC3860_PSKEY_ADDR_NAME, OVC3860_PSKeyNameLength));
+	TEST_CHECK(!Shadow.addRange(OVC3860_PSKEY_ADDR_NAME + 4, 4));				//overlaps
+	TEST_CHECK(!Shadow.addRange(OVC3860_PSKEY_ADDR_NAME - 2, 4));
+	TEST_CHECK(!Shadow.addRange(0x10, 0));
+	TEST_CHECK(!Shadow.addRange(0x10, OVC3860_ShadowSize));					//no space
+	TEST_CHECK(Shadow.addRange(PSkeys_pincode, 4));
+	TEST_CHECK(!Shadow.read(PSkeys_pincode, value, 4));						//not loaded
+	TEST_CHECK(!Shadow.write(PSkeys_pincode + 2, value, 4));				//crosses range end
+	TEST_CHECK(!Shadow.write(0x10, value, 1));								//not registered
+	TEST_CHECK(!Shadow.isDirty());
+	TEST_CHECK(!Shadow.isLoaded());
+}
+
+/**
+  * @brief	Load, clean synchronize, dirty runs, unchanged value.
+  */
+static void synchronization(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKey PSKey{OVC3860Transport(&channel)};
+	OVC3860PSKeyShadow Shadow;
+	uint8_t value[ShadowTestLength];
+
+	PSKey.setResetPulseWidth(ShadowTestPulseWidth);
+	for (uint16_t i = 0; i < ShadowTestLength; i++)
+		module.memory[ShadowTestAddress + i] = (uint8_t) (0x30 + i);
+	TEST_CHECK(Shadow.addRange(ShadowTestAddress, ShadowTestLength));
+
+	//the first synchronize() loads range, frames are split by OVC3860_PSKeyMaxPayload
+	TEST_CHECK(Shadow.synchronize(PSKey));
+	TEST_CHECK(module.sessions == 1 && Shadow.getSessionCount() == 1);
+	TEST_CHECK(module.framesCount == 3);
+	TEST_CHECK(isFrame(module, 0, 1, ShadowTestAddress, OVC3860_PSKeyMaxPayload));
+	TEST_CHECK(isFrame(module, 1, 1, ShadowTestAddress + OVC3860_PSKeyMaxPayload, ShadowTestLength - OVC3860_PSKeyMaxPayload));
+	TEST_CHECK(isFrame(module, 2, 5, 0, 0));
+	TEST_CHECK(Shadow.isLoaded() && !Shadow.isDirty());
+	TEST_CHECK(Shadow.read(ShadowTestAddress, value, ShadowTestLength));
+	TEST_CHECK(memcmp(value, &module.memory[ShadowTestAddress], ShadowTestLength) == 0);
+
+	//clean shadow, module is not reset
+	uint32_t resets = channel.resetCount;
+	module.clearLog();
+	TEST_CHECK(Shadow.synchronize(PSKey));
+	TEST_CHECK(channel.resetCount == resets && module.framesCount == 0 && Shadow.getSessionCount() == 1);
+
+	//the same value is not dirty
+	TEST_CHECK(Shadow.write(ShadowTestAddress + 3, &value[3], 5));
+	TEST_CHECK(!Shadow.isDirty());
+
+	//only changed bytes are written, each contiguous run with own frame
+	const uint8_t change[6] = {'a', value[11], value[12], 'b', 'c', value[15]};
+	TEST_CHECK(Shadow.write(ShadowTestAddress + 10, change, sizeof(change)));
+	TEST_CHECK(Shadow.write(ShadowTestAddress + 25, "z", 1));
+	TEST_CHECK(Shadow.isDirty());
+	TEST_CHECK(Shadow.synchronize(PSKey));
+	TEST_CHECK(module.framesCount == 4);
+	TEST_CHECK(isFrame(module, 0, 3, ShadowTestAddress + 10, 1));
+	TEST_CHECK(isFrame(module, 1, 3, ShadowTestAddress + 13, 2));
+	TEST_CHECK(isFrame(module, 2, 3, ShadowTestAddress + 25, 1));
+	TEST_CHECK(isFrame(module, 3, 5, 0, 0));
+	TEST_CHECK(!Shadow.isDirty());
+	TEST_CHECK(module.memory[ShadowTestAddress + 10] == 'a' && module.memory[ShadowTestAddress + 13] == 'b'
+			&& module.memory[ShadowTestAddress + 14] == 'c' && module.memory[ShadowTestAddress + 25] == 'z');
+}
+
+/**
+  * @brief	Write to not loaded range sends only written bytes,
+  * 		 the rest of range comes from module.
+  */
+static void unloadedWrite(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKey PSKey{OVC3860Transport(&channel)};
+	OVC3860PSKeyShadow Shadow;
+	uint8_t value[ShadowTestLength];
+
+	PSKey.setResetPulseWidth(ShadowTestPulseWidth);
+	memset(&module.memory[ShadowTestAddress], 'm', ShadowTestLength);
+	TEST_CHECK(Shadow.addRange(ShadowTestAddress, ShadowTestLength));
+	TEST_CHECK(Shadow.write(ShadowTestAddress, "0", 1));
+	TEST_CHECK(Shadow.write(ShadowTestAddress + 5, "5", 1));
+	TEST_CHECK(Shadow.isDirty());
+	TEST_CHECK(Shadow.synchronize(PSKey));
+	TEST_CHECK(module.sessions == 1);
+	TEST_CHECK(isFrame(module, 0, 3, ShadowTestAddress, 1));
+	TEST_CHECK(isFrame(module, 1, 3, ShadowTestAddress + 5, 1));
+	TEST_CHECK(isFrame(module, 2, 1, ShadowTestAddress, OVC3860_PSKeyMaxPayload));		//read confirms written bytes
+	TEST_CHECK(Shadow.read(ShadowTestAddress, value, ShadowTestLength));
+	TEST_CHECK(value[0] == '0' && value[5] == '5');
+	TEST_CHECK(value[1] == 'm' && value[4] == 'm' && value[6] == 'm');					//bytes 1..4 were not sent
+	TEST_CHECK(memcmp(value, &module.memory[ShadowTestAddress], ShadowTestLength) == 0);
+
+	//invalidate() keeps dirty bytes
+	Shadow.invalidate();
+	TEST_CHECK(!Shadow.isLoaded() && !Shadow.isDirty());
+	TEST_CHECK(!Shadow.read(ShadowTestAddress, value, 1));
+}
+
+/**
+  * @brief	Module does not acknowledge write: bytes stay dirty,
+  * 		 range is not read over them, next synchronize()
+  * 		 writes them again.
+  */
+static void writeFailure(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKey PSKey{OVC3860Transport(&channel)};
+	OVC3860PSKeyShadow Shadow;
+	uint8_t value[4];
+
+	PSKey.setResetPulseWidth(ShadowTestPulseWidth);
+	memcpy(&module.memory[PSkeys_pincode], "0000", 4);
+	TEST_CHECK(Shadow.addRange(PSkeys_pincode, 4));
+	TEST_CHECK(Shadow.write(PSkeys_pincode, "1234", 4));
+
+	module.writeACKLimit = 0;
+	uint32_t start = channel.time;
+	TEST_CHECK(!Shadow.synchronize(PSKey));
+	TEST_CHECK(channel.time - start == ShadowTestPulseWidth + OVC3860_PSKeyReplyTimeout);
+	TEST_CHECK(Shadow.isDirty() && !Shadow.isLoaded());
+	TEST_CHECK(module.framesCount == 2);
+	TEST_CHECK(isFrame(module, 0, 3, PSkeys_pincode, 4));
+	TEST_CHECK(isFrame(module, 1, 5, 0, 0));
+	TEST_CHECK(memcmp(&module.memory[PSkeys_pincode], "0000", 4) == 0);
+
+	module.clearLog();
+	module.writeACKLimit = UINT32_MAX;
+	TEST_CHECK(Shadow.synchronize(PSKey));
+	TEST_CHECK(!Shadow.isDirty() && Shadow.isLoaded());
+	TEST_CHECK(isFrame(module, 0, 3, PSkeys_pincode, 4));
+	TEST_CHECK(isFrame(module, 1, 1, PSkeys_pincode, 4));
+	TEST_CHECK(Shadow.read(PSkeys_pincode, value, 4) && memcmp(value, "1234", 4) == 0);
+	TEST_CHECK(memcmp(&module.memory[PSkeys_pincode], "1234", 4) == 0);
+}
+
+/**
+  * @brief	Silent module: enterConfigMode() / quitConfigMode()
+  * 		 give up after their timeouts.
+  */
+static void configTimeouts(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKey PSKey{OVC3860Transport(&channel)};
+	uint32_t start;
+
+	PSKey.setResetPulseWidth(ShadowTestPulseWidth);
+
+	module.sendsWelcome = false;
+	start = channel.time;
+	TEST_CHECK(!PSKey.enterConfigMode());
+	TEST_CHECK(channel.time - start == ShadowTestPulseWidth + OVC3860_ResetReadyTimeout);
+
+	module.sendsWelcome = true;
+	module.sendsConfigACK = false;
+	start = channel.time;
+	TEST_CHECK(!PSKey.enterConfigMode());
+	TEST_CHECK(channel.time - start == ShadowTestPulseWidth + OVC3860_PSKeyReplyTimeout);
+
+	module.sendsConfigACK = true;
+	module.sendsQuitACK = false;
+	TEST_CHECK(PSKey.enterConfigMode());
+	start = channel.time;
+	TEST_CHECK(!PSKey.quitConfigMode());
+	TEST_CHECK(channel.time - start == OVC3860_PSKeyReplyTimeout);
+
+	//synchronize() of shadow gives up too
+	OVC3860PSKeyShadow Shadow;
+	module.sendsConfigACK = false;
+	TEST_CHECK(Shadow.addRange(PSkeys_pincode, 4));
+	TEST_CHECK(!Shadow.synchronize(PSKey));
+	TEST_CHECK(!Shadow.isLoaded());
+}
+
+/**
+  * @brief	PSKey address has 12 bits, access above
+  * 		 OVC3860_PSKeyMaxAddress is not sent at all.
+  */
+static void addressRange(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKey PSKey{OVC3860Transport(&channel)};
+	uint8_t value[OVC3860_PSKeyMaxPayload + 1];
+
+	PSKey.setResetPulseWidth(ShadowTestPulseWidth);
+	for (uint16_t i = 0; i < sizeof(value); i++)
+		module.memory[OVC3860_PSKeyMaxAddress - sizeof(value) + i] = (uint8_t) i;
+	TEST_CHECK(PSKey.enterConfigMode());
+
+	//the last bytes, address[11:8] is sent in the first header byte
+	TEST_CHECK(PSKey.readPSKey(OVC3860_PSKeyMaxAddress - sizeof(value), value, sizeof(value)));
+	TEST_CHECK(module.framesCount == 2);
+	TEST_CHECK(isFrame(module, 0, 1, OVC3860_PSKeyMaxAddress - sizeof(value), OVC3860_PSKeyMaxPayload));
+	TEST_CHECK(isFrame(module, 1, 1, OVC3860_PSKeyMaxAddress - 1, 1));
+	TEST_CHECK(value[0] == 0 && value[sizeof(value) - 1] == sizeof(value) - 1);
+
+	//address + length above 0x1000
+	module.clearLog();
+	TEST_CHECK(!PSKey.readPSKey(OVC3860_PSKeyMaxAddress - sizeof(value) + 1, value, sizeof(value)));
+	TEST_CHECK(!PSKey.writePSKey(OVC3860_PSKeyMaxAddress - 1, value, 2));
+	TEST_CHECK(!PSKey.writePSKey(0, value, OVC3860_PSKeyMaxAddress + 1));
+	TEST_CHECK(!PSKey.readDataFromOVC(OVC3860_PSKeyMaxAddress, 1));
+	TEST_CHECK(!PSKey.writeData2OVC(0xFFFF, "x", 1));
+	TEST_CHECK(module.framesCount == 0);
+	TEST_CHECK(module.memory[OVC3860_PSKeyMaxAddress - 1] == sizeof(value) - 1);
+	TEST_CHECK(PSKey.quitConfigMode());
+}
+
+int main(void){
+	registration();
+	synchronization();
+	unloadedWrite();
+	writeFailure();
+	configTimeouts();
+	addressRange();
+	return TEST_RESULT("OVC3860 PSKey shadow");
+}
+
+#endif /* OVC3860_HOST_TEST */
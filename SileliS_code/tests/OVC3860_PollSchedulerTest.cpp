@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_PollSchedulerTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860PollScheduler.
+  *          Status queries of application (queryHFPStatus(),
+  *          queryAvrcpStatus()) and A2DP queries triggered by
+  *          indications are merged and sent by periodicTask(void)
+  *          at most once per OVC3860_StatusPollInterval (virtual time
+  *          of loopback transport).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+/**
+  * @brief	Run periodicTask(void) once, compare commands
+  * 		 received by module with expected string.
+  */
+static bool isSent(OVC3860LoopbackChannel* pChannel, OVC3860* pBT, const char* pExpected){
+	char received[64];
+
+	pBT->periodicTask();
+	size_t length = pChannel->moduleReceive((uint8_t*) received, sizeof(received) - 1);
+	received[length] = '\0';
+	if (strcmp(received, pExpected) != 0)
+		printf("sent \"%s\", expected \"%s\"\n", received, pExpected);
+	return strcmp(received, pExpected) == 0;
+}
+
+int main(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	OVC3860PollScheduler& Scheduler = BT_audio.PollScheduler;
+
+	channel.advanceTime(1000);
+
+	//application queries are not sent inline, repeated ones are merged
+	BT_audio.queryHFPStatus();
+	BT_audio.queryHFPStatus();
+	BT_audio.queryAvrcpStatus();
+	TEST_CHECK(channel.toModule.isEmpty());
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#CY\r\nAT#MO\r\n"));
+	TEST_CHECK(Scheduler.getTriggers(OVC3860PollScheduler::HFPStatus) == 2);
+	TEST_CHECK(Scheduler.getQueries(OVC3860PollScheduler::HFPStatus) == 1);
+	TEST_CHECK(Scheduler.getSavedQueries(OVC3860PollScheduler::HFPStatus) == 1);
+	TEST_CHECK(Scheduler.getQueries(OVC3860PollScheduler::AVRCPStatus) == 1);
+
+	//next query waits for OVC3860_StatusPollInterval
+	channel.advanceTime(100);
+	BT_audio.queryHFPStatus();
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	TEST_CHECK(BT_audio.getTimeToNextDeadline() == OVC3860_StatusPollInterval - 100);
+	channel.advanceTime(OVC3860_StatusPollInterval - 101);
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	channel.advanceTime(1);
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#CY\r\n"));
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+
+	//indications trigger A2DP query, the direct one satisfies waiting trigger
+	channel.moduleSend("IV\r\nIA\r\nIV\r\n");
+	BT_audio.process();
+	TEST_CHECK(Scheduler.isDirty(OVC3860PollScheduler::A2DPStatus));
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MV\r\n"));
+	TEST_CHECK(Scheduler.getSavedQueries(OVC3860PollScheduler::A2DPStatus) == 1);
+	channel.moduleSend("IV\r\n");
+	BT_audio.decodeReceivedString();
+	BT_audio.queryA2DPStatus();
+	TEST_CHECK(!Scheduler.isDirty(OVC3860PollScheduler::A2DPStatus));
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MV\r\n"));
+	channel.advanceTime(OVC3860_StatusPollInterval);
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+
+	//interval 0 sends every trigger with next periodicTask(void)
+	Scheduler.setInterval(0);
+	BT_audio.queryAvrcpStatus();
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MO\r\n"));
+	BT_audio.queryAvrcpStatus();
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MO\r\n"));
+	TEST_CHECK(BT_audio.getDroppedCommands() == 0);
+
+	return TEST_RESULT("OVC3860 poll scheduler");
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ProcessTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860::process().
+  *          Line budget, time budget (virtual time of loopback
+  *          transport) and returned number of lines left. Burst
+  *          longer than circular buffer is decoded without loss,
+  *          each decoded line makes room for the rest of it.
+  *          Decoded lines are counted by IV indications, each
+  *          one triggers A2DP status query of OVC3860PollScheduler.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+
+#define	ProcessTestLineTime		10			//ms, virtual time of one decoded line
+
+static void moduleSendLines(OVC3860LoopbackChannel* pChannel, uint32_t lines){
+	for (uint32_t i = 0; i < lines; i++)
+		pChannel->moduleSend("IV\r\n");
+}
+
+static uint32_t decodedLines(const OVC3860& BT){
+	return BT.PollScheduler.getTriggers(OVC3860PollScheduler::A2DPStatus);
+}
+
+/**
+  * @brief	Channel handler, decoding takes time.
+  * @note	When whole burst is in circular buffer, transport
+  * 		 is read once by process() and once per decoded line,
+  * 		 so time moves by ProcessTestLineTime on each read of
+  * 		 empty channel.
+  */
+static void slowDecoding(OVC3860LoopbackChannel* pChannel, void* /*pContext*/){
+	if (pChannel->toHost.isEmpty())
+		pChannel->advanceTime(ProcessTestLineTime);
+}
+
+/**
+  * @brief	Line budget, returned number of lines left.
+  */
+static void lineBudget(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+
+	TEST_CHECK(BT_audio.process() == 0);								//nothing received
+	moduleSendLines(&channel, 5);
+	TEST_CHECK(BT_audio.process(0) == 5);
+	TEST_CHECK(decodedLines(BT_audio) == 0);
+	TEST_CHECK(BT_audio.process(2) == 3);
+	TEST_CHECK(decodedLines(BT_audio) == 2);
+	TEST_CHECK(BT_audio.process(3) == 0);
+	TEST_CHECK(decodedLines(BT_audio) == 5);
+
+	//incomplete line is not counted, it is decoded when its end arrives
+	moduleSendLines(&channel, 2);
+	channel.moduleSend("IV\r");
+	TEST_CHECK(BT_audio.process(1) == 1);
+	TEST_CHECK(BT_audio.process() == 0);
+	TEST_CHECK(decodedLines(BT_audio) == 7);
+	channel.moduleSend("\n");
+	TEST_CHECK(BT_audio.process() == 0);
+	TEST_CHECK(decodedLines(BT_audio) == 8);
+}
+
+/**
+  * @brief	Time budget is checked before each line, time
+  * 		 is measured from process() call.
+  */
+static void timeBudget(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+
+	channel.handler = slowDecoding;
+	moduleSendLines(&channel, 4);
+	TEST_CHECK(BT_audio.process(OVC3860_AllLines, 0) == 4);
+	TEST_CHECK(decodedLines(BT_audio) == 0);
+
+	//read of empty channel and two lines use the budget
+	TEST_CHECK(BT_audio.process(OVC3860_AllLines, 3 * ProcessTestLineTime - 5) == 2);
+	TEST_CHECK(decodedLines(BT_audio) == 2);
+	TEST_CHECK(BT_audio.process(OVC3860_AllLines, OVC3860_NoDeadline) == 0);
+	TEST_CHECK(decodedLines(BT_audio) == 4);
+
+	//both budgets, the first used one stops decoding
+	moduleSendLines(&channel, 4);
+	TEST_CHECK(BT_audio.process(1, 3 * ProcessTestLineTime - 5) == 3);
+	TEST_CHECK(decodedLines(BT_audio) == 5);
+	TEST_CHECK(BT_audio.process(OVC3860_AllLines, 2 * ProcessTestLineTime - 5) == 2);
+	TEST_CHECK(decodedLines(BT_audio) == 6);
+	channel.handler = 0;
+	TEST_CHECK(BT_audio.process() == 0);
+	TEST_CHECK(decodedLines(BT_audio) == 8);
+}
+
+/**
+  * @brief	Burst longer than circular buffer: transport
+  * 		 stops when buffer is full of complete lines, the
+  * 		 rest is read as decoded lines release buffer,
+  * 		 one process() decodes whole burst.
+  */
+static void fullBuffer(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	const uint32_t bufferLines = OVC3860_ReceiveBufferSize / 4;		//"IV\r\n"
+	const uint32_t burstLines = bufferLines + 4;
+
+	moduleSendLines(&channel, burstLines);
+	TEST_CHECK(BT_audio.process(0) == bufferLines);					//buffer is full
+	TEST_CHECK(!channel.toHost.isEmpty());
+	TEST_CHECK(BT_audio.process(1) == bufferLines - 1);				//released room is filled by next receive
+	TEST_CHECK(decodedLines(BT_audio) == 1);
+	TEST_CHECK(BT_audio.process() == 0);
+	TEST_CHECK(decodedLines(BT_audio) == burstLines);
+	TEST_CHECK(channel.toHost.isEmpty());
+	TEST_CHECK(BT_audio.getDroppedBytes() == 0);
+
+	//buffer works after burst
+	channel.moduleSend("MB\r\n");
+	BT_audio.process();
+	TEST_CHECK(OVC3860::snapshotState(BT_audio.getStateSnapshot(), OVC3860::SnapshotMusic) == OVC3860::Playing);
+}
+
+int main(void){
+	lineBudget();
+	timeBudget();
+	fullBuffer();
+	return TEST_RESULT("OVC3860 process");
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,240 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ProvisioningTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860PSKeySession and OVC3860Provisioning.
+  *          Sessions write profile to simulated modules
+  *          (OVC3860_TestModule.h) over loopback transport, 1 ms steps
+  *          of virtual time. Failure cases check that module is never
+  *          left in config mode: failed write is followed by quit
+  *          config mode, module which does not quit is held in reset.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_Provisioning.h"
+#include "OVC3860_Test.h"
+#include "OVC3860_TestModule.h"
+#include <string.h>
+
+#define	SessionTestPulseWidth	100			//ms, setResetPulseWidth()
+#define	SessionTestTimeLimit	10000		//ms of virtual time per session
+#define	SessionTestSeats		3
+#define	SessionTestRunAddress	0x300
+#define	SessionTestRunLength	50			//three write frames
+
+static uint8_t profileBlob[OVC3860_ProfileHeaderLength + 2 * OVC3860_ProfileRunHeaderLength + 4 + SessionTestRunLength];
+
+/**
+  * @brief	Profile: pincode and SessionTestRunLength bytes at
+  * 		 SessionTestRunAddress, 4 write frames.
+  */
+static void loadProfile(OVC3860PSKeyProfile* pProfile){
+	uint8_t* pRun = profileBlob + OVC3860_ProfileHeaderLength;
+	const uint8_t pincode[] = {(uint8_t) PSkeys_pincode, (uint8_t) (PSkeys_pincode >> 8), 4, 0, '4', '3', '2', '1'};
+	memcpy(pRun, pincode, sizeof(pincode));
+	pRun += sizeof(pincode);
+	const uint8_t runHeader[] = {(uint8_t) SessionTestRunAddress, (uint8_t) (SessionTestRunAddress >> 8), SessionTestRunLength, 0};
+	memcpy(pRun, runHeader, sizeof(runHeader));
+	for (uint8_t i = 0; i < SessionTestRunLength; i++)
+		pRun[OVC3860_ProfileRunHeaderLength + i] = (uint8_t) (0x80 + i);
+	OVC3860PSKeyProfile::buildHeader(profileBlob, 2, profileBlob + OVC3860_ProfileHeaderLength,
+									 sizeof(profileBlob) - OVC3860_ProfileHeaderLength, 1);
+	TEST_CHECK(pProfile->load(profileBlob, sizeof(profileBlob)));
+	TEST_CHECK(pProfile->getFrameCount() == 4);
+}
+
+/**
+  * @brief	Service session every 1 ms until it ends.
+  * @retval	final state
+  */
+static OVC3860PSKeySession::sessionState runSession(OVC3860PSKeySession* pSession, OVC3860LoopbackChannel* pChannel){
+	uint32_t end = pChannel->time + SessionTestTimeLimit;
+
+	while (pSession->service(), pSession->isRunning() && pChannel->time < end)
+		pChannel->advanceTime(1);
+	return pSession->getState();
+}
+
+static bool isProfileWritten(const OVC3860TestModule& module){
+	return memcmp(&module.memory[PSkeys_pincode], "4321", 4) == 0
+			&& memcmp(&module.memory[SessionTestRunAddress], profileBlob + sizeof(profileBlob) - SessionTestRunLength, SessionTestRunLength) == 0;
+}
+
+static void passedSession(const OVC3860PSKeyProfile* pProfile){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKeySession Session{OVC3860Transport(&channel)};
+
+	Session.setResetPulseWidth(SessionTestPulseWidth);
+	TEST_CHECK(Session.getState() == OVC3860PSKeySession::SessionIdle);
+	TEST_CHECK(Session.start(pProfile));
+	TEST_CHECK(!Session.start(pProfile));									//running
+	uint32_t start = channel.time;
+	TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionPassed);
+	TEST_CHECK(Session.getError() == OVC3860PSKeySession::ErrorNone);
+	TEST_CHECK(Session.getFramesDone() == 4 && Session.getFramesTotal() == 4);
+	TEST_CHECK(Session.getDuration() == channel.time - start);
+	TEST_CHECK(module.sessions == 1 && module.framesCount == 5);
+	TEST_CHECK(module.frames[0].type == 3 && module.frames[0].address == PSkeys_pincode && module.frames[0].length == 4);
+	TEST_CHECK(module.frames[1].type == 3 && module.frames[1].address == SessionTestRunAddress && module.frames[1].length == OVC3860_PSKeyMaxPayload);
+	TEST_CHECK(module.frames[3].type == 3 && module.frames[3].length == SessionTestRunLength - 2 * OVC3860_PSKeyMaxPayload);
+	TEST_CHECK(module.frames[4].type == 5);
+	TEST_CHECK(isProfileWritten(module));
+	TEST_CHECK(!module.isConfigMode && channel.isModuleRunning);
+
+	//next unit in the same seat
+	memset(module.memory, 0, sizeof(module.memory));
+	TEST_CHECK(Session.start(pProfile));
+	TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionPassed);
+	TEST_CHECK(module.sessions == 2 && isProfileWritten(module));
+}
+
+/**
+  * @brief	Module stops acknowledging writes: quit config
+  * 		 mode is sent before SessionFailed, module which
+  * 		 does not quit either is held in reset.
+  */
+static void failedWrite(const OVC3860PSKeyProfile* pProfile){
+	for (int isQuitACK = 1; isQuitACK >= 0; isQuitACK--)
+	{
+		OVC3860LoopbackChannel channel;
+		OVC3860TestModule module(&channel);
+		OVC3860PSKeySession Session{OVC3860Transport(&channel)};
+
+		Session.setResetPulseWidth(SessionTestPulseWidth);
+		module.writeACKLimit = 1;
+		module.sendsQuitACK = isQuitACK;
+		TEST_CHECK(Session.start(pProfile));
+		TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionFailed);
+		TEST_CHECK(Session.getError() == OVC3860PSKeySession::ErrorWrite);
+		TEST_CHECK(Session.getFramesDone() == 1);
+		TEST_CHECK(module.framesCount == 3);
+		TEST_CHECK(module.frames[1].type == 3 && module.frames[2].type == 5);			//quit after not confirmed write
+		TEST_CHECK(module.frames[2].time - module.frames[1].time == OVC3860_PSKeyReplyTimeout + 1);
+		TEST_CHECK(!module.isConfigMode || !channel.isModuleRunning);
+		TEST_CHECK(channel.isModuleRunning == (isQuitACK != 0));
+		TEST_CHECK(Session.getDuration() < SessionTestPulseWidth + 3 * (OVC3860_PSKeyReplyTimeout + 1) + 10);
+
+		//held module is released by next start()
+		module.writeACKLimit = UINT32_MAX;
+		module.sendsQuitACK = true;
+		TEST_CHECK(Session.start(pProfile));
+		TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionPassed);
+		TEST_CHECK(isProfileWritten(module));
+	}
+}
+
+/**
+  * @brief	Module is silent in each step, session ends
+  * 		 with step error after its timeout.
+  */
+static void silentModule(const OVC3860PSKeyProfile* pProfile){
+	OVC3860LoopbackChannel channel;
+	OVC3860TestModule module(&channel);
+	OVC3860PSKeySession Session{OVC3860Transport(&channel)};
+
+	Session.setResetPulseWidth(SessionTestPulseWidth);
+
+	module.sendsWelcome = false;
+	TEST_CHECK(Session.start(pProfile));
+	TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionFailed);
+	TEST_CHECK(Session.getError() == OVC3860PSKeySession::ErrorNoWelcome);
+	TEST_CHECK(Session.getDuration() == SessionTestPulseWidth + OVC3860_ResetReadyTimeout);
+	TEST_CHECK(module.sessions == 0);
+
+	module.sendsWelcome = true;
+	module.sendsConfigACK = false;
+	TEST_CHECK(Session.start(pProfile));
+	TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionFailed);
+	TEST_CHECK(Session.getError() == OVC3860PSKeySession::ErrorNoConfigMode);
+	TEST_CHECK(module.framesCount == 0);
+
+	//all frames written, quit not confirmed: module is held in reset
+	module.sendsConfigACK = true;
+	module.sendsQuitACK = false;
+	TEST_CHECK(Session.start(pProfile));
+	TEST_CHECK(runSession(&Session, &channel) == OVC3860PSKeySession::SessionFailed);
+	TEST_CHECK(Session.getError() == OVC3860PSKeySession::ErrorQuit);
+	TEST_CHECK(Session.getFramesDone() == 4 && isProfileWritten(module));
+	TEST_CHECK(!channel.isModuleRunning);
+}
+
+/**
+  * @brief	Station: seats run interleaved, one bad module
+  * 		 does not stop others, results are counted once.
+  */
+static void station(const OVC3860PSKeyProfile* pProfile){
+	OVC3860LoopbackChannel channel[SessionTestSeats];
+	OVC3860TestModule module0(&channel[0]), module1(&channel[1]), module2(&channel[2]);
+	OVC3860TestModule* module[SessionTestSeats] = {&module0, &module1, &module2};
+	OVC3860PSKeySession Seat0{OVC3860Transport(&channel[0])}, Seat1{OVC3860Transport(&channel[1])}, Seat2{OVC3860Transport(&channel[2])};
+	OVC3860PSKeySession* Seat[SessionTestSeats] = {&Seat0, &Seat1, &Seat2};
+	OVC3860Provisioning Station;
+
+	for (uint8_t i = 0; i < SessionTestSeats; i++)
+	{
+		Seat[i]->setResetPulseWidth(SessionTestPulseWidth);
+		TEST_CHECK(Station.addSeat(Seat[i]));
+	}
+	module2.writeACKLimit = 2;
+
+	TEST_CHECK(Station.getUnitsPerMinuteX100() == 0);
+	TEST_CHECK(Station.startAll(pProfile) == SessionTestSeats);
+	TEST_CHECK(Station.startAll(pProfile) == 0);							//all busy
+	for (uint32_t ms = 0; ms < SessionTestTimeLimit && Station.isBusy(); ms++)
+	{
+		Station.periodicTask();
+		for (uint8_t i = 0; i < SessionTestSeats; i++)
+			channel[i].advanceTime(1);
+	}
+	Station.periodicTask();
+	TEST_CHECK(!Station.isBusy());
+	TEST_CHECK(Station.getPassedUnits() == 2 && Station.getFailedUnits() == 1);
+	TEST_CHECK(Seat2.getError() == OVC3860PSKeySession::ErrorWrite && Seat2.getFramesDone() == 2);
+	TEST_CHECK(isProfileWritten(*module[0]) && isProfileWritten(*module[1]));
+	TEST_CHECK(Seat0.getDuration() == Seat1.getDuration());
+	TEST_CHECK(Station.getUnitsPerMinuteX100() == (uint32_t) ((2ull * 60000 * 100) / (channel[0].time)));
+
+	//next unit in seat 0 only
+	TEST_CHECK(Station.startSeat(0, pProfile));
+	TEST_CHECK(!Station.startSeat(SessionTestSeats, pProfile));
+	while (Station.isBusy())
+	{
+		Station.periodicTask();
+		for (uint8_t i = 0; i < SessionTestSeats; i++)
+			channel[i].advanceTime(1);
+	}
+	Station.periodicTask();
+	TEST_CHECK(Station.getPassedUnits() == 3 && Station.getFailedUnits() == 1);
+	Station.resetStatistics();
+	TEST_CHECK(Station.getPassedUnits() == 0 && Station.getUnitsPerMinuteX100() == 0);
+}
+
+int main(void){
+	OVC3860PSKeyProfile Profile;
+
+	loadProfile(&Profile);
+	passedSession(&Profile);
+	failedWrite(&Profile);
+	silentModule(&Profile);
+	station(&Profile);
+	return TEST_RESULT("OVC3860 PSKey session");
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_RTOSTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860RTOS test on FreeRTOS POSIX port.
+  *          Module task plays OVC3860 role over loopback channel:
+  *          it posts commands, checks that all of them reach the
+  *          module in order, and feeds indications byte by byte
+  *          through receiveFromISR() as UART interrupt would do.
+  *          Bytes which do not fit into stream buffer are counted.
+  *          Built by "make rtos FREERTOS_KERNEL=<path>" only.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#if defined(OVC3860_HOST_TEST) && defined(OVC3860_USE_FREERTOS)
+
+#include "OVC3860_FreeRTOS.h"
+#include "OVC3860_Test.h"
+#include <stdlib.h>
+#include <string.h>
+
+static OVC3860LoopbackChannel	channel;
+static OVC3860 					BT_audio{OVC3860TransportLoopback(&channel)};
+static OVC3860RTOS				BT_rtos(&BT_audio);
+
+#define	CommandBurst	12		//more than OVC3860_TransmitQueueSize, so both queues are used
+
+static size_t moduleReceiveAll(char* pData, size_t maxSize){
+	size_t received = channel.moduleReceive((uint8_t*) pData, maxSize - 1);
+	pData[received] = '\0';
+	return received;
+}
+
+static void moduleIndication(const char* pLine){
+	for (size_t i = 0; pLine[i] != '\0'; i++)
+		BT_rtos.receiveFromISR((uint8_t) pLine[i]);
+}
+
+static void moduleTask(void* pParameters){
+	(void) pParameters;
+	char received[256];
+	char expected[256] = "";
+	uint32_t snapshot;
+
+	//commands posted from other task reach module in order, none is dropped
+	for (int i = 0; i < CommandBurst; i++)
+	{
+		bool isPosted = (i % 2 == 0) ? BT_rtos.postCommand(&OVC3860::musicPreviousTrack, pdMS_TO_TICKS(100))
+									 : BT_rtos.postCommand(&OVC3860::musicNextTrack, pdMS_TO_TICKS(100));
+		TEST_CHECK(isPosted);
+		strcat(expected, (i % 2 == 0) ? "AT#ME\r\n" : "AT#MD\r\n");
+	}
+	TEST_CHECK(BT_rtos.postCommand(&OVC3860::callDialNumber, "5551234", 7, pdMS_TO_TICKS(100)));
+	strcat(expected, "AT#CW5551234\r\n");
+	vTaskDelay(pdMS_TO_TICKS(50));
+	moduleReceiveAll(received, sizeof(received));
+	TEST_CHECK(strcmp(received, expected) == 0);
+	TEST_CHECK(BT_audio.getDroppedCommands() == 0);
+
+	//indication changes published snapshot and triggers A2DP status query
+	while (BT_rtos.waitForStateChange(&snapshot, 0))			//drop snapshots published so far
+		;
+	moduleIndication("IV\r\n");
+	TEST_CHECK(BT_rtos.waitForStateChange(&snapshot, pdMS_TO_TICKS(100)));
+	TEST_CHECK(OVC3860::snapshotState(snapshot, OVC3860::SnapshotHFP) == OVC3860::Connected);
+	vTaskDelay(pdMS_TO_TICKS(50));
+	moduleReceiveAll(received, sizeof(received));
+	TEST_CHECK(strcmp(received, "AT#MV\r\n") == 0);
+
+	//bytes which do not fit into stream buffer are counted, parser task can not run meanwhile
+	TEST_CHECK(BT_rtos.getDroppedBytes() == 0);
+	vTaskSuspendAll();
+	for (int i = 0; i < OVC3860_RTOSStreamBufferSize + 10; i++)
+		BT_rtos.receiveFromISR('x');
+	xTaskResumeAll();
+	TEST_CHECK(BT_rtos.getDroppedBytes() == 10);
+
+	exit(TEST_RESULT("OVC3860RTOS"));
+}
+
+int main(void){
+	if (!BT_rtos.start(tskIDLE_PRIORITY + 1))
+	{
+		printf("OVC3860RTOS: start failed\n");
+		return 1;
+	}
+	xTaskCreate(moduleTask, "module", OVC3860_RTOSStackSize, 0, tskIDLE_PRIORITY + 1, 0);
+	vTaskStartScheduler();
+	return 1;
+}
+
+#endif /* OVC3860_HOST_TEST && OVC3860_USE_FREERTOS */
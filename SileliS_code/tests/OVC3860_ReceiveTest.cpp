@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ReceiveTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860 receive path.
+  *          Lines longer than circular buffer (transport and getData()
+  *          overflow) are dropped up to their '\n' and counted, the
+  *          next line is decoded.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+#define	ReceiveTestJunk			160			//bytes of too long line, > 2x OVC3860_ReceiveBufferSize
+
+static void moduleSendJunk(OVC3860LoopbackChannel* pChannel, size_t length){
+	for (size_t i = 0; i < length; i++)
+		pChannel->moduleSend("x");
+}
+
+static OVC3860::STATES musicState(const OVC3860& BT){
+	return OVC3860::snapshotState(BT.getStateSnapshot(), OVC3860::SnapshotMusic);
+}
+
+/**
+  * @brief	Too long line received by transport.
+  */
+static void longLineTransport(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+
+	//line end arrives with the same receive
+	moduleSendJunk(&channel, ReceiveTestJunk);
+	channel.moduleSend("\r\nMB\r\n");
+	BT_audio.process();
+	TEST_CHECK(musicState(BT_audio) == OVC3860::Playing);
+	TEST_CHECK(BT_audio.getDroppedBytes() == ReceiveTestJunk + 2);
+	TEST_CHECK(channel.toHost.isEmpty());
+
+	//line end arrives later, bytes in between are dropped too
+	moduleSendJunk(&channel, ReceiveTestJunk);
+	BT_audio.process();
+	TEST_CHECK(channel.toHost.isEmpty());
+	moduleSendJunk(&channel, 10);
+	channel.moduleSend("\r\nMA\r\n");
+	BT_audio.process();
+	TEST_CHECK(musicState(BT_audio) == OVC3860::Idle);
+	TEST_CHECK(BT_audio.getDroppedBytes() == 2 * (ReceiveTestJunk + 2) + 10);
+
+	//parser does not get stuck after repeated long lines
+	for (int i = 0; i < 5; i++)
+	{
+		moduleSendJunk(&channel, ReceiveTestJunk);
+		channel.moduleSend("\r\nMB\r\n");
+		BT_audio.process();
+		TEST_CHECK(musicState(BT_audio) == OVC3860::Playing);
+		channel.moduleSend("MA\r\n");
+		BT_audio.decodeReceivedString();
+		TEST_CHECK(musicState(BT_audio) == OVC3860::Idle);
+	}
+	TEST_CHECK(BT_audio.getDroppedBytes() == 7 * (ReceiveTestJunk + 2) + 10);
+}
+
+/**
+  * @brief	Too long line put by getData() (UART interrupt).
+  */
+static void longLineGetData(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	uint8_t junk[ReceiveTestJunk];
+
+	memset(junk, 'x', sizeof(junk));
+	for (size_t i = 0; i < sizeof(junk); i++)
+		BT_audio.getData(junk[i]);
+	BT_audio.decodeReceivedString();
+	BT_audio.getData((const uint8_t*) "xx\r\nMB\r\n", 8);
+	BT_audio.decodeReceivedString();
+	TEST_CHECK(musicState(BT_audio) == OVC3860::Playing);
+	TEST_CHECK(BT_audio.getDroppedBytes() == OVC3860_ReceiveBufferSize + 4);
+
+	//overflow with complete line: buffer is emptied, decoding goes on
+	BT_audio.getData((const uint8_t*) "MA\r\n", 4);
+	BT_audio.getData(junk, sizeof(junk));
+	BT_audio.getData((const uint8_t*) "\r\nMA\r\n", 6);
+	BT_audio.decodeReceivedString();
+	BT_audio.getData((const uint8_t*) "\r\nMA\r\n", 6);
+	BT_audio.decodeReceivedString();
+	TEST_CHECK(musicState(BT_audio) == OVC3860::Idle);
+}
+
+int main(void){
+	longLineTransport();
+	longLineGetData();
+	return TEST_RESULT("OVC3860 receive");
+}
+
+#endif /* OVC3860_HOST_TEST */
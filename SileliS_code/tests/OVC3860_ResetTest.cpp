@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ResetTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of non-blocking module reset.
+  *          Reset line pulse, booting and readiness on IS / WELCOME
+  *          indication or OVC3860_ResetReadyTimeout are driven by
+  *          periodicTask(void) in virtual time of loopback transport.
+  *          Commands queued during reset reach module only after it
+  *          is ready.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+#define	ResetTestPulseWidth		100			//ms, setResetPulseWidth()
+#define	ResetTestBootTime		700			//ms, reset line high -> IS / WELCOME
+
+/**
+  * @brief	Run periodicTask(void) until transmit queue is
+  * 		 empty, compare commands received by module with
+  * 		 expected string.
+  */
+static bool isSent(OVC3860LoopbackChannel* pChannel, OVC3860* pBT, const char* pExpected){
+	char received[64];
+
+	for (int i = 0; i < OVC3860_TransmitQueueSize + 1; i++)
+		pBT->periodicTask();
+	size_t length = pChannel->moduleReceive((uint8_t*) received, sizeof(received) - 1);
+	received[length] = '\0';
+	if (strcmp(received, pExpected) != 0)
+		printf("sent \"%s\", expected \"%s\"\n", received, pExpected);
+	return strcmp(received, pExpected) == 0;
+}
+
+/**
+  * @brief	Pulse, booting, ready on IS, queued commands.
+  */
+static void readyOnIS(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	uint32_t timeLeft;
+
+	BT_audio.setResetPulseWidth(ResetTestPulseWidth);
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetIdle);
+	TEST_CHECK(!BT_audio.getTimeToResetDeadline(&timeLeft));
+
+	BT_audio.startReset();
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetPulse);
+	TEST_CHECK(!channel.isModuleRunning);
+	TEST_CHECK(BT_audio.getTimeToNextDeadline() == ResetTestPulseWidth);
+	BT_audio.musicNextTrack();
+	BT_audio.musicStop();
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	TEST_CHECK(!BT_audio.isWorkPending());								//queued commands can not go out, MCU may sleep until pulse ends
+
+	//pulse ends exactly after reset pulse width
+	channel.advanceTime(ResetTestPulseWidth - 1);
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetPulse);
+	channel.advanceTime(1);
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetBooting);
+	TEST_CHECK(channel.isModuleRunning && channel.resetCount == 1);
+	TEST_CHECK(BT_audio.getTimeToNextDeadline() == OVC3860_ResetReadyTimeout);
+
+	//commands wait while module boots
+	channel.advanceTime(ResetTestBootTime);
+	BT_audio.musicTogglePlayPause();
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	TEST_CHECK(BT_audio.getTimeToResetDeadline(&timeLeft) && timeLeft == OVC3860_ResetReadyTimeout - ResetTestBootTime);
+
+	channel.moduleSend("IS1.0\r\n");
+	BT_audio.decodeReceivedString();
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetReady && BT_audio.isModuleReady());
+	TEST_CHECK(BT_audio.getBootTime() == ResetTestBootTime);
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MD\r\nAT#MC\r\nAT#MA\r\n"));
+	TEST_CHECK(BT_audio.getDroppedCommands() == 0);
+	TEST_CHECK(!BT_audio.getTimeToResetDeadline(&timeLeft));
+}
+
+/**
+  * @brief	WELCOME (HCI Command Complete) sets readiness too,
+  * 		 indication during pulse does not.
+  */
+static void readyOnWelcome(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	static const uint8_t welcome[] = {0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00, '\r', '\n'};
+
+	BT_audio.setResetPulseWidth(ResetTestPulseWidth);
+	BT_audio.startReset();
+	channel.moduleSend(welcome, sizeof(welcome));				//stale indication received before reset
+	BT_audio.decodeReceivedString();
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetPulse);
+
+	channel.advanceTime(ResetTestPulseWidth);
+	BT_audio.periodicTask();
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetBooting);
+	BT_audio.musicNextTrack();
+	channel.advanceTime(ResetTestBootTime);
+	channel.moduleSend(welcome, sizeof(welcome));
+	BT_audio.decodeReceivedString();
+	TEST_CHECK(BT_audio.isModuleReady());
+	TEST_CHECK(BT_audio.getBootTime() == ResetTestBootTime);
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MD\r\n"));
+}
+
+/**
+  * @brief	Silent module: commands are released after
+  * 		 OVC3860_ResetReadyTimeout.
+  */
+static void readyTimeout(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+
+	BT_audio.setResetPulseWidth(ResetTestPulseWidth);
+	BT_audio.startReset();
+	channel.advanceTime(ResetTestPulseWidth);
+	BT_audio.periodicTask();
+	BT_audio.musicNextTrack();
+
+	channel.advanceTime(OVC3860_ResetReadyTimeout - 1);
+	TEST_CHECK(isSent(&channel, &BT_audio, ""));
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetBooting);
+	TEST_CHECK(BT_audio.getTimeToNextDeadline() == 1);
+	channel.advanceTime(1);
+	TEST_CHECK(isSent(&channel, &BT_audio, "AT#MD\r\n"));
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetTimeout && !BT_audio.isModuleReady());
+
+	//late IS still reports readiness
+	channel.moduleSend("IS1.0\r\n");
+	BT_audio.decodeReceivedString();
+	TEST_CHECK(BT_audio.isModuleReady());
+}
+
+/**
+  * @brief	Blocking resetModule() waits only for reset pulse.
+  */
+static void blockingReset(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+
+	BT_audio.setResetPulseWidth(ResetTestPulseWidth);
+	uint32_t start = channel.time;
+	BT_audio.resetModule();
+	TEST_CHECK(channel.time - start == ResetTestPulseWidth);
+	TEST_CHECK(BT_audio.getResetPhase() == OVC3860HardWare::ResetBooting);
+	TEST_CHECK(channel.isModuleRunning && channel.resetCount == 1);
+}
+
+int main(void){
+	readyOnIS();
+	readyOnWelcome();
+	readyTimeout();
+	blockingReset();
+	return TEST_RESULT("OVC3860 reset");
+}
+
+#endif /* OVC3860_HOST_TEST */
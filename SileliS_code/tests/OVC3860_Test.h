@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_Test.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Minimal check macros of host tests (tests/Makefile).
+  *          Each test is separate program, it prints failed checks
+  *          and returns number of failures from main().
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_TEST_H_
+#define OVC3860_TEST_H_
+
+#include <stdio.h>
+
+static int testChecks = 0;
+static int testFailures = 0;
+
+#define	TEST_CHECK(condition)																\
+	do {																					\
+		testChecks++;																		\
+		if (!(condition))																	\
+		{																					\
+			testFailures++;																	\
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);			\
+		}																					\
+	} while (0)
+
+#define	TEST_RESULT(name)																	\
+	(printf("%s: %d checks, %d failed\n", name, testChecks, testFailures), testFailures != 0)
+
+#endif /* OVC3860_TEST_H_ */
@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TestModule.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Simulated OVC3860 PSKey mode of host tests.
+  *          Module is handler of OVC3860LoopbackChannel, so it answers
+  *          blocking OVC3860PSKey calls and non-blocking
+  *          OVC3860PSKeySession in the same way: welcome message after
+  *          reset, enterConfig ACK, read / write / quit frames on
+  *          memory image. Received frames are logged and answers can
+  *          be switched off to test timeouts.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef OVC3860_TESTMODULE_H_
+#define OVC3860_TESTMODULE_H_
+
+#include "OVC3860_Transport.h"
+#include "OVC3860PSKey.h"
+#include <string.h>
+
+#define	TestModuleMemorySize		0x1000		//12 bit PSKey address
+#define	TestModuleMaxFrames			64			//logged frames
+
+
+class OVC3860TestModule{
+public:
+	struct frame{
+		uint8_t		type;				//1 read, 3 write, 5 quit
+		uint16_t	address;
+		uint16_t	length;
+		uint32_t	time;				//channel time when frame was complete
+	};
+
+	OVC3860TestModule(OVC3860LoopbackChannel* pChannel);
+
+	void 		clearLog(void);
+	static void handler(OVC3860LoopbackChannel* pChannel, void* pContext);
+
+	uint8_t		memory[TestModuleMemorySize];
+	frame		frames[TestModuleMaxFrames];
+	uint32_t	framesCount = 0;
+	uint32_t	resets = 0;				//resets seen by module
+	uint32_t	sessions = 0;			//enterConfig messages accepted
+	bool		isConfigMode = false;
+
+	bool		sendsWelcome = true;
+	bool		sendsConfigACK = true;
+	uint32_t	writeACKLimit = UINT32_MAX;	//write frames stored and acknowledged in one session, next are silent
+	bool		sendsQuitACK = true;
+
+private:
+	void 		service(void);
+	void 		logFrame(uint8_t type, uint16_t address, uint16_t length);
+
+	OVC3860LoopbackChannel*	pLoopbackChannel;
+	uint8_t		input[OVC3860_PSKeyHeaderLength + OVC3860_PSKeyMaxPayload];
+	size_t		inputLength = 0;
+	uint32_t	writesInSession = 0;
+};
+
+inline OVC3860TestModule::OVC3860TestModule(OVC3860LoopbackChannel* pChannel){
+	pLoopbackChannel = pChannel;
+	memset(memory, 0, sizeof(memory));
+	pChannel->handler = &OVC3860TestModule::handler;
+	pChannel->pHandlerContext = this;
+}
+
+inline void OVC3860TestModule::clearLog(void){
+	framesCount = 0;
+}
+
+inline void OVC3860TestModule::handler(OVC3860LoopbackChannel* /*pChannel*/, void* pContext){
+	((OVC3860TestModule*) pContext)->service();
+}
+
+inline void OVC3860TestModule::logFrame(uint8_t type, uint16_t address, uint16_t length){
+	if (framesCount < TestModuleMaxFrames)
+		frames[framesCount] = frame{type, address, length, pLoopbackChannel->time};
+	framesCount++;
+}
+
+/**
+  * @brief	Consume bytes sent by OVC3860 object, answer
+  * 		 complete commands.
+  */
+inline void OVC3860TestModule::service(void){
+	static const uint8_t welcome[7] 		= {0x04, 0x0F, 0x04, 0x00, 0x01, 0x00, 0x00};
+	static const uint8_t enterConfig[9] 	= {0xC5, 0xC7, 0xC7, 0xC9, 0xD0, 0xD7, 0xC9, 0xD1, 0xCD};
+	static const uint8_t enterConfigACK[7]	= {0x04, 0x0F, 0x04, 0x01, 0x01, 0x00, 0x00};
+
+	if (!pLoopbackChannel->isModuleRunning)
+	{
+		pLoopbackChannel->toModule.resetCircularBuffer();			//module in reset does not receive
+		return;
+	}
+	if (pLoopbackChannel->resetCount != resets)
+	{
+		resets = pLoopbackChannel->resetCount;
+		isConfigMode = false;
+		inputLength = 0;
+		writesInSession = 0;
+		if (sendsWelcome)
+			pLoopbackChannel->moduleSend(welcome, sizeof(welcome));
+	}
+
+	while (!pLoopbackChannel->toModule.isEmpty() && inputLength < sizeof(input))
+	{
+		input[inputLength++] = pLoopbackChannel->toModule.get();
+		if (!isConfigMode)
+		{
+			if (inputLength < sizeof(enterConfig))
+				continue;
+			if (memcmp(input, enterConfig, sizeof(enterConfig)) == 0)
+			{
+				isConfigMode = true;
+				sessions++;
+				if (sendsConfigACK)
+					pLoopbackChannel->moduleSend(enterConfigACK, sizeof(enterConfigACK));
+			}
+			inputLength = 0;										//normal mode commands are not simulated
+			continue;
+		}
+		if (inputLength < OVC3860_PSKeyHeaderLength)
+			continue;
+
+		uint8_t type = input[0] >> 4;
+		uint16_t address = (uint16_t) (((input[0] & 0x0F) << 8) | input[1]);
+		uint16_t length = (uint16_t) ((input[2] << 8) | input[3]);
+		if (type == 3 && inputLength < (size_t) (OVC3860_PSKeyHeaderLength + length) && length <= OVC3860_PSKeyMaxPayload)
+			continue;												//write payload follows
+		if (address + length > TestModuleMemorySize || length > OVC3860_PSKeyMaxPayload)
+			length = 0;
+
+		uint8_t answer[OVC3860_PSKeyHeaderLength] = {(uint8_t) (input[0] + 0x10), input[1], input[2], input[3]};
+		logFrame(type, address, length);
+		inputLength = 0;
+		if (type == 1)
+		{
+			pLoopbackChannel->moduleSend(answer, sizeof(answer));
+			pLoopbackChannel->moduleSend(&memory[address], length);
+		}
+		else if (type == 3)
+		{
+			if (writesInSession++ < writeACKLimit)
+			{
+				memcpy(&memory[address], &input[OVC3860_PSKeyHeaderLength], length);
+				pLoopbackChannel->moduleSend(answer, sizeof(answer));
+			}
+		}
+		else if (type == 5)
+		{
+			isConfigMode = false;
+			if (sendsQuitACK)
+				pLoopbackChannel->moduleSend(answer, sizeof(answer));
+		}
+	}
+}
+
+#endif /* OVC3860_TESTMODULE_H_ */
@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_TransitionTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of OVC3860 indication decoding.
+  *          Recorded UART log is replayed over loopback transport line
+  *          by line, state snapshot and return value of
+  *          decodeReceivedString() after each line are compared with
+  *          expected sequence. Expected values were recorded with
+  *          switch based decoder which preceded responseTransitions
+  *          table (with NOEP / NUM fallthrough fixed).
+  *          SPP indications (SC / SD) are at the end of the log and
+  *          only in OVC3860_FEATURE_SPP build, so the other lines have
+  *          the same expected values in every feature configuration
+  *          (make configs).
+  *          Indications are recognized only at line start, MM / MN /
+  *          MW parameters which contain other pattern are checked in
+  *          ConfigCache.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+struct recordedLine{
+	const char*	pLine;					//without "\r\n"
+	uint32_t	snapshot;				//OVC3860::getStateSnapshot() after line
+	uint8_t		retVal;					//OVC3860::decodeReceivedString()
+};
+
+static const recordedLine uartLog[] = {
+	{"IS1.2.3",       0x00210000, 1},
+	{"II",            0x00410002, 1},
+	{"IA",            0x00410002, 1},
+	{"IV",            0x0061001A, 1},
+	{"MG1",           0x0081000A, 1},
+	{"MG3",           0x00A1001A, 1},
+	{"ML1",           0x00C1021A, 1},
+	{"ML3",           0x00E1061A, 1},
+	{"MB",            0x0101661A, 1},
+	{"MA",            0x0121261A, 1},
+	{"MU1",           0x0141265A, 1},
+	{"MU3",           0x016126DA, 1},
+	{"IR5551234",     0x01810EDA, 1},
+	{"NUM5551234",    0x01A116DA, 1},
+	{"ID",            0x01A116DA, 1},
+	{"IF",            0x01C126DA, 1},
+	{"IC",            0x01E11EDA, 1},
+	{"MR",            0x02015EDA, 1},
+	{"MP",            0x02211EDA, 1},
+	{"MU8",           0x02211EDA, 1},
+	{"MG9",           0x02211EDA, 1},
+	{"NOEP",          0x02211EDA, 0},
+	{"AX_PA",         0x02211EDA, 1},
+	{"EPER",          0x02211EDA, 0},
+	{"MEM:3F",        0x02211EDA, 1},
+	{"VOL12",         0x02211EDA, 1},
+	{"IJ2",           0x02411EDB, 1},
+	{"ERR",           0x02411EDB, 0},
+	{"OK",            0x02411EDB, 1},
+	{"M0",            0x02611ED8, 1},
+	{"M1",            0x02811ED9, 1},
+	{"M2",            0x02A116D9, 1},
+	{"M3",            0x02C10ED9, 1},
+	{"M4",            0x02E11ED9, 1},
+	{"MF01",          0x02E11ED9, 1},
+	{"MF10",          0x02E11ED9, 1},
+	{"MY",            0x02E11ED9, 1},
+	{"MX",            0x03019ED9, 1},
+	{"IG",            0x03019ED9, 1},
+	{"IL",            0x03019ED9, 1},
+	{"IM",            0x03019ED9, 1},
+	{"IN",            0x0321A6D9, 1},
+	{"IP5",           0x03419ED9, 1},
+	{"IT",            0x03419ED9, 1},
+	{"MC",            0x03419ED9, 1},
+	{"MD",            0x03419ED9, 1},
+	{"ME",            0x03419ED9, 1},
+	{"MMmyname",      0x03419ED9, 1},
+	{"MN1234",        0x03419ED9, 1},
+	{"MWv9",          0x03419ED9, 1},
+	{"MS",            0x0361DED9, 1},
+	{"PA1",           0x0361DED9, 1},
+	{"PB",            0x0361DED9, 1},
+	{"PC",            0x0361DED9, 1},
+	{"PE",            0x0361DED9, 1},
+	{"PF",            0x0361DED9, 1},
+	{"SW",            0x0361DED9, 1},
+	{"XYZ",           0x0361DED9, 1},
+	{"AE",            0x0385DED9, 1},
+	{"AF",            0x03A1DED9, 1},
+	{"AS",            0x03D9DED9, 1},
+	{"ML7",           0x03D9DED9, 1},
+	{"MG2",           0x03F9DED1, 1},
+	{"MG4",           0x0419DEE1, 1},
+	{"MG5",           0x0439DEE9, 1},
+	{"MG6",           0x0459DEF1, 1},
+	{"ML2",           0x0479DCF1, 1},
+	{"MU2",           0x0499DCB1, 1},
+	{"MU4",           0x04B9DD31, 1},
+	{"MU5",           0x04D9DD71, 1},
+	{"IA",            0x04F9DD41, 1},
+	{"IV",            0x0519DD59, 1},
+	{"MA",            0x05392559, 1},
+#if OVC3860_FEATURE_SPP						//stripped indications are not decoded at all, keep them last
+	{"SC",            0x0559255C, 1},
+	{"SD",            0x0579255D, 1},
+#endif /* OVC3860_FEATURE_SPP */
+};
+
+int main(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+
+	for (size_t i = 0; i < sizeof(uartLog) / sizeof(uartLog[0]); i++)
+	{
+		uint32_t previous = BT_audio.getStateSnapshot();
+		channel.moduleSend(uartLog[i].pLine);
+		channel.moduleSend("\r\n");
+		uint8_t retVal = BT_audio.decodeReceivedString();
+
+		uint32_t snapshot = BT_audio.getStateSnapshot();
+		if (snapshot != uartLog[i].snapshot || retVal != uartLog[i].retVal)
+			printf("line %u \"%s\": snapshot 0x%08X, expected 0x%08X, retVal %u, expected %u\n", (unsigned) i, uartLog[i].pLine,
+					(unsigned) snapshot, (unsigned) uartLog[i].snapshot, retVal, uartLog[i].retVal);
+		TEST_CHECK(snapshot == uartLog[i].snapshot);
+		TEST_CHECK(retVal == uartLog[i].retVal);
+
+		if (strcmp(uartLog[i].pLine, "NOEP") == 0)			//"no eeprom" used to fall through into NUM (incoming call)
+	{
+			TEST_CHECK(snapshot == previous);
+			TEST_CHECK(OVC3860::snapshotState(snapshot, OVC3860::SnapshotCall) != OVC3860::IncomingCall);
+		}
+	}
+	TEST_CHECK(channel.toHost.isEmpty());
+
+	//indication is recognized only at line start, parameters which contain other pattern are cached
+	static const struct {
+		const char*	pLine;
+		const char*	pName;
+		const char*	pPin;
+		const char*	pVersion;
+	} parameterLines[] = {
+		{"MMCar Kit",	"Car Kit",	"1234",	"v9"},			//"MC" inside
+		{"MMBT",		"BT",		"1234",	"v9"},			//"MB" inside
+		{"MN0000",		"BT",		"0000",	"v9"},
+		{"MWV1.IS2",	"BT",		"0000",	"V1.IS2"},		//"IS" inside
+		{"xxMB",		"BT",		"0000",	"V1.IS2"},		//not at line start, ignored
+	};
+	for (size_t i = 0; i < sizeof(parameterLines) / sizeof(parameterLines[0]); i++)
+	{
+		uint32_t previous = BT_audio.getStateSnapshot();
+		channel.moduleSend(parameterLines[i].pLine);
+		channel.moduleSend("\r\n");
+		TEST_CHECK(BT_audio.decodeReceivedString() == 1);
+		TEST_CHECK(BT_audio.getStateSnapshot() == previous);
+		TEST_CHECK(strcmp(BT_audio.ConfigCache.getName(), parameterLines[i].pName) == 0);
+		TEST_CHECK(strcmp(BT_audio.ConfigCache.getPin(), parameterLines[i].pPin) == 0);
+		TEST_CHECK(strcmp(BT_audio.ConfigCache.getVersion(), parameterLines[i].pVersion) == 0);
+	}
+	TEST_CHECK(channel.toHost.isEmpty() && BT_audio.getStateSnapshot() == uartLog[sizeof(uartLog) / sizeof(uartLog[0]) - 1].snapshot);
+
+	return TEST_RESULT("OVC3860 transitions");
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_VolumeTest.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   Host test of setVolume() / OVC3860VolumeControl.
+  *          #VU / #VD steps are sent within OVC3860_VolumeWindow,
+  *          direction is reversed only after sent steps are
+  *          confirmed by VOL<xx>, not confirmed steps are forgotten
+  *          after OVC3860_VolumeReplyTimeout (virtual time of
+  *          loopback transport). Step dropped by full transmit
+  *          queue is sent again.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TEST
+
+#include "OVC3860_device.h"
+#include "OVC3860_Test.h"
+#include <string.h>
+
+#define	VolumeTestPulseWidth		100			//ms, setResetPulseWidth()
+
+/**
+  * @brief	Compare commands received by module since the
+  * 		 last call with expected string.
+  */
+static bool isSent(OVC3860LoopbackChannel* pChannel, const char* pExpected){
+	char received[128];
+
+	size_t length = pChannel->moduleReceive((uint8_t*) received, sizeof(received) - 1);
+	received[length] = '\0';
+	if (strcmp(received, pExpected) != 0)
+		printf("sent \"%s\", expected \"%s\"\n", received, pExpected);
+	return strcmp(received, pExpected) == 0;
+}
+
+static void moduleReportsVolume(OVC3860LoopbackChannel* pChannel, OVC3860* pBT, const char* pLine){
+	pChannel->moduleSend(pLine);
+	pBT->process();
+}
+
+/**
+  * @brief	Unknown level, window, direction reversal.
+  */
+static void windowAndReversal(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	const OVC3860VolumeControl& Volume = BT_audio.VolumeControl;
+
+	//level is unknown, one step in target direction learns it
+	BT_audio.setVolume(10);
+	TEST_CHECK(isSent(&channel, "AT#VU\r\n"));
+	BT_audio.periodicTask();
+	TEST_CHECK(isSent(&channel, ""));
+	moduleReportsVolume(&channel, &BT_audio, "VOLab\r\n");			//not a level
+	TEST_CHECK(!Volume.isLevelKnown());
+	TEST_CHECK(isSent(&channel, ""));
+
+	//max. OVC3860_VolumeWindow steps wait for VOL<xx>
+	moduleReportsVolume(&channel, &BT_audio, "VOL05\r\n");
+	TEST_CHECK(Volume.isLevelKnown() && Volume.getLevel() == 5);
+	TEST_CHECK(isSent(&channel, "AT#VU\r\nAT#VU\r\nAT#VU\r\n"));
+	BT_audio.periodicTask();
+	TEST_CHECK(isSent(&channel, ""));
+	moduleReportsVolume(&channel, &BT_audio, "VOL06\r\n");
+	TEST_CHECK(isSent(&channel, "AT#VU\r\n"));
+
+	//new target in opposite direction waits for sent steps
+	BT_audio.setVolume(3);
+	TEST_CHECK(isSent(&channel, ""));
+	moduleReportsVolume(&channel, &BT_audio, "VOL07\r\n");
+	moduleReportsVolume(&channel, &BT_audio, "VOL08\r\n");
+	TEST_CHECK(isSent(&channel, ""));
+	moduleReportsVolume(&channel, &BT_audio, "VOL09\r\n");
+	TEST_CHECK(isSent(&channel, "AT#VD\r\nAT#VD\r\nAT#VD\r\n"));
+	moduleReportsVolume(&channel, &BT_audio, "VOL08\r\n");
+	TEST_CHECK(isSent(&channel, "AT#VD\r\n"));
+	moduleReportsVolume(&channel, &BT_audio, "VOL07\r\nVOL06\r\nVOL05\r\n");
+	TEST_CHECK(isSent(&channel, "AT#VD\r\nAT#VD\r\n"));
+	TEST_CHECK(!Volume.isTargetReached());
+	moduleReportsVolume(&channel, &BT_audio, "VOL04\r\nVOL03\r\n");
+	TEST_CHECK(Volume.isTargetReached() && Volume.getLevel() == 3);
+	TEST_CHECK(isSent(&channel, ""));
+	TEST_CHECK(Volume.getSentCommands() == 11);
+
+	//level set by module buttons is brought back to target, out of range values are limited
+	moduleReportsVolume(&channel, &BT_audio, "VOL20\r\n");
+	TEST_CHECK(Volume.getLevel() == OVC3860_VolumeMax);
+	TEST_CHECK(isSent(&channel, "AT#VD\r\nAT#VD\r\nAT#VD\r\n"));
+	BT_audio.setVolume(OVC3860_VolumeMax + 5);
+	TEST_CHECK(Volume.getTarget() == OVC3860_VolumeMax);
+	TEST_CHECK(isSent(&channel, ""));
+}
+
+/**
+  * @brief	Steps not confirmed within OVC3860_VolumeReplyTimeout
+  * 		 are forgotten, target is reached from reported level.
+  */
+static void replyTimeout(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	const OVC3860VolumeControl& Volume = BT_audio.VolumeControl;
+
+	moduleReportsVolume(&channel, &BT_audio, "VOL05\r\n");
+	TEST_CHECK(isSent(&channel, ""));									//no target, nothing to do
+	BT_audio.setVolume(9);
+	TEST_CHECK(isSent(&channel, "AT#VU\r\nAT#VU\r\nAT#VU\r\n"));
+
+	channel.advanceTime(OVC3860_VolumeReplyTimeout);
+	BT_audio.periodicTask();
+	TEST_CHECK(isSent(&channel, ""));
+	TEST_CHECK(BT_audio.getTimeToNextDeadline() == 1);
+	channel.advanceTime(1);
+	BT_audio.periodicTask();
+	TEST_CHECK(isSent(&channel, "AT#VU\r\nAT#VU\r\nAT#VU\r\n"));
+
+	//confirmation restarts timeout
+	channel.advanceTime(OVC3860_VolumeReplyTimeout);
+	moduleReportsVolume(&channel, &BT_audio, "VOL06\r\n");
+	TEST_CHECK(isSent(&channel, "AT#VU\r\n"));
+	channel.advanceTime(OVC3860_VolumeReplyTimeout);
+	BT_audio.periodicTask();
+	TEST_CHECK(isSent(&channel, ""));
+	moduleReportsVolume(&channel, &BT_audio, "VOL07\r\nVOL08\r\nVOL09\r\n");
+	TEST_CHECK(Volume.isTargetReached());
+	uint32_t timeLeft;
+	TEST_CHECK(!Volume.getTimeToTimeout(channel.time, &timeLeft));
+}
+
+/**
+  * @brief	Step dropped by full transmit queue does not wait
+  * 		 for VOL<xx>, it is sent when queue has space.
+  */
+static void fullTransmitQueue(void){
+	OVC3860LoopbackChannel channel;
+	OVC3860 BT_audio{OVC3860TransportLoopback(&channel)};
+	const OVC3860VolumeControl& Volume = BT_audio.VolumeControl;
+	uint32_t timeLeft;
+
+	moduleReportsVolume(&channel, &BT_audio, "VOL05\r\n");
+	BT_audio.setResetPulseWidth(VolumeTestPulseWidth);
+	BT_audio.startReset();												//commands wait in transmit queue
+	for (int i = 0; i < OVC3860_TransmitQueueSize; i++)
+		BT_audio.musicNextTrack();
+	BT_audio.setVolume(7);
+	TEST_CHECK(BT_audio.getDroppedCommands() == 1);
+	TEST_CHECK(Volume.getSentCommands() == 0);
+	TEST_CHECK(!Volume.getTimeToTimeout(channel.time, &timeLeft));
+
+	//module does not report readiness, queue is released after timeout
+	channel.advanceTime(VolumeTestPulseWidth);
+	BT_audio.periodicTask();
+	channel.advanceTime(OVC3860_ResetReadyTimeout);
+	for (int i = 0; i < 2 * OVC3860_TransmitQueueSize; i++)
+		BT_audio.periodicTask();
+	TEST_CHECK(isSent(&channel, "AT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\nAT#MD\r\n"
+								"AT#VU\r\nAT#VU\r\n"));
+	TEST_CHECK(Volume.getSentCommands() == 2);
+	moduleReportsVolume(&channel, &BT_audio, "VOL06\r\nVOL07\r\n");
+	TEST_CHECK(Volume.isTargetReached());
+	TEST_CHECK(isSent(&channel, ""));
+}
+
+int main(void){
+	windowAndReversal();
+	replyTimeout();
+	fullTransmitQueue();
+	return TEST_RESULT("OVC3860 volume");
+}
+
+#endif /* OVC3860_HOST_TEST */
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOSConfig.h
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   FreeRTOS configuration of OVC3860RTOS host test.
+  *          Kernel runs on FreeRTOS POSIX port (Linux, pthreads), see
+  *          rtos target in tests/Makefile.
+  *          Scheduler is cooperative, so tasks switch only when they
+  *          block and loopback channel needs no locking.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION					0
+#define configUSE_IDLE_HOOK						0
+#define configUSE_TICK_HOOK						0
+#define configUSE_MALLOC_FAILED_HOOK			0
+#define configCHECK_FOR_STACK_OVERFLOW			0
+#define configTICK_RATE_HZ						1000
+#define configMAX_PRIORITIES					7
+#define configMINIMAL_STACK_SIZE				4096		//words, POSIX port runs each task in pthread
+#define configTOTAL_HEAP_SIZE					65536		//not used with heap_3.c (malloc)
+#define configMAX_TASK_NAME_LEN					16
+#define configUSE_16_BIT_TICKS					0
+#define configUSE_TASK_NOTIFICATIONS			1
+#define configUSE_MUTEXES						1
+#define configUSE_TIMERS						0
+#define configSUPPORT_DYNAMIC_ALLOCATION		1
+#define configSUPPORT_STATIC_ALLOCATION			0
+
+#define INCLUDE_vTaskDelete						1
+#define INCLUDE_vTaskDelay						1
+#define INCLUDE_xTaskGetSchedulerState			1
+
+#define configASSERT(x)							assert(x)
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,472 @@
+/**
+  ******************************************************************************
+  * @file    OVC3860_ProfileCompiler.cpp
+  * @author  Dawid "SileliS" Bańkowski	d.bankowski(at)gmail.com
+  * @brief   OVC3860 PSKey profile compiler (host tool).
+  *          This file provides command line tool which builds binary
+  *          PSKey profile (OVC3860_PSKeyProfile.h) from
+  *          datasheets/OVC3860_memmap.txt and overrides file.
+  *          It is not part of target firmware, whole file is compiled
+  *          only with OVC3860_HOST_TOOL defined:
+  *
+  *          g++ -std=gnu++14 -DOVC3860_HOST_TOOL -DOVC3860_TRANSPORT_POSIX -I..
+  *              OVC3860_ProfileCompiler.cpp ../OVC3860*.cpp -o ovc3860_profile
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 Dawid Bańkowski.
+  * All rights reserved.</center></h2>
+  *
+  *For education and private projects:
+  * This software component is licensed by GNU Public Licence, * the "License" *;
+  * You to copy this scope of file to give informations about copyright to future
+  * commercial / open source projects.
+  *
+  *To use this library for commercial and open source projects please contact with
+  *To  author to agree the terms of use.
+  ******************************************************************************
+*/
+
+#ifdef OVC3860_HOST_TOOL
+
+#include "OVC3860_PSKeyProfile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/*
+ * Usage:
+ *  ovc3860_profile <memmap.txt> <profile.bin> [-o overrides.txt] [-a] [-v version]
+ *  ovc3860_profile -d <profile.bin>
+ *
+ *  -o	overrides, one PSKey per line: <name or 0xADDR> <value>, '#' starts comment
+ *  		i.e.:	localname		"CAR KIT"
+ *  				pincode			1234
+ *  				uart_baudrate	115200
+ *  				0x24			0x24 0x04 0x14
+ *  -a	all PSKeys of memmap (factory defaults + overrides), without -a
+ *  		only overrides are in profile. Identity and pairing PSKeys
+ *  		(local_bdaddr, tester_addr, keyTable, last_device,
+ *  		last_device_profile) are not taken from memmap, one profile
+ *  		written to many modules would give them the same address and
+ *  		pairings of memmap module. They are in profile only when set
+ *  		in overrides.
+ *  -v	profile version, written to profile header
+ *  -d	check profile and print its runs
+ *
+ * Values (memmap and overrides):
+ *  0x12 0x34 ...	bytes, their number has to be equal to PSKey length
+ *  0x1234			number, written MSB first (as in memmap), left padded with 0x00
+ *  True / False	0x01 / 0x00
+ *  115200			baudrate for uart_baudrate (OVC3860_BAUDRATE_xxx code)
+ *  text / "text"	ASCII, padded with '\0' to PSKey length
+ *
+ * PSKey length is distance to the next address in memmap, lines without
+ *  address (sbc_size / sbc_des) follow previous PSKey.
+ */
+
+struct psKeyEntry{
+	std::string				name;			//item and labels joined with '.', i.e. "tone_conf[10].cnt"
+	int						address;		//-1 - not given in memmap line
+	std::vector<std::string>	value;		//value tokens
+	size_t					length;
+	int						line;
+};
+
+/*
+ * PSKeys which are different in each module, [from, to) addresses.
+ */
+static const struct{
+	int		from;
+	int		to;
+} deviceSpecificKeys[] = {
+	{PSkeys_local_bdaddr, PSkeys_local_bdaddr + 6},
+	{PSkeys_tester_addr, PSkeys_tester_addr + 6},
+	{PSkeys_keyTable_00__valid, PSkeys_last_device_profile + 1},		//keyTable[00..07], last_device, last_device_profile
+};
+
+static bool isDeviceSpecific(const psKeyEntry& entry){
+	for (size_t i = 0; i < sizeof(deviceSpecificKeys) / sizeof(deviceSpecificKeys[0]); i++)
+		if (entry.address < deviceSpecificKeys[i].to && deviceSpecificKeys[i].from < entry.address + (int) entry.length)
+			return true;
+	return false;
+}
+
+static bool isHexToken(const std::string& token){
+	if (token.size() < 3 || token[0] != '0' || (token[1] != 'x' && token[1] != 'X'))
+		return false;
+	for (size_t i = 2; i < token.size(); i++)
+		if (!isxdigit((unsigned char) token[i]))
+			return false;
+	return true;
+}
+
+static std::vector<std::string> splitTokens(const std::string& text){
+	std::vector<std::string> tokens;
+	size_t i = 0;
+
+	while (i < text.size())
+	{
+		while (i < text.size() && isspace((unsigned char) text[i]))
+			i++;
+		if (i >= text.size())
+			break;
+		size_t start = i;
+		if (text[i] == '"')
+		{
+			size_t end = text.find('"', i + 1);
+			end = (end == std::string::npos) ? text.size() : end + 1;
+			tokens.push_back(text.substr(start, end - start));
+			i = end;
+			continue;
+		}
+		while (i < text.size() && !isspace((unsigned char) text[i]))
+			i++;
+		tokens.push_back(text.substr(start, i - start));
+	}
+	return tokens;
+}
+
+/**
+  * @brief	Length of value written in memmap / overrides.
+  * @retval	0 - unknown value
+  */
+static size_t naturalLength(const std::vector<std::string>& value){
+	if (value.empty())
+		return 0;
+	if (value.size() > 1)
+		return value.size();
+	const std::string& token = value[0];
+	if (isHexToken(token))
+		return (token.size() - 1) / 2;
+	if (token == "True" || token == "False")
+		return 1;
+	if (token[0] == '"')
+		return token.size() - 2;
+	return token.size();
+}
+
+/**
+  * @brief	Convert value tokens to PSKey bytes.
+  *
+  * @param	entry - PSKey (name, length)
+  * @param	value - tokens
+  * @param	pBytes - entry.length bytes
+  * @retval	false - value does not fit / is not valid
+  */
+static bool encodeValue(const psKeyEntry& entry, const std::vector<std::string>& value, std::vector<uint8_t>* pBytes){
+	static const unsigned long baudrates[] = {1200, 2400, 4800, 9600, 14400, 19200, 38400, 57600, 115200, 230400, 460800, 921600};
+
+	pBytes->assign(entry.length, 0);
+	if (value.empty())
+		return false;
+	if (value.size() > 1)								//byte list
+	{
+		if (value.size() != entry.length)
+			return false;
+		for (size_t i = 0; i < value.size(); i++)
+		{
+			if (!isHexToken(value[i]) || value[i].size() > 4)
+				return false;
+			(*pBytes)[i] = (uint8_t) strtoul(value[i].c_str(), 0, 16);
+		}
+		return true;
+	}
+
+	const std::string& token = value[0];
+	if (isHexToken(token))								//number, MSB first
+	{
+		std::string digits = token.substr(2);
+		if (digits.size() % 2)
+			digits = "0" + digits;
+		size_t length = digits.size() / 2;
+		while (length > entry.length && digits.compare(0, 2, "00") == 0)
+		{
+			digits.erase(0, 2);
+			length--;
+		}
+		if (length > entry.length)
+			return false;
+		for (size_t i = 0; i < length; i++)
+			(*pBytes)[entry.length - length + i] = (uint8_t) strtoul(digits.substr(i * 2, 2).c_str(), 0, 16);
+		return true;
+	}
+	if (token == "True" || token == "False")
+	{
+		(*pBytes)[entry.length - 1] = (token == "True");
+		return true;
+	}
+	if (entry.name == "uart_baudrate")
+	{
+		for (size_t i = 0; i < sizeof(baudrates) / sizeof(baudrates[0]); i++)
+			if (strtoul(token.c_str(), 0, 10) == baudrates[i])
+			{
+				(*pBytes)[0] = (uint8_t) (OVC3860_BAUDRATE_1200 + i);
+				return true;
+			}
+		return false;
+	}
+	std::string text = (token[0] == '"') ? token.substr(1, token.size() - 2) : token;
+	if (text.size() > entry.length)
+		return false;
+	memcpy(pBytes->data(), text.data(), text.size());
+	return true;
+}
+
+/**
+  * @brief	Read datasheets/OVC3860_memmap.txt.
+  * @retval	false - file could not be opened
+  */
+static bool readMemmap(const char* pPath, std::vector<psKeyEntry>* pEntries){
+	FILE* pFile = fopen(pPath, "r");
+	char line[512];
+	int lineNumber = 0;
+
+	if (pFile == 0)
+		return false;
+	while (fgets(line, sizeof(line), pFile))
+	{
+		lineNumber++;
+		std::string text = line;
+		size_t comment = text.find("//");
+		if (comment != std::string::npos)
+			text.erase(comment);
+		std::vector<std::string> tokens = splitTokens(text);
+		if (tokens.size() < 3 || !isdigit((unsigned char) tokens[0][0]))
+			continue;									//header, separators
+
+		psKeyEntry entry;
+		size_t first = 1;
+		entry.address = -1;
+		entry.line = lineNumber;
+		if (isHexToken(tokens[1]))
+		{
+			entry.address = (int) strtoul(tokens[1].c_str(), 0, 16);
+			first = 2;
+		}
+		size_t valueStart = tokens.size();
+		while (valueStart > first + 1 && isHexToken(tokens[valueStart - 1]))
+			valueStart--;
+		if (valueStart == tokens.size())
+			valueStart = tokens.size() - 1;				//text, True / False, decimal
+		for (size_t i = first; i < valueStart; i++)
+		{
+			std::string label = tokens[i];
+			if (!label.empty() && label[label.size() - 1] == ':')
+				label.erase(label.size() - 1);
+			entry.name += (entry.name.empty() ? "" : ".") + label;
+		}
+		entry.value.assign(tokens.begin() + valueStart, tokens.end());
+		entry.length = naturalLength(entry.value);
+		pEntries->push_back(entry);
+	}
+	fclose(pFile);
+
+	for (size_t i = 0; i < pEntries->size(); i++)		//addresses and lengths
+	{
+		psKeyEntry& entry = (*pEntries)[i];
+		if (entry.address < 0)
+			entry.address = (i == 0) ? 0 : (*pEntries)[i - 1].address + (int) (*pEntries)[i - 1].length;
+		if (i + 1 < pEntries->size() && (*pEntries)[i + 1].address > entry.address)
+			entry.length = (*pEntries)[i + 1].address - entry.address;
+	}
+	return true;
+}
+
+static psKeyEntry* findEntry(std::vector<psKeyEntry>& entries, const std::string& key){
+	if (isHexToken(key))
+	{
+		int address = (int) strtoul(key.c_str(), 0, 16);
+		for (size_t i = 0; i < entries.size(); i++)
+			if (entries[i].address == address)
+				return &entries[i];
+		return 0;
+	}
+	for (size_t i = 0; i < entries.size(); i++)
+		if (entries[i].name == key)
+			return &entries[i];
+	return 0;
+}
+
+/**
+  * @brief	Put PSKey bytes to profile image.
+  */
+static void putToImage(const psKeyEntry& entry, const std::vector<uint8_t>& bytes, std::vector<int>* pImage){
+	for (size_t i = 0; i < bytes.size() && entry.address + i < pImage->size(); i++)
+		(*pImage)[entry.address + i] = bytes[i];
+}
+
+/**
+  * @brief	Build runs of set bytes (sorted, merged) and write profile.
+  */
+static bool writeProfile(const char* pPath, const std::vector<int>& image, uint32_t profileVersion, std::vector<uint8_t>* pProfile){
+	std::vector<uint8_t> payload;
+	uint16_t runs = 0;
+
+	for (size_t address = 0; address < image.size(); )
+	{
+		if (image[address] < 0)
+		{
+			address++;
+			continue;
+		}
+		size_t end = address;
+		while (end < image.size() && image[end] >= 0)
+			end++;
+		uint8_t runHeader[OVC3860_ProfileRunHeaderLength] = {(uint8_t) address, (uint8_t) (address >> 8),
+															 (uint8_t) (end - address), (uint8_t) ((end - address) >> 8)};
+		payload.insert(payload.end(), runHeader, runHeader + OVC3860_ProfileRunHeaderLength);
+		for (size_t i = address; i < end; i++)
+			payload.push_back((uint8_t) image[i]);
+		runs++;
+		address = end;
+	}
+
+	pProfile->assign(OVC3860_ProfileHeaderLength, 0);
+	OVC3860PSKeyProfile::buildHeader(pProfile->data(), runs, payload.data(), payload.size(), profileVersion);
+	pProfile->insert(pProfile->end(), payload.begin(), payload.end());
+
+	FILE* pFile = fopen(pPath, "wb");
+	if (pFile == 0)
+		return false;
+	bool isWritten = fwrite(pProfile->data(), 1, pProfile->size(), pFile) == pProfile->size();
+	return (fclose(pFile) == 0) && isWritten;
+}
+
+/**
+  * @brief	Check profile with target loader and print it.
+  */
+static bool dumpProfile(const std::vector<uint8_t>& profile, bool isVerbose){
+	OVC3860PSKeyProfile Profile;
+	uint16_t address;
+	uint16_t length;
+	const uint8_t* pData;
+
+	if (!Profile.load(profile.data(), profile.size()))
+	{
+		fprintf(stderr, "profile is not valid\n");
+		return false;
+	}
+	printf("profile version %lu, %u runs, %u write frames, %u bytes\n", (unsigned long) Profile.getProfileVersion(),
+			Profile.getRunCount(), (unsigned) Profile.getFrameCount(), (unsigned) profile.size());
+	for (uint16_t i = 0; isVerbose && Profile.getRun(i, &address, &length, &pData); i++)
+	{
+		printf("0x%03X %3u:", address, length);
+		for (uint16_t j = 0; j < length; j++)
+			printf(" %02X", pData[j]);
+		printf("\n");
+	}
+	return true;
+}
+
+int main(int argc, char** argv){
+	const char* pOverrides = 0;
+	bool isAll = false;
+	uint32_t profileVersion = 0;
+	std::vector<const char*> files;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+			pOverrides = argv[++i];
+		else if (strcmp(argv[i], "-v") == 0 && i + 1 < argc)
+			profileVersion = strtoul(argv[++i], 0, 0);
+		else if (strcmp(argv[i], "-a") == 0)
+			isAll = true;
+		else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+		{
+			std::vector<uint8_t> profile;
+			FILE* pFile = fopen(argv[++i], "rb");
+			int c;
+			if (pFile == 0)
+				return 1;
+			while ((c = fgetc(pFile)) != EOF)
+				profile.push_back((uint8_t) c);
+			fclose(pFile);
+			return dumpProfile(profile, true) ? 0 : 1;
+		}
+		else
+			files.push_back(argv[i]);
+	}
+	if (files.size() != 2)
+	{
+		fprintf(stderr, "usage: %s <memmap.txt> <profile.bin> [-o overrides.txt] [-a] [-v version]\n"
+						"       %s -d <profile.bin>\n", argv[0], argv[0]);
+		return 1;
+	}
+
+	std::vector<psKeyEntry> entries;
+	std::vector<int> image(OVC3860_ProfileMaxAddress, -1);		//-1 - byte is not in profile
+	std::vector<uint8_t> bytes;
+	int errors = 0;
+
+	if (!readMemmap(files[0], &entries))
+	{
+		fprintf(stderr, "%s: cannot open\n", files[0]);
+		return 1;
+	}
+	for (size_t i = 0; isAll && i < entries.size(); i++)
+	{
+		if (isDeviceSpecific(entries[i]))
+			continue;									//only from overrides
+		if (encodeValue(entries[i], entries[i].value, &bytes))
+			putToImage(entries[i], bytes, &image);
+		else
+			fprintf(stderr, "%s:%d: warning: %s value does not fit %u bytes, skipped\n",
+					files[0], entries[i].line, entries[i].name.c_str(), (unsigned) entries[i].length);
+	}
+
+	if (pOverrides)
+	{
+		FILE* pFile = fopen(pOverrides, "r");
+		char line[512];
+		int lineNumber = 0;
+		if (pFile == 0)
+		{
+			fprintf(stderr, "%s: cannot open\n", pOverrides);
+			return 1;
+		}
+		while (fgets(line, sizeof(line), pFile))
+		{
+			lineNumber++;
+			std::string text = line;
+			size_t comment = text.find('#');
+			if (comment != std::string::npos && text.find('"') > comment)
+				text.erase(comment);
+			std::vector<std::string> tokens = splitTokens(text);
+			if (tokens.empty())
+				continue;
+			psKeyEntry* pEntry = findEntry(entries, tokens[0]);
+			if (pEntry == 0)
+			{
+				fprintf(stderr, "%s:%d: error: unknown PSKey %s\n", pOverrides, lineNumber, tokens[0].c_str());
+				errors++;
+				continue;
+			}
+			std::vector<std::string> value(tokens.begin() + 1, tokens.end());
+			if (!encodeValue(*pEntry, value, &bytes))
+			{
+				fprintf(stderr, "%s:%d: error: value does not fit %s (%u bytes)\n", pOverrides, lineNumber, pEntry->name.c_str(), (unsigned) pEntry->length);
+				errors++;
+				continue;
+			}
+			putToImage(*pEntry, bytes, &image);
+		}
+		fclose(pFile);
+	}
+	if (errors)
+		return 1;
+
+	std::vector<uint8_t> profile;
+	if (!writeProfile(files[1], image, profileVersion, &profile))
+	{
+		fprintf(stderr, "%s: cannot write\n", files[1]);
+		return 1;
+	}
+	return dumpProfile(profile, false) ? 0 : 1;
+}
+
+#endif /* OVC3860_HOST_TOOL */